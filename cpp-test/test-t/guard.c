@@ -0,0 +1,35 @@
+/* guard.c:     include guards.  */
+/*
+ * A header whose text is wholly enclosed in "#ifndef GUARD" and "#endif" is
+ * not read again while GUARD is defined, as if it had "#pragma once", but it
+ * should be processed in the same way as it were read.
+ */
+
+/* 1:   A guarded header included twice.    */
+/*  guard1; guard1_end;  */
+#include    "guard1.h"
+/*  Nothing.    */
+#include    "guard1.h"
+
+/* 2:   The guard macro is undefined, then the header is read again.    */
+/*  guard1; guard1_end;  */
+#undef  GUARD1_H
+#include    "guard1.h"
+/*  Nothing.    */
+#include    "guard1.h"
+
+/* 3:   The tokens after #endif are not guarded.    */
+/*  guard2; guard2_trailer;  */
+#include    "guard2.h"
+/*  guard2_trailer;  */
+#include    "guard2.h"
+
+/* { dg-do preprocess }
+   { dg-final { if ![file exist guard.i] { return }                     } }
+   { dg-final { if \{ [llength [grep guard.i "^ *guard1 *;"]] == 2  \} \{  } }
+   { dg-final { if \{ [llength [grep guard.i "^ *guard1_end *;"]] == 2  \} \{  } }
+   { dg-final { if \{ [llength [grep guard.i "^ *guard2 *;"]] == 1  \} \{  } }
+   { dg-final { if \{ [llength [grep guard.i "^ *guard2_trailer *;"]] == 2  \} \{  } }
+   { dg-final { return \} \} \} \}                                      } }
+   { dg-final { fail "guard.c: include guards"                          } }
+ */
@@ -0,0 +1,7 @@
+/* guard2.h:    a header with tokens after the include guard.    */
+
+#ifndef GUARD2_H
+#define GUARD2_H
+    guard2;
+#endif
+    guard2_trailer;
@@ -44,6 +44,10 @@
 
 static int      do_if( int hash, const char * directive_name);
                 /* #if, #elif, #ifdef, #ifndef      */
+static void     chk_guard( int hash);
+                /* Detect include guard of the file */
+static ATOM *   guard_macro( int if_dir);
+                /* Macro tested by #ifndef, #if     */
 static void     sync_linenum( void);
                 /* Synchronize number of newlines   */
 static long     do_line( void);
@@ -64,6 +68,14 @@ static void     do_undef( void);
                 /* Process #undef directive         */
 static void     dump_repl( const DEFBUF * dp, FILE * fp, int gcc2_va);
                 /* Dump replacement text            */
+static void     grow_symtab( void);
+                /* Enlarge the symbol table         */
+static char *   sym_alloc( size_t size);
+                /* Allocate from the symbol arena   */
+static int      compile_repl( const char * repl);
+                /* Divide replacement text into tokens      */
+static int      cmp_atom( const void * ap1, const void * ap2);
+                /* Compare names for qsort()        */
 
 /*
  * Generate (by hand-inspection) a set of unique values for each directive.
@@ -208,6 +220,8 @@ void    directive( void)
 
     macro_line = 0;                         /* Reset error flag     */
     file = infile;                  /* Remember the current file    */
+    if (file->guard_state != GUARD_NONE)
+        chk_guard( hash);
 
     switch (hash) {
 
@@ -453,7 +467,7 @@ static int  do_if( int hash, const char * directive_name)
             cerror( not_ident, work_buf, 0L, NULL);
             return  FALSE;      /* Next token is not an identifier  */
         }
-        found = ((defp = look_id( identifier)) != NULL);    /* Look in table*/
+        found = ((defp = look_token()) != NULL);     /* Look in table*/
         if (mcpp_debug & MACRO_CALL) {
             if (found)
                 mcpp_fprintf( OUT, "/*%s*/", defp->name);
@@ -472,6 +486,95 @@ static int  do_if( int hash, const char * directive_name)
     return  TRUE;
 }
 
+static void chk_guard(
+    int     hash                            /* Hash of the directive*/
+)
+/*
+ * Follow the directives of the current source file to detect its include
+ * guard, that is, #ifndef MACRO or #if ! defined MACRO as the first
+ * directive whose section is closed by #endif without #else or #elif and
+ * followed by no other directive.  The tokens out of the section are
+ * checked by mcpp_main(), and the guard is registered at the end of the
+ * file by add_guard() if the macro is defined then.
+ */
+{
+    FILEINFO *  file = infile;
+
+    switch (file->guard_state) {
+    case GUARD_START:
+        if (ifptr == file->initif && (hash == L_ifndef || hash == L_if)
+                && (file->guard = guard_macro( hash == L_if)) != NULL)
+            file->guard_state = GUARD_IN;
+        else
+            file->guard_state = GUARD_NONE;
+        break;
+    case GUARD_IN:
+        if (ifptr == file->initif + 1) {    /* Section of the guard */
+            if (hash == L_endif)
+                file->guard_state = GUARD_END;
+            else if (hash == L_else || hash == L_elif)
+                file->guard_state = GUARD_NONE;
+        }
+        break;
+    case GUARD_END:
+        file->guard_state = GUARD_NONE;     /* Directive out of guard   */
+        break;
+    }
+}
+
+static ATOM *   guard_macro(
+    int     if_dir                          /* #if rather than #ifndef  */
+)
+/*
+ * Peek the rest of the #ifndef or #if line, to be read by do_if(), and
+ * return the ATOM of MACRO if the line is "#ifndef MACRO", "#if ! defined
+ * MACRO" or "#if ! defined( MACRO)", else return NULL.
+ */
+{
+    const char *    cp = infile->bptr;
+    const char *    name;
+    size_t  len;
+    unsigned    hash;
+    int     paren = FALSE;
+
+    while (char_type[ *cp & UCHARMAX] & HSP)
+        cp++;
+    if (if_dir) {
+        if (*cp++ != '!')
+            return  NULL;
+        while (char_type[ *cp & UCHARMAX] & HSP)
+            cp++;
+        if (memcmp( cp, "defined", 7) != 0
+                || (char_type[ *(cp += 7) & UCHARMAX] & (LET | DIG)))
+            return  NULL;
+        while (char_type[ *cp & UCHARMAX] & HSP)
+            cp++;
+        if (*cp == '(') {
+            paren = TRUE;
+            cp++;
+            while (char_type[ *cp & UCHARMAX] & HSP)
+                cp++;
+        }
+    }
+    if (! (char_type[ *cp & UCHARMAX] & LET))
+        return  NULL;                       /* Not an identifier    */
+    name = cp;
+    for (hash = 0; char_type[ *cp & UCHARMAX] & (LET | DIG); cp++)
+        hash = ATOM_HASH( hash, *cp);
+    len = (size_t) (cp - name);
+    while (char_type[ *cp & UCHARMAX] & HSP)
+        cp++;
+    if (paren) {
+        if (*cp++ != ')')
+            return  NULL;
+        while (char_type[ *cp & UCHARMAX] & HSP)
+            cp++;
+    }
+    if (*cp != '\n')
+        return  NULL;
+    return  intern_id( name, len, hash);
+}
+
 static void sync_linenum( void)
 /*
  * Put out newlines or #line line to synchronize line number with the
@@ -1103,8 +1206,9 @@ static int  get_repl(
     }
 
     while (repl_base < repl_cur
-            && (*(repl_cur - 1) == ' ' || *(repl_cur - 1) == '\t'))
-        repl_cur--;                     /* Remove trailing spaces   */
+            && (*(repl_cur - 1) == ' ' || *(repl_cur - 1) == '\t')
+            && ! (repl_base < repl_cur - 1 && *(repl_cur - 2) == MAC_PARM))
+        repl_cur--;     /* Remove trailing spaces, not parameter number */
     *repl_cur = EOS;                        /* Terminate work       */
 
     unget_ch();                             /* For syntax check     */
@@ -1270,7 +1374,7 @@ static void do_undef( void)
         skip_nl();
         unget_ch();
     } else {
-        if ((defp = look_id( identifier)) == NULL) {
+        if ((defp = look_token()) == NULL) {
             if (warn_level & 8)
                 cwarn( "\"%s\" wasn't defined"              /* _W8_ */
                         , identifier, 0L, NULL);
@@ -1296,14 +1400,71 @@ static void do_undef( void)
 /*
  *                  C P P   S y m b o l   T a b l e s
  *
- * SBSIZE defines the number of hash-table slots for the symbol table.
- * It must be a power of 2.
+ * The symbol table is the table of the interned identifiers (ATOMs), which
+ * is open-addressed by the hash value of the name.  Each ATOM heads the list
+ * of the definitions of the name: the current one first, then the pushed
+ * ones from the latest.  SBSIZE defines the initial number of the slots,
+ * which must be a power of 2.  The table is doubled as soon as it becomes
+ * half full, and ATOMs are never freed (until clear_symtable()), so that a
+ * pointer to ATOM is valid throughout.
+ *
+ * ATOMs and DEFBUFs are allocated from the chunks of the symbol arena, which
+ * are released all at once by clear_symtable().  A DEFBUF deleted by #undef
+ * or by redefinition is kept on the free-list of its size to be reused.
+ * A DEFBUF larger than DEF_FREEMAX is not carved from the arena but malloc'ed
+ * by itself on the list of large blocks, and free()'d when deleted.  The size
+ * of each block is recorded in the SYMHEAD just before the block.
  */
 
-/* Symbol table queue headers.  */
-static DEFBUF *     symtab[ SBSIZE];
+typedef struct atomslot {
+    unsigned        hash;                   /* Hash value of name   */
+    ATOM *          atom;                   /* NULL if empty slot   */
+} ATOMSLOT;
+
+static ATOMSLOT *   symtab = NULL;          /* The symbol table     */
+static size_t       sym_size = 0;           /* Number of the slots  */
+static size_t       num_of_atom = 0;        /* Number of ATOMs      */
 static long         num_of_macro = 0;
 
+#define SYM_CHUNK       0x10000             /* Size of a chunk      */
+#define DEF_FREEMAX     0x400       /* Max size of DEFBUF to reuse  */
+
+typedef union symhead {
+    size_t          size;                   /* Size of the block    */
+    char *          align_p;                /* For alignment        */
+    long            align_l;
+} SYMHEAD;
+
+typedef struct symchunk {
+    struct symchunk *   next;               /* Next (older) chunk   */
+    SYMHEAD         area[ 1];               /* Blocks               */
+} SYMCHUNK;
+
+typedef struct symlarge {       /* Header of a large DEFBUF         */
+    struct symlarge *   next;
+    struct symlarge *   prev;
+    SYMHEAD         head;                   /* Size of the block    */
+} SYMLARGE;
+
+static SYMCHUNK *   sym_chunks = NULL;      /* List of chunks       */
+static char *       sym_cur = NULL;         /* Free area in chunk   */
+static char *       sym_end = NULL;         /* End of the chunk     */
+static DEFBUF *     def_free[ DEF_FREEMAX / sizeof (SYMHEAD) + 1];
+                                    /* Free-lists by size of DEFBUF */
+static SYMLARGE     sym_large = { &sym_large, &sym_large, { 0}};
+                                    /* List of large DEFBUFs        */
+static REPL_TOK *   repl_toks = NULL;       /* Work of compile_repl()   */
+static size_t       max_repl_toks = 0;      /* Elements of repl_toks[]  */
+static struct {
+    size_t          chunks;                 /* Number of chunks     */
+    size_t          arena;                  /* Bytes of chunks      */
+    size_t          peak;                   /* Max of 'arena'       */
+    size_t          atoms;                  /* Bytes of ATOMs       */
+    size_t          defs;           /* Bytes of DEFBUFs in use      */
+    size_t          freed;          /* Bytes on the free-lists      */
+    size_t          large;          /* Bytes of large DEFBUFs       */
+} sym_mem;
+
 #if MCPP_LIB
 void    init_directive( void)
 /* Initialize static variables. */
@@ -1329,35 +1490,215 @@ DEFBUF *    look_id( const char * name)
         return ((cmp == 0) ? *prevp : NULL);
 }
 
+DEFBUF *    look_token( void)
+/*
+ * Same as look_id( identifier) for the identifier token just scanned by
+ * scan_token(), using the ATOM of the token without any search.
+ */
+{
+    DEFBUF *    dp;
+
+    if (cur_token.type != NAM)              /* Shouldn't happen     */
+        return  look_id( identifier);
+    if ((dp = cur_token.atom->defs) == NULL)        /* Not a macro  */
+        return  NULL;
+
+    if (standard)
+        return  (dp->push == 0) ? dp : NULL;
+    else
+        return  dp;
+}
+
 DEFBUF **   look_prev(
     const char *    name,                   /* Name of the macro    */
     int *   cmp                             /* Result of comparison */
 )
 /*
  * Look for the place to insert the macro definition.
- * Return a pointer to the previous member in the linked list.
+ * Return a pointer to the head of the list of the definitions of the name,
+ * and set *cmp to 0 if the list is not empty, else to -1.
  */
 {
     const char *    np;
-    DEFBUF **   prevp;
+    ATOM *      ap;
+    unsigned    hash;
+
+    for (hash = 0, np = name; *np != EOS; np++)
+        hash = ATOM_HASH( hash, *np);
+    ap = intern_id( name, (size_t) (np - name), hash);
+    *cmp = (ap->defs == NULL) ? -1 : 0;
+
+    return  &ap->defs;
+}
+
+ATOM *  intern_id(
+    const char *    name,                   /* The identifier       */
+    size_t      len,                        /* Length of the name   */
+    unsigned    hash                /* Hash value by ATOM_HASH()    */
+)
+/*
+ * Look for the identifier in the symbol table, and enter it if not found.
+ * Return the ATOM of the name.
+ */
+{
+    ATOMSLOT *  sp;
+    ATOM *      ap;
+    size_t      mask;
+
+    if (num_of_atom * 2 >= sym_size)
+        grow_symtab();
+    mask = sym_size - 1;
+    for (sp = &symtab[ hash & mask]; (ap = sp->atom) != NULL
+            ; sp = &symtab[ (sp - symtab + 1) & mask]) {
+        if (sp->hash == hash && ap->len == len
+                && memcmp( ap->name, name, len) == 0)
+            return  ap;
+    }
+
+    ap = (ATOM *) sym_alloc( sizeof (ATOM) + len);
+    sym_mem.atoms += ((SYMHEAD *) ap - 1)->size;
+    ap->hash = hash;
+    ap->len = len;
+    ap->defs = NULL;
+    memcpy( ap->name, name, len);
+    ap->name[ len] = EOS;
+    sp->hash = hash;
+    sp->atom = ap;
+    num_of_atom++;
+    return  ap;
+}
+
+static void grow_symtab( void)
+/*
+ * Allocate the symbol table, or double its size and rehash the ATOMs.
+ */
+{
+    ATOMSLOT *  old = symtab;
+    size_t      old_size = sym_size;
+    size_t      i, j, mask;
+
+    sym_size = old_size ? old_size * 2 : SBSIZE;
+    mask = sym_size - 1;
+    symtab = (ATOMSLOT *) xmalloc( sym_size * sizeof (ATOMSLOT));
+    memset( symtab, 0, sym_size * sizeof (ATOMSLOT));
+    for (i = 0; i < old_size; i++) {
+        if (old[ i].atom == NULL)
+            continue;
+        for (j = old[ i].hash & mask; symtab[ j].atom != NULL
+                ; j = (j + 1) & mask)
+            ;
+        symtab[ j] = old[ i];
+    }
+    free( old);
+}
+
+static char *   sym_alloc(
+    size_t      size                        /* Size of the block    */
+)
+/*
+ * Allocate a block from the symbol arena.  The size is rounded up to a
+ * multiple of sizeof (SYMHEAD) and recorded in the SYMHEAD of the block.
+ */
+{
+    SYMCHUNK *  chunk;
+    SYMHEAD *   hp;
+    size_t      csize;
+
+    size = (size + 2 * sizeof (SYMHEAD) - 1) / sizeof (SYMHEAD)
+            * sizeof (SYMHEAD);             /* With the SYMHEAD     */
+    if ((size_t) (sym_end - sym_cur) < size) {      /* New chunk    */
+        csize = sizeof (SYMCHUNK) + size;
+        if (csize < SYM_CHUNK)
+            csize = SYM_CHUNK;
+        chunk = (SYMCHUNK *) xmalloc( csize);
+        chunk->next = sym_chunks;
+        sym_chunks = chunk;
+        sym_cur = (char *) chunk->area;
+        sym_end = (char *) chunk + csize;
+        sym_mem.chunks++;
+        if ((sym_mem.arena += csize) > sym_mem.peak)
+            sym_mem.peak = sym_mem.arena;
+    }
+    hp = (SYMHEAD *) sym_cur;
+    sym_cur += size;
+    hp->size = size;
+    return  (char *) (hp + 1);
+}
+
+DEFBUF *    alloc_def(
+    size_t      size                        /* Size of DEFBUF       */
+)
+/*
+ * Allocate a DEFBUF (with the name, parmnames and repl following it), from
+ * the free-list if possible.  A large one is malloc'ed by itself.
+ */
+{
     DEFBUF *    dp;
-    size_t      s_name;
-    int         hash;
-
-    for (hash = 0, np = name; *np != EOS; )
-        hash += *np++;
-    hash += s_name = (size_t)(np - name);
-    s_name++;
-    prevp = & symtab[ hash & SBMASK];
-    *cmp = -1;                              /* Initialize           */
-
-    while ((dp = *prevp) != NULL) {
-        if ((*cmp = memcmp( dp->name, name, s_name)) >= 0)
-            break;
-        prevp = &dp->link;
+    SYMLARGE *  lp;
+    size_t      bsize;
+
+    bsize = (size + 2 * sizeof (SYMHEAD) - 1) / sizeof (SYMHEAD)
+            * sizeof (SYMHEAD);
+    if (bsize > DEF_FREEMAX) {
+        lp = (SYMLARGE *) xmalloc( sizeof (SYMLARGE) + size);
+        lp->next = sym_large.next;
+        lp->prev = &sym_large;
+        lp->next->prev = lp;
+        sym_large.next = lp;
+        lp->head.size = bsize;
+        dp = (DEFBUF *) (lp + 1);
+        sym_mem.large += bsize;
+    } else if ((dp = def_free[ bsize / sizeof (SYMHEAD)]) != NULL) {
+        def_free[ bsize / sizeof (SYMHEAD)] = dp->link;
+        sym_mem.freed -= bsize;
+    } else {
+        dp = (DEFBUF *) sym_alloc( size);
+    }
+    sym_mem.defs += bsize;
+    return  dp;
+}
+
+void    free_def(
+    DEFBUF *    dp
+)
+/*
+ * Put the DEFBUF on the free-list of its size.  A large one is free()'d.
+ */
+{
+    size_t      bsize = ((SYMHEAD *) dp - 1)->size;
+    SYMLARGE *  lp;
+
+    sym_mem.defs -= bsize;
+    if (bsize > DEF_FREEMAX) {
+        lp = (SYMLARGE *) dp - 1;
+        lp->prev->next = lp->next;
+        lp->next->prev = lp->prev;
+        free( lp);
+        sym_mem.large -= bsize;
+    } else {
+        dp->link = def_free[ bsize / sizeof (SYMHEAD)];
+        def_free[ bsize / sizeof (SYMHEAD)] = dp;
+        sym_mem.freed += bsize;
     }
+}
 
-    return  prevp;
+void    dump_sym_memory( void)
+/*
+ * Report the memory used by the symbol table, for the MEMORY debug class.
+ */
+{
+    mcpp_fprintf( DBG, "Symbol table: %lu slots, %lu atoms, %ld macros\n"
+            , (unsigned long) sym_size, (unsigned long) num_of_atom
+            , num_of_macro);
+    mcpp_fprintf( DBG
+            , "Symbol arena: %lu chunks, %lu bytes (peak %lu bytes)\n"
+            , (unsigned long) sym_mem.chunks, (unsigned long) sym_mem.arena
+            , (unsigned long) sym_mem.peak);
+    mcpp_fprintf( DBG, "    atoms %lu, macros %lu (large %lu), free-lists"
+            " %lu, table %lu bytes\n"
+            , (unsigned long) sym_mem.atoms, (unsigned long) sym_mem.defs
+            , (unsigned long) sym_mem.large, (unsigned long) sym_mem.freed
+            , (unsigned long) (sym_size * sizeof (ATOMSLOT)));
 }
 
 DEFBUF *    look_and_install(
@@ -1396,11 +1737,18 @@ DEFBUF *    install_macro(
  * Returns NULL if the symbol was Standard-predefined.
  * Note that predefinedness can be specified by either of 'numargs' or
  * 'predefine'.
+ * In Standard modes the replacement text is divided into tokens here, so
+ * that prescan() need not scan it on every expansion.
  */
 {
     DEFBUF *    dp;
     DEFBUF *    defp;
-    size_t      s_name, s_parmnames, s_repl;
+    size_t      s_name, s_parmnames, s_repl, s_toks;
+    const char *    np;
+    unsigned    hash;
+    int         num_toks = 0;
+    int         has_ops = FALSE;
+    int         i;
 
     defp = *prevp;                  /* Old definition, if cmp == 0  */
     if (cmp == 0 && defp->nargs < DEF_NOARGS - 1)
@@ -1417,17 +1765,38 @@ DEFBUF *    install_macro(
     else
         s_parmnames = 0;
     s_repl = strlen( repl) + 1;
-    dp = (DEFBUF *)
-        xmalloc( sizeof (DEFBUF) + s_name + s_parmnames + s_repl);
+    s_toks = 0;
+    if (standard && (predefine ? predefine : numargs) >= DEF_NOARGS_DYNAMIC) {
+        /* Not __FILE__ nor __LINE__, which are re-written on each use  */
+        num_toks = compile_repl( repl);
+        for (i = 0; i < num_toks; i++) {
+            if (repl_toks[ i].type == REPL_STR
+                    || repl_toks[ i].type == REPL_CAT)
+                has_ops = TRUE;
+        }
+        /* Align the array following the texts  */
+        s_toks = sizeof (REPL_TOK) * num_toks + sizeof (REPL_TOK) - 1;
+    }
+    dp = alloc_def( sizeof (DEFBUF) + s_name + s_parmnames + s_repl + s_toks);
     if (cmp || (standard && (*prevp)->push)) {  /* New definition   */
         dp->link = defp;                /* Insert to linked list    */
         *prevp = dp;
+        if (defp) {                     /* Pushed definition exists */
+            dp->atom = defp->atom;
+        } else {
+            for (hash = 0, np = name; *np != EOS; np++)
+                hash = ATOM_HASH( hash, *np);
+            dp->atom = intern_id( name, s_name, hash);
+        }
     } else {                            /* Redefinition             */
         dp->link = defp->link;          /* Replace old def with new */
         *prevp = dp;
-        free( defp);
+        dp->atom = defp->atom;
+        free_def( defp);
     }
     dp->nargs = predefine ? predefine : numargs;
+    dp->replacing = 0;
+    dp->prof = NULL;
     if (standard) {
         dp->push = 0;
         dp->parmnames = (char *)dp + sizeof (DEFBUF) + s_name;
@@ -1439,9 +1808,21 @@ DEFBUF *    install_macro(
     }
     memcpy( dp->name, name, s_name + 1);
     memcpy( dp->repl, repl, s_repl);
+    dp->num_toks = num_toks;
+    dp->has_ops = has_ops;
+    if (num_toks) {
+        s_toks = (size_t) (dp->repl + s_repl - (char *) dp)
+                + sizeof (REPL_TOK) - 1;
+        dp->toks = (REPL_TOK *) ((char *) dp
+                + s_toks / sizeof (REPL_TOK) * sizeof (REPL_TOK));
+        memcpy( dp->toks, repl_toks, sizeof (REPL_TOK) * num_toks);
+    } else {
+        dp->toks = NULL;
+    }
     /* Remember where the macro is defined  */
     dp->fname = cur_fullname;   /* Full-path-list of current file   */
     dp->mline = src_line;
+    macro_gen++;                /* Invalidate the cached expansions */
     if (standard && cmp && ++num_of_macro == std_limits.n_macro + 1
             && std_limits.n_macro && (warn_level & 4))
         /* '&& std_limits.n_macro' to avoid warning before initialization   */
@@ -1450,6 +1831,62 @@ DEFBUF *    install_macro(
     return  dp;
 }
 
+static int  compile_repl(
+    const char *    repl                    /* Replacement text     */
+)
+/*
+ * Divide the replacement text into the elements of REPL_TOK in repl_toks[],
+ * in the same way as prescan() would scan the text, so that prescan() need
+ * not scan it on each expansion.  Return the number of the elements.
+ */
+{
+    char        tbuf[ NWORK + IDMAX];       /* Scratch for a token  */
+    char *      tp;
+    FILEINFO *  file;
+    REPL_TOK *  rp;
+    size_t      n = 0;
+    int         c;
+
+    file = unget_string( repl, NULL);
+    while (*infile->bptr != EOS) {      /* Never read over the text */
+        if (n >= max_repl_toks) {
+            max_repl_toks = max_repl_toks ? max_repl_toks * 2 : 64;
+            repl_toks = (REPL_TOK *) xrealloc( (char *) repl_toks
+                    , sizeof (REPL_TOK) * max_repl_toks);
+        }
+        rp = &repl_toks[ n++];
+        rp->off = (unsigned) (infile->bptr - file->buffer);
+        rp->parm = 0;
+        switch (c = get_ch()) {
+        case ST_QUOTE:
+            skip_ws();      /* Skip spaces and the returned MAC_PARM*/
+            rp->parm = get_ch();            /* Parameter number     */
+            rp->type = REPL_STR;
+            break;
+        case CAT:
+            rp->type = REPL_CAT;
+            break;
+        case MAC_PARM:
+            rp->parm = get_ch();            /* Parameter number     */
+            rp->type = REPL_PARM;
+            break;
+        case TOK_SEP:
+        case ' ':
+        case '\t':
+            rp->type = REPL_SPACE;
+            break;
+        default:
+            scan_token( c, (tp = tbuf, &tp), tbuf + NWORK);
+            rp->type = REPL_TOKEN;
+            break;
+        }
+        rp->len = (unsigned) (infile->bptr - file->buffer) - rp->off;
+    }
+    infile = file->parent;      /* Unwind the "file" by ourselves   */
+    free_file( file);
+    return  (int) n;
+}
+
 int undefine(
     const char *  name                      /* Name of the macro    */
 )
@@ -1471,12 +1908,13 @@ int undefine(
     if (standard && dp->push)
         return  FALSE;                  /* 'Pushed' macro           */
     *prevp = dp->link;          /* Link the previous and the next   */
+    macro_gen++;                /* Invalidate the cached expansions */
     if ((mcpp_debug & MACRO_CALL) && dp->mline) {
         /* Notice this directive unless the macro is predefined     */
         mcpp_fprintf( OUT, "/*undef %ld*//*%s*/\n", src_line, dp->name);
         wrong_line = TRUE;
     }
-    free( dp);                          /* Delete the definition    */
+    free_def( dp);                      /* Delete the definition    */
     if (standard)
         num_of_macro--;
     return  TRUE;
@@ -1654,46 +2092,76 @@ void    dump_def(
     int     K_opt                       /* -K option is specified   */
 )
 /*
- * Dump all the current macro definitions to output stream.
+ * Dump all the current macro definitions to output stream, sorted by the
+ * names.
  */
 {
+    ATOM **     atoms;
     DEFBUF *    dp;
-    DEFBUF **   symp;
+    size_t      i, n;
 
     sharp( NULL, 0);    /* Report the current source file & line    */
     if (comment)
         mcpp_fputs( "/* Currently defined macros. */\n", OUT);
-    for (symp = symtab; symp < &symtab[ SBSIZE]; symp++) {
-        if ((dp = *symp) != NULL) {
-            do {
-                if (K_opt)
-                    mcpp_fprintf( OUT, "/*m%s*/\n", dp->name);
-                else
-                    dump_a_def( NULL, dp, FALSE, comment, fp_out);
-            } while ((dp = dp->link) != NULL);
+    atoms = (ATOM **) xmalloc( (num_of_atom + 1) * sizeof (ATOM *));
+    for (i = n = 0; i < sym_size; i++) {
+        if (symtab[ i].atom != NULL && symtab[ i].atom->defs != NULL)
+            atoms[ n++] = symtab[ i].atom;
+    }
+    qsort( atoms, n, sizeof (ATOM *), cmp_atom);
+    for (i = 0; i < n; i++) {
+        for (dp = atoms[ i]->defs; dp != NULL; dp = dp->link) {
+            if (K_opt)
+                mcpp_fprintf( OUT, "/*m%s*/\n", dp->name);
+            else
+                dump_a_def( NULL, dp, FALSE, comment, fp_out);
         }
     }
+    free( atoms);
     wrong_line = TRUE;               /* Line number is out of sync  */
 }
 
+static int  cmp_atom(
+    const void *    ap1,
+    const void *    ap2
+)
+/*
+ * Compare the names of two ATOMs for qsort() in dump_def().
+ */
+{
+    return  strcmp( (* (ATOM * const *) ap1)->name
+            , (* (ATOM * const *) ap2)->name);
+}
+
 #if MCPP_LIB
 void    clear_symtable( void)
 /*
- * Free all the macro definitions.
+ * Free all the macro definitions and the atoms at once by releasing the
+ * symbol arena.
  */
 {
-    DEFBUF *    next;
-    DEFBUF *    dp;
-    DEFBUF **   symp;
+    SYMCHUNK *  chunk;
+    SYMLARGE *  lp;
 
-    for (symp = symtab; symp < &symtab[ SBSIZE]; symp++) {
-        for (next = *symp; next != NULL; ) {
-            dp = next;
-            next = dp->link;
-            free( dp);                      /* Free the symbol      */
-        }
-        *symp = NULL;
+    while ((chunk = sym_chunks) != NULL) {
+        sym_chunks = chunk->next;
+        free( chunk);
+    }
+    while ((lp = sym_large.next) != &sym_large) {
+        sym_large.next = lp->next;
+        free( lp);
     }
+    sym_large.prev = &sym_large;
+    sym_cur = sym_end = NULL;
+    memset( def_free, 0, sizeof def_free);
+    free( symtab);
+    symtab = NULL;
+    free( repl_toks);
+    repl_toks = NULL;
+    max_repl_toks = 0;
+    sym_size = num_of_atom = num_of_macro = 0;
+    sym_mem.chunks = sym_mem.arena = 0;
+    sym_mem.atoms = sym_mem.defs = sym_mem.freed = sym_mem.large = 0;
+    cur_token.type = 0;                     /* Its atom is released */
 }
 #endif
-
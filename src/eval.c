@@ -521,7 +521,7 @@ static int  eval_lex( void)
             if (c == '(')                   /* Allow defined (name) */
                 c = skip_ws();
             if (scan_token( c, (workp = work_buf, &workp), work_end) == NAM) {
-                DEFBUF *    defp = look_id( identifier);
+                DEFBUF *    defp = look_token();
                 if (warn) {
                     ev.val = (defp != NULL);
                     if ((mcpp_debug & MACRO_CALL) && ! skip && defp)
@@ -532,7 +532,7 @@ static int  eval_lex( void)
                     return  VAL;            /* Parsed ok            */
             }
             cerror( "Bad defined syntax: %s"                /* _E_  */
-                    , infile->fp ? "" : infile->buffer, 0L, NULL);
+                    , infile->src ? "" : infile->buffer, 0L, NULL);
             break;
         } else if (cplus_val) {
             if (str_eq( identifier, "true")) {
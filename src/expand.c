@@ -56,6 +56,51 @@ typedef struct magic_seq {  /* Data of a sequence inserted between tokens   */
     char *          magic_end;          /* End of last MAC_INF seq  */
     int             space;              /* Space succeeds or not    */
 } MAGIC_SEQ;
+typedef struct exp_arg {    /* Argument expanded once by substitute()   */
+    char *          start;              /* Expansion in the output  */
+    char *          end;
+    size_t          log_from;   /* Names of macros logged by expanding()*/
+    size_t          log_to;
+} EXP_ARG;
+
+/*
+ * Scratch arena for the buffers of arguments and of intermediate results of
+ * macro expansion.  The blocks are allocated and released in LIFO order
+ * following the nesting of replace() (or replace_pre()), and the chunks are
+ * kept for reuse, so that a macro call does not malloc() nor free().
+ */
+#define SCR_SIZE    ((mac_work + IDMAX * 2) * 4)    /* Size of a chunk  */
+typedef union scr_align {           /* To align the blocks          */
+    char *          p;
+    long            l;
+    double          d;
+} SCR_ALIGN;
+#define SCR_ROUND( size)    (((size) + sizeof (SCR_ALIGN) - 1)  \
+        / sizeof (SCR_ALIGN) * sizeof (SCR_ALIGN))
+typedef struct scr_chunk {
+    struct scr_chunk *  prev;       /* Previous chunk               */
+    struct scr_chunk *  next;       /* Next chunk (kept for reuse)  */
+    char *          end;            /* End of the area              */
+    SCR_ALIGN       area[ 1];       /* Blocks                       */
+} SCR_CHUNK;
+static SCR_CHUNK *  scr_cur;        /* Current chunk                */
+static char *   scr_ptr;            /* Free area in the chunk       */
+
+/*
+ * Size of the work buffers of macro expansion, i.e. the buffers of the
+ * expansion, of the arguments and of the intermediate results.  It starts at
+ * NMACWORK and is doubled up to NMACWORK_MAX when the buffers overflowed in
+ * an expansion which can be done over again (see retry_exp()).  The larger
+ * size is kept for the later expansions.
+ */
+static size_t   mac_work = NMACWORK;
+static int      exp_retry;      /* The expansion may be done over again */
+static int      exp_overflow;   /* Overflowed, to be done over again    */
+static int      exp_altered;    /* Text of 'exp_file' has been altered  */
+static const FILEINFO * exp_file;   /* 'infile' at start of expansion   */
+static long     exp_serial;     /* Serial number of 'exp_file'      */
+static long     exp_line;       /* 'src_line' at start of expansion */
+static long     exp_diags;      /* 'diag_count' at start of expansion   */
 
 static int      compat_mode;
 /* Expand recursive macro more than Standard (for compatibility with GNUC)  */
@@ -86,6 +131,16 @@ static void     diag_macro( int severity, const char * format
                 /* Supplement diagnostic information*/
 static void     dump_args( const char * why, int nargs, const char ** arglist);
                 /* Dump arguments list              */
+static char *   scr_alloc( size_t size);
+                /* Allocate a block from the arena  */
+static void     scr_trim( char * block, size_t size);
+                /* Shrink the last block            */
+static void     scr_release( char * block);
+                /* Release the block and the later  */
+static void     scr_free( void);
+                /* Free all the chunks of the arena */
+static int      retry_exp( void);
+                /* Can the expansion be done over ? */
 
 static int      rescan_level;           /* Times of macro rescan    */
 
@@ -123,7 +178,7 @@ DEFBUF *    is_macro(
 {
     DEFBUF *    defp;
 
-    if ((defp = look_id( identifier)) != NULL)  /* Is a macro name  */
+    if ((defp = look_token()) != NULL)  /* Is a macro name      */
         return  is_macro_call( defp, cp, NULL, NULL);
     else
         return  NULL;
@@ -144,8 +199,12 @@ static DEFBUF * is_macro_call(
     if (defp->nargs >= 0                    /* Function-like macro  */
             || defp->nargs == DEF_PRAGMA) { /* _Pragma() pseudo-macro       */
         c = squeeze_ws( cp, endf, mgc_seq); /* See the next char.   */
-        if (c == CHAR_EOF)                  /* End of file          */
-            unget_string( "\n", NULL);      /* Restore skipped '\n' */
+        if (c == CHAR_EOF) {                /* End of file          */
+            if (standard)                   /* Restore skipped '\n' */
+                push_text( "\n", NULL);
+            else
+                unget_string( "\n", NULL);
+        }
         else if (! standard || c != RT_END)
                         /* Still in the file and rescan boundary ?  */
             unget_ch();                     /* To see it again      */
@@ -223,13 +282,283 @@ static int      max_in_src_num;     /* Current num of elements in in_src[]  */
 static int      in_src_num;             /* Index into in_src[]      */
 static int      trace_macro;        /* Enable to trace macro infs   */
 
-static struct {
+typedef struct replacing {
     const DEFBUF *  def;            /* Macro definition             */
     int             read_over;      /* Has read over repl-list      */
     /* 'read_over' is never used in POST_STD mode and in compat_mode*/
-} replacing[ RESCAN_LIMIT];         /* Macros currently replacing   */
+    int             prev;   /* Saved 'replacing' member of the DEFBUF   */
+} REPLACING;
+static REPLACING *  replacing;      /* Macros currently replacing   */
+static int      max_replacing;      /* Allocated elements of replacing[]    */
+#define INIT_REPLACING  0x40    /* Initial num of elements in replacing[]   */
 static int      has_pragma = FALSE;     /* Flag of _Pragma() operator       */
 
+/*
+ * A macro call is replaced by the frames of replace(), substitute() and
+ * rescan() on a stack, instead of the recursion of these routines.  A routine
+ * which needs a nested replacement or rescan pushes a frame and returns
+ * EXP_CALL, and it is called again with the result of the frame in
+ * 'exp_result'.  The texts to be rescanned are stacked by push_text() on a
+ * single "file", and the nested expansions are written in place in the output
+ * buffer of the outermost call, so that neither the C stack nor the "file"s
+ * grow with the nesting.
+ */
+#define EXP_REPLACE     1           /* Frame of replace()           */
+#define EXP_SUBST       2           /* Frame of substitute()        */
+#define EXP_RESCAN      3           /* Frame of rescan()            */
+#define EXP_DONE        0           /* The frame is done            */
+#define EXP_CALL        1           /* A frame has been pushed      */
+/* The text of the serial number is being read ?    */
+#define in_text( ser)   (infile && infile->serial == (ser))
+
+typedef struct exp_frame {
+    struct exp_frame *  prev;       /* The calling frame            */
+    int             kind;           /* EXP_REPLACE, EXP_SUBST or EXP_RESCAN */
+    int             state;          /* Where to resume, 0 at first  */
+    DEFBUF *        defp;           /* Macro replaced or substituted*/
+    const DEFBUF *  outer;          /* Outer macro replacing        */
+    const char *    in;             /* Sequence substituted or rescanned*/
+    char *          out;            /* Output buffer                */
+    char *          out_end;        /* End of output buffer         */
+    char *          out_p;          /* Current output pointer       */
+    char **         arglist;        /* Pointers to arguments        */
+    int             nargs;          /* Number of arguments expected */
+    /* Members of replace()         */
+    long            rt_serial;      /* Serial of the repl-text      */
+    LINE_COL        line_col;       /* Location of the call         */
+    int             in_src_n;       /* Index into in_src[]          */
+    char *          work;   /* Bottom of scratch blocks of this call*/
+    char *          expbuf;         /* Result of substitute()       */
+    int             m_num;          /* 'mac_num' of current macro   */
+    int             trace;          /* Trace other than _Pragma()   */
+    int             mapped;         /* Record the call to the map   */
+    int             prof_n;         /* Index into prof_calls[]      */
+    /* Members of substitute()      */
+    EXP_ARG *       expanded;       /* Arguments once expanded      */
+    EXP_ARG *       exp;            /* The argument being expanded  */
+    size_t          log_from;       /* Names logged before it       */
+    long            diags;          /* 'diag_count' before it       */
+    int             gvar_arg;       /* GCC variable argument        */
+    /* Members of rescan()          */
+    long            serial;         /* Serial of the text rescanned */
+    long            cur_serial;     /* 'infile' at start of rescan  */
+    size_t          cur_pos;        /*   and its text_pos()         */
+    char *          tp;             /* Token of the inner macro     */
+    DEFBUF *        inner;          /* Inner macro to replace       */
+    int             c;              /* First character of the token */
+    char *          mac_arg_start;  /* MAC_ARG_START in the output  */
+#if COMPILER == GNUC
+    int             within_defined;
+    int             within_defined_arg_depth;
+#endif
+} EXP_FRAME;
+
+static EXP_FRAME *  exp_top;        /* The innermost frame          */
+static EXP_FRAME *  exp_frames;     /* Pool of the frames           */
+static char *   exp_result;         /* Result of the frame just done*/
+
+/*
+ * Cache of the complete expansions of object-like macros, direct-mapped by
+ * the address of the definition.  An entry is valid only while 'macro_gen'
+ * is unchanged, that is, no macro has been defined nor undefined since.
+ * The expansions which depend on the context, i.e. which used __LINE__ or
+ * __FILE__, read the following text, left a name of function-like macro,
+ * issued any diagnostic or involved _Pragma(), are not cached.  Nor are the
+ * expansions which changed 'insert_sep' of POST_STD mode by peeking at the
+ * source.  The cache is not used while the macro calls are traced, mapped
+ * or profiled.
+ */
+#define EXP_CACHE_SIZE  256                 /* Must be a power of 2 */
+typedef struct exp_cache {
+    const DEFBUF *  defp;               /* Definition of the macro  */
+    long            gen;                /* 'macro_gen' when cached  */
+    int             state;  /* 'in_directive', 'in_include', 'insert_sep'  */
+    size_t          len;                /* Length of the expansion  */
+    size_t          size;               /* Allocated size of 'text' */
+    char *          text;               /* The expansion            */
+} EXP_CACHE;
+static EXP_CACHE    exp_cache[ EXP_CACHE_SIZE];
+static long     exp_cache_hits;         /* Number of cache hits     */
+static long     exp_cache_misses;       /* Number of cache misses   */
+static int      exp_special;    /* __LINE__ or __FILE__ is expanded */
+
+/*
+ * The macro map of -Y option records the macro calls out of directives into
+ * a binary file instead of embedding MAC_INF sequences into the expansion,
+ * and the source map of -L option records the source locations of the
+ * output lines and the macro calls of each expansion on them.  The formats
+ * are described at open_mac_map() and open_src_map().  The records of an
+ * expansion are kept in map_buf[] or map_steps[] until the expansion
+ * succeeds, and the spans of the output are written when the line is put
+ * out.
+ */
+#define MAP_FNAME       1           /* Record of a file name        */
+#define MAP_MACRO       2           /* Record of a macro definition */
+#define MAP_CALL        3           /* Record of a macro call       */
+#define MAP_OUT         4           /* Record of an output span     */
+#define MAP_CHAIN       5           /* Record of calls of expansion */
+#define MAP_LINE        6           /* Record of an output line     */
+#define MAP_INDEX       7           /* Record of index of the map   */
+#define MAP_BLOCK       256         /* Number of MAP_LINEs in block */
+typedef struct map_id {             /* File name or macro in the map*/
+    const void *    key;    /* The name or DEFBUF (key by address)  */
+    const char *    fname;          /* File of the macro definition */
+    long            mline;          /* Line of the macro definition */
+    long            id;             /* Its number in the map        */
+} MAP_ID;
+typedef struct map_table {          /* Ids open-addressed by 'key'  */
+    MAP_ID *        ids;
+    size_t          size;           /* Number of slots, power of 2  */
+    size_t          num;            /* Number of used slots         */
+    long            last_id;        /* Number of ids given          */
+    long *          offsets;        /* Offsets of records by id     */
+} MAP_TABLE;
+typedef struct map_file {           /* Macro map or source map      */
+    FILE *          fp;
+    long            offset;         /* Bytes written to the file    */
+    MAP_TABLE       fnames;         /* File names in the map        */
+    MAP_TABLE       macros;         /* Macro definitions in the map */
+} MAP_FILE;
+typedef struct map_span {           /* Output span of a macro call  */
+    long            call;           /* Number of the call record    */
+    size_t          start;          /* Start column in output[]     */
+    size_t          end;            /* End column in output[]       */
+} MAP_SPAN;
+typedef struct map_seg {            /* Segment of an output line    */
+    size_t          col;            /* Start column in output[]     */
+    long            fid;            /* File id of the source        */
+    long            line;           /* Line in the source           */
+    long            scol;           /* Column in the source         */
+    long            chain;  /* MAP_CHAIN id, 0 for text of the source   */
+} MAP_SEG;
+typedef struct map_step {           /* A macro call in an expansion */
+    int             depth;          /* Nesting level of the call    */
+    const DEFBUF *  defp;           /* The macro                    */
+} MAP_STEP;
+typedef struct map_chain {          /* MAP_CHAIN registered to map  */
+    size_t          hash;           /* Hash of the calls            */
+    size_t          start;          /* The calls in map_store[]     */
+    size_t          len;            /* Length of the calls          */
+    long            id;             /* Its number, 0 for empty slot */
+} MAP_CHAIN_ID;
+static MAP_FILE mac_map;            /* Macro map of -Y option       */
+static MAP_FILE src_map;            /* Source map of -L option      */
+static int      map_macro;          /* Record macro calls to a map  */
+static int      map_args;           /* Locate the arguments for -Y  */
+static int      map_depth;          /* Nesting level of a macro call*/
+static long     map_calls;          /* Number of call records       */
+static long     map_last = -1L;     /* Top-level call just expanded */
+static long     map_out_call;       /* Call of the last MAP_OUT     */
+static long     map_out_end;        /* End offset of the last MAP_OUT   */
+static char *   map_buf;            /* Call records of an expansion */
+static size_t   map_len;            /* Length of records in map_buf */
+static size_t   map_size;           /* Allocated size of map_buf    */
+static LOCATION map_locs[ NMACPARS + 2];    /* Location of arguments*/
+static int      map_nargs;          /* Number of located arguments  */
+static MAP_SPAN *   map_spans;      /* Spans on the current line    */
+static int      map_num_spans;      /* Number of spans on the line  */
+static int      map_max_spans;      /* Allocated elements of spans  */
+static MAP_STEP *   map_steps;      /* Calls of an expansion for -L */
+static int      map_num_steps;      /* Number of calls in map_steps */
+static int      map_max_steps;      /* Allocated elements of steps  */
+static long     map_chain_last;     /* MAP_CHAIN just expanded      */
+static MAP_CHAIN_ID *   map_chains; /* Open-addressed by the hash   */
+static size_t   map_chains_size;    /* Number of slots, power of 2  */
+static long     map_num_chains;     /* Number of MAP_CHAIN records  */
+static long *   map_chain_offsets;  /* Offsets of MAP_CHAIN records */
+static char *   map_store;          /* Calls of the MAP_CHAINs      */
+static size_t   map_store_len;      /* Length of calls in map_store */
+static size_t   map_store_size;     /* Allocated size of map_store  */
+static MAP_SEG *    map_segs;       /* Segments of the current line */
+static int      map_num_segs;       /* Number of segments on line   */
+static int      map_max_segs;       /* Allocated elements of segs   */
+static MAP_SEG  map_tok;            /* Location of the last token   */
+static const char * map_tok_name;   /* File name of the last token  */
+static long     map_lines;          /* Number of MAP_LINE records   */
+static long     map_prev_line;      /* Values of the last MAP_LINE  */
+static long     map_prev_fid;       /*   from which the numbers are */
+static long     map_prev_sline;     /*   delta-encoded              */
+static long *   map_blocks;         /* Output line and offset of each   */
+static long     map_num_blocks;     /*   block of MAP_BLOCK MAP_LINEs   */
+
+static void     map_call( const DEFBUF * defp, LINE_COL line_col, int nargs);
+                /* Record a macro call to the maps  */
+static long     map_fname( MAP_FILE * mf, const char * name);
+                /* Register a file name to the map  */
+static long     map_defbuf( MAP_FILE * mf, const DEFBUF * defp);
+                /* Register a macro to the map      */
+static MAP_ID * map_slot( MAP_TABLE * tp, const void * key);
+                /* Look up the slot of a key        */
+static long     map_chain( void);
+                /* Register calls of an expansion   */
+static void     map_seg( void);
+                /* Append a segment of output line  */
+static void     map_line( size_t len);
+                /* Write segments of an output line */
+static long *   map_offset( long * offsets, long id, long offset);
+                /* Remember the offset of a record  */
+static void     map_free( MAP_FILE * mf);
+                /* Close a map and free its tables  */
+static void     map_num( unsigned long num, MAP_FILE * mf);
+                /* Write a number to the map        */
+static void     map_write( const char * bytes, size_t len, MAP_FILE * mf);
+                /* Write bytes to the map           */
+
+/*
+ * The macro profile of '#pragma MCPP debug profile' or -y option counts the
+ * expansions of each macro definition in STD mode.  Each call of replace()
+ * is logged into prof_calls[] with the bytes it produced, the bytes of the
+ * arguments it collected, the time spent in it and the nesting level of the
+ * calls in it, and the log is added to the counters of the macros when the
+ * expansion succeeds, as the records of the maps are written.  The time of
+ * a call nested in another call of the same macro is not added twice.
+ */
+typedef struct mac_prof {           /* Counters of a macro definition   */
+    struct mac_prof *   next;       /* Next in the list of counters */
+    const char *    fname;          /* File of the macro definition */
+    long            mline;          /* Line of the macro definition */
+    long            calls;          /* Number of the calls          */
+    long            out_bytes;      /* Bytes of the expansions      */
+    long            arg_bytes;      /* Bytes of the arguments       */
+    clock_t         time;           /* Time spent in replace()      */
+    int             depth;          /* Deepest nesting in the calls */
+    int             active;         /* Calls being in replace()     */
+    char            name[ 1];       /* Name of the macro            */
+} MAC_PROF;
+typedef struct prof_call {          /* A call of replace()          */
+    MAC_PROF *      prof;           /* The macro, NULL if abandoned */
+    int             parent;         /* Index of the outer call or -1*/
+    int             depth;          /* Nesting level of the call    */
+    int             max_depth;      /* Deepest level of nested calls*/
+    long            out_bytes;      /* Bytes of the expansion       */
+    long            arg_bytes;      /* Bytes of the arguments       */
+    clock_t         time;           /* clock() at entry, then time  */
+} PROF_CALL;
+static int      prof_macro;         /* Profile the macro expansion  */
+static FILE *   fp_prof;            /* Report of -y option          */
+static int      prof_json;          /* Report in JSON, else in CSV  */
+static MAC_PROF *   prof_list;      /* Counters of the macros       */
+static long     prof_num;           /* Number of the counters       */
+static PROF_CALL *  prof_calls;     /* Calls of an expansion        */
+static int      prof_num_calls;     /* Number of logged calls       */
+static int      prof_max_calls;     /* Allocated elements of calls  */
+static int      prof_cur = -1;      /* Innermost call in replace()  */
+
+static int      prof_enter( DEFBUF * defp);
+                /* Log a call of replace()          */
+static void     prof_exit( int n, long out_bytes);
+                /* Close a logged call              */
+static void     prof_done( int commit);
+                /* Add the log to the counters      */
+static MAC_PROF *   prof_of( DEFBUF * defp);
+                /* Counters of a macro definition   */
+static int      prof_cmp( const void * a, const void * b);
+                /* Compare counters by the time     */
+static char *   prof_str( char * out, const char * str);
+                /* Quote a string for the report    */
+static void     prof_put( const char * str);
+                /* Write to the report              */
+
 static int      print_macro_inf( int c, char ** cpp, char ** opp);
                 /* Embed macro infs into comments   */
 static char *   print_macro_arg( char *out, MACRO_INF * m_inf, int argn
@@ -237,10 +566,13 @@ static char *   print_macro_arg( char *out, MACRO_INF * m_inf, int argn
                 /* Embed macro arg inf into comments*/
 static char *   chk_magic_balance( char * buf, char * buf_end, int move
         , int diag);    /* Check imbalance of magics        */
-static char *   replace( DEFBUF * defp, char * out, char * out_end
-        , const DEFBUF * outer, FILEINFO * rt_file, LINE_COL line_col
-        , int in_src_n);
-                /* Replace a macro recursively      */
+static char *   run_frames( DEFBUF * defp, char * out, char * out_end
+        , LINE_COL line_col);
+                /* Replace a macro by the frames    */
+static EXP_FRAME *  push_frame( int kind);
+                /* Push a frame of the expansion    */
+static int      replace( EXP_FRAME * fp);
+                /* Replace a possibly nested macro  */
 static char *   close_macro_inf( char *  out_p, int m_num, int in_src_n);
                 /* Put closing mark for a macro call*/
 static DEFBUF * def_special( DEFBUF * defp);
@@ -249,7 +581,8 @@ static int      prescan( const DEFBUF * defp, const char ** arglist
         , char * out, char * out_end);
                 /* Process #, ## operator           */
 static char *   catenate( const DEFBUF * defp, const char ** arglist
-        , char * out, char * out_end, char ** token_p);
+        , char * out, char * out_end, char ** token_p
+        , const REPL_TOK ** tok_p);
                 /* Catenate tokens                  */
 static const char * remove_magics( const char * argp, int from_last);
                 /* Remove pair of magic characters  */
@@ -259,12 +592,14 @@ static void     chk_symmetry( char *  start_id, char *  end_id, size_t  len);
 #endif
 static char *   stringize( const DEFBUF * defp, const char * argp, char * out);
                 /* Stringize an argument            */
-static char *   substitute( const DEFBUF * defp, const char ** arglist
-        , const char * in, char * out, char * out_end);
+static int      substitute( EXP_FRAME * fp);
                 /* Substitute parms with arguments  */
-static char *   rescan( const DEFBUF * outer, const char * in, char * out
-        , char * out_end);
+static int      rescan( EXP_FRAME * fp);
                 /* Rescan once replaced sequences   */
+static size_t   text_pos( void);
+                /* Position in the text read        */
+static void     shift_pos( long len);
+                /* Shift the positions remembered   */
 static int      disable_repl( const DEFBUF * defp);
                 /* Disable the macro once replaced  */
 static void     enable_repl( const DEFBUF * defp, int done);
@@ -273,6 +608,10 @@ static int      is_able_repl( const DEFBUF * defp);
                 /* Is the macro allowed to replace? */
 static char *   insert_to_bptr( char * ins, size_t len);
                 /* Insert a sequence into infile->bptr  */
+static void     reset_bptr( const char * text);
+                /* Rewrite the rest of the text     */
+static int      has_func_name( const char * out, const char * out_end);
+                /* Name of function-like macro in the expansion?    */
 
 static char *   expand_std(
     DEFBUF *    defp,                       /* Macro definition     */
@@ -286,18 +625,53 @@ static char *   expand_std(
  * and return the advanced output pointer.
  */
 {
-    char    macrobuf[ NMACWORK + IDMAX];    /* Buffer for replace() */
+    char *  macrobuf;                       /* Buffer for replace() */
     char *  out_p = out;
     size_t  len;
     int     c, c1;
     char *  cp;
+    EXP_CACHE *     cache = NULL;   /* Cache entry for the macro    */
+    const FILEINFO *    file = infile;
+    const char *    bptr = infile->bptr;
+    long    gen = macro_gen;
+    long    diags = diag_count;
+    int     sep = insert_sep;
+    int     state = in_directive | (in_include << 1) | (insert_sep << 2);
+    long    call = map_calls;       /* Number of the first call record  */
 
     has_pragma = FALSE;                     /* Have to re-initialize*/
     macro_line = src_line;                  /* Line number for diag */
     macro_name = defp->name;
     rescan_level = 0;
+    scr_release( NULL);             /* Clear the arena left by error*/
     trace_macro = (mcpp_mode == STD) && (mcpp_debug & MACRO_CALL)
             && ! in_directive;
+    map_macro = (mcpp_mode == STD) && (fp_mac_map || fp_src_map)
+            && ! in_directive;
+    map_args = map_macro && fp_mac_map;
+    map_last = -1L;
+    prof_macro = (mcpp_mode == STD) && (mcpp_debug & PROFILE);
+    map_chain_last = 0L;
+    if (defp->nargs <= DEF_NOARGS && defp->nargs >= DEF_NOARGS_STANDARD
+            && ! (mcpp_debug & (EXPAND | MACRO_CALL)) && ! map_macro
+            && ! prof_macro) {
+        /* Object-like macro other than __LINE__, __FILE__  */
+        /* Not cached while the calls are recorded to the maps or the   */
+        /* profile, since a cached expansion hides the nested calls.    */
+        cache = &exp_cache[ ((size_t) defp / sizeof (DEFBUF *))
+                & (EXP_CACHE_SIZE - 1)];
+        if (cache->defp == defp && cache->gen == gen
+                && cache->state == state
+                && cache->len < (size_t) (out_end - out)) {
+            exp_cache_hits++;
+            memcpy( out, cache->text, cache->len);
+            out_p = out + cache->len;
+            macro_line = 0;
+            goto  exp_end;
+        }
+        exp_cache_misses++;
+        exp_special = FALSE;
+    }
     if (trace_macro) {
         max_mac_num = INIT_MAC_INF;
         mac_inf = (MACRO_INF *) xmalloc( sizeof (MACRO_INF) * max_mac_num);
@@ -307,15 +681,77 @@ static char *   expand_std(
         memset( in_src, 0, sizeof (LOCATION) * max_in_src_num);
         mac_num = in_src_num = 0;           /* Initialize           */
     }
-    if (replace( defp, macrobuf, macrobuf + NMACWORK, NULL, infile, line_col
-            , 0) == NULL) {                 /* Illegal macro call   */
-        skip_macro();
+    /* The names of macros in #if put out by replace() in the macro    */
+    /* notification mode are not to be put out twice.  The texts       */
+    /* stacked by push_text() cannot be restored by 'bptr'.             */
+    exp_retry = ! ((mcpp_debug & MACRO_CALL) && in_if)
+            && infile->num_segs < 0;
+    exp_file = infile;
+    exp_serial = infile->serial;
+    exp_line = src_line;
+    exp_diags = diag_count;
+    mark_src( exp_retry && infile->src);    /* To read the lines again  */
+
+    while (1) {
+        exp_overflow = exp_altered = FALSE;
+        map_depth = 0;
+        map_len = 0;                    /* Records of the last try  */
+        map_num_steps = 0;
+        map_calls = call;
+        if (mac_work >= NMACWORK_MAX)
+            exp_retry = FALSE;
+        macrobuf = scr_alloc( mac_work + IDMAX);
+        if (run_frames( defp, macrobuf, macrobuf + mac_work, line_col)
+                != NULL)
+            break;
+        if (exp_overflow && retry_exp()) {
+            /* Do it over again from the macro name with larger buffers */
+            while (infile != file) {        /* Clear the "file"s    */
+                FILEINFO *  parent = infile->parent;
+                free_file( infile);
+                infile = parent;
+            }
+            rewind_src( TRUE);      /* Back to the line of macro name   */
+            infile->bptr = (char *) bptr;
+            insert_sep = sep;
+            rescan_level = 0;
+            has_pragma = exp_special = FALSE;
+            clear_exp_mac();
+            if (trace_macro) {          /* Discard the macro informations   */
+                int     num;
+                for (num = 1; num <= mac_num; num++) {
+                    if (mac_inf[ num].num_args >= 0) {
+                        free( mac_inf[ num].args);
+                        free( mac_inf[ num].loc_args);
+                    }
+                }
+                memset( mac_inf, 0, sizeof (MACRO_INF) * max_mac_num);
+                memset( in_src, 0, sizeof (LOCATION) * max_in_src_num);
+                mac_num = in_src_num = 0;
+            }
+            if (prof_macro)
+                prof_done( FALSE);      /* Discard the calls logged */
+            recycle_files();
+            scr_free();                 /* To be re-allocated larger*/
+            mac_work *= 2;
+            if (mcpp_debug & EXPAND)
+                mcpp_fprintf( DBG, "expand_std: work buffers enlarged to %lu\n"
+                        , (unsigned long) mac_work);
+            continue;
+        }
+        if (exp_overflow)                   /* Not yet diagnosed    */
+            cerror( macbuf_overflow, macro_name, 0L, defp->name);
+        skip_macro();                       /* Illegal macro call   */
         macro_line = MACRO_ERROR;
         goto  exp_end;
     }
-    len = (size_t) (out_end - out);
-    if (strlen( macrobuf) > len) {
+    len = strlen( macrobuf);
+    if (len >= (size_t) (out_end - out)
+            && (cp = grow_output( out, len, &out_end)) != NULL)
+        out_p = out = cp;                   /* Output buffer moved  */
+    if (len > (size_t) (out_end - out)) {
         cerror( macbuf_overflow, macro_name, 0, macrobuf);
+        len = (size_t) (out_end - out);
         memcpy( out, macrobuf, len);
         out_p = out + len;
         macro_line = MACRO_ERROR;
@@ -369,12 +805,47 @@ static char *   expand_std(
     }
 
     macro_line = 0;
+    if (cache && ! exp_special && ! has_pragma && gen == macro_gen
+            && diags == diag_count && file == infile && bptr == infile->bptr
+            && insert_sep == (state >> 2)
+            && ! has_func_name( out, out_p)) {
+        /* The expansion does not depend on the context: cache it   */
+        len = (size_t) (out_p - out);
+        if (cache->size <= len) {
+            cache->size = len + 1;
+            cache->text = xrealloc( cache->text, cache->size);
+        }
+        memcpy( cache->text, out, len);
+        cache->len = len;
+        cache->defp = defp;
+        cache->gen = gen;
+        cache->state = state;
+    }
 exp_end:
     *out_p = EOS;
+    mark_src( FALSE);
+    if (map_macro) {
+        if (macro_line == MACRO_ERROR) {    /* Discard the records  */
+            map_calls = call;
+        } else {
+            if (fp_mac_map) {
+                map_write( map_buf, map_len, &mac_map);
+                map_last = call;
+            }
+            map_len = 0;
+            if (fp_src_map && map_num_steps)
+                map_chain_last = map_chain();
+        }
+        map_len = 0;
+        map_num_steps = 0;
+    }
+    if (prof_macro)
+        prof_done( macro_line != MACRO_ERROR);
     if (mcpp_debug & EXPAND)
         dump_string( "expand_std exit", out);
     macro_name = NULL;
     clear_exp_mac();        /* Clear the information for diagnostic */
+    recycle_files();        /* The "file"s of the expansion are done*/
     if (trace_macro) {                  /* Clear macro informations */
         int     num;
         for (num = 1; num < mac_num; num++) {   /* 'num' start at 1 */
@@ -640,33 +1111,113 @@ static char *   chk_magic_balance(
     return  buf;
 }
 
-static char *   replace(
+static char *   run_frames(
     DEFBUF *    defp,                       /* Macro to be replaced */
     char *      out,                        /* Output Buffer        */
     char *      out_end,                    /* End of output buffer */
-    const DEFBUF *    outer,                /* Outer macro replacing*/
-    FILEINFO *  rt_file,                    /* Repl-text "file"     */
-    LINE_COL    line_col,                   /* Location of macro    */
-    int         in_src_n                    /* Index into in_src[]  */
+    LINE_COL    line_col                    /* Location of macro    */
 )
 /*
- * Replace a possibly nested macro recursively.
- * replace() and rescan() call each other recursively.
+ * Replace a macro call completely by the frames of replace(), substitute()
+ * and rescan().
  * Return the advanced output pointer or NULL on error.
  */
 {
-    char ** arglist = NULL;                 /* Pointers to arguments*/
-    int     nargs;                  /* Number of arguments expected */
+    EXP_FRAME * fp;
+    int     done;
+
+    while ((fp = exp_top) != NULL) {        /* Left by an error     */
+        exp_top = fp->prev;
+        fp->prev = exp_frames;
+        exp_frames = fp;
+    }
+    fp = push_frame( EXP_REPLACE);
+    fp->defp = defp;
+    fp->out = out;
+    fp->out_end = out_end;
+    fp->outer = NULL;
+    fp->rt_serial = infile->serial;
+    fp->line_col = line_col;
+    fp->in_src_n = 0;
+
+    while ((fp = exp_top) != NULL) {
+        switch (fp->kind) {
+        case EXP_REPLACE:
+            done = replace( fp);
+            break;
+        case EXP_SUBST:
+            done = substitute( fp);
+            break;
+        default:
+            done = rescan( fp);
+            break;
+        }
+        if (done == EXP_DONE) {             /* Pop the frame        */
+            exp_top = fp->prev;
+            fp->prev = exp_frames;
+            exp_frames = fp;
+        }
+    }
+    return  exp_result;
+}
+
+static EXP_FRAME *  push_frame(
+    int     kind                    /* EXP_REPLACE, EXP_SUBST, EXP_RESCAN   */
+)
+/*
+ * Push a frame taken from the pool, which never moves the other frames.
+ * The caller should set the arguments of the routine to the frame.
+ */
+{
+    EXP_FRAME * fp;
+
+    if ((fp = exp_frames) != NULL)
+        exp_frames = fp->prev;
+    else
+        fp = (EXP_FRAME *) xmalloc( sizeof (EXP_FRAME));
+    fp->prev = exp_top;
+    exp_top = fp;
+    fp->kind = kind;
+    fp->state = 0;
+    return  fp;
+}
+
+static int  replace(
+    EXP_FRAME * fp                          /* Frame of the call    */
+)
+/*
+ * Replace a possibly nested macro 'fp->defp', called by 'fp->outer', writing
+ * the result to 'fp->out'.
+ * The arguments are substituted and the result is rescanned in the frames
+ * pushed by this routine, which is called again with the result of each.
+ * Return EXP_CALL if a frame is pushed, else set the advanced output pointer
+ * or NULL on error to 'exp_result' and return EXP_DONE.
+ */
+{
+    DEFBUF *    defp = fp->defp;            /* Macro to be replaced */
+    EXP_FRAME * sub;                        /* Frame pushed         */
     char *  catbuf;                         /* Buffer for prescan() */
-    char *  expbuf;                 /* Buffer for  substitute()     */
+    size_t  len;
     char *  out_p;                          /* Output pointer       */
-    char *  cur_out = out;          /* One more output pointer      */
+    char *  cur_out;                /* One more output pointer      */
     int     num_args;
         /* Number of actual arguments (maybe less than expected)    */
-    int     enable_trace_macro;     /* To exclude _Pragma() pseudo macro    */
-    int     m_num = 0;              /* 'mac_num' of current macro   */
     MACRO_INF *     m_inf;          /* Pointer into mac_inf[]       */
+    LINE_COL    line_col = fp->line_col;    /* Location of the call */
+
+    switch (fp->state) {            /* Resume after the nested frame*/
+    case 1:
+        goto  substituted;
+    case 2:
+        goto  rescanned;
+    }
 
+    fp->arglist = NULL;
+    fp->work = NULL;
+    fp->m_num = 0;
+    fp->mapped = map_macro && defp->nargs != DEF_PRAGMA;
+    fp->prof_n = prof_macro ? prof_enter( defp) : -1;
+    cur_out = fp->out;
     if (mcpp_debug & EXPAND) {
         dump_a_def( "replace entry", defp, FALSE, TRUE, fp_debug);
         dump_unget( "replace entry");
@@ -674,15 +1225,16 @@ static char *   replace(
     if ((mcpp_debug & MACRO_CALL) && in_if)
         mcpp_fprintf( OUT, "/*%s*/", defp->name);
 
-    enable_trace_macro = trace_macro && defp->nargs != DEF_PRAGMA;
-    if (enable_trace_macro) {
+    fp->trace = trace_macro && defp->nargs != DEF_PRAGMA;
+    if (fp->trace) {
         int     num;
         int     recurs;
 
         if (mac_num >= MAX_MAC_INF - 1) {
             cerror( "Too many nested macros in tracing %s"  /* _E_  */
                     , defp->name, 0L, NULL);
-            return  NULL;
+            exp_result = NULL;
+            return  EXP_DONE;
         } else if (mac_num >= max_mac_num - 1) {
             size_t  len = sizeof (MACRO_INF) * max_mac_num;
             /* Enlarge the array    */
@@ -691,16 +1243,16 @@ static char *   replace(
                                         /* Clear the latter half    */
             max_mac_num *= 2;
         }
-        m_num = ++mac_num;                  /* Remember this number */
+        fp->m_num = ++mac_num;              /* Remember this number */
                                     /* Note 'mac_num' starts at 1   */
         *cur_out++ = MAC_INF;               /* Embed a magic char   */
         *cur_out++ = MAC_CALL_START;        /* A macro call         */
         /* Its index number, can be greater than UCHARMAX           */
         /* We represent the number by 2 bytes where each byte is not '\0'   */
-        *cur_out++ = (m_num / UCHARMAX) + 1;
-        *cur_out++ = (m_num % UCHARMAX) + 1;
+        *cur_out++ = (fp->m_num / UCHARMAX) + 1;
+        *cur_out++ = (fp->m_num % UCHARMAX) + 1;
         *cur_out = EOS;
-        m_inf = & mac_inf[ m_num];
+        m_inf = & mac_inf[ fp->m_num];
         m_inf->defp = defp;                 /* The macro definition */
         m_inf->num_args = 0;                /* Default num of args  */
         if (line_col.line) {
@@ -712,16 +1264,20 @@ static char *   replace(
         }
         m_inf->args = NULL;
         m_inf->loc_args = NULL;       /* Default args */
-        for (num = 1, recurs = 0; num < m_num; num++)
+        for (num = 1, recurs = 0; num < fp->m_num; num++)
             if (mac_inf[ num].defp == defp)
                 recurs++;           /* Recursively nested macro     */
         m_inf->recur = recurs;
     }
+    fp->out_p = cur_out;
 
-    nargs = (defp->nargs == DEF_PRAGMA) ? 1 : (defp->nargs & ~AVA_ARGS);
+    fp->nargs = (defp->nargs == DEF_PRAGMA) ? 1 : (defp->nargs & ~AVA_ARGS);
 
-    if (nargs < DEF_NOARGS_DYNAMIC) {       /* __FILE__, __LINE__   */
+    if (fp->nargs < DEF_NOARGS_DYNAMIC) {   /* __FILE__, __LINE__   */
+        if (fp->mapped)
+            map_call( defp, fp->line_col, 0);
         defp = def_special( defp);      /* These are redefined dynamically  */
+        exp_special = TRUE;             /* Not to cache the expansion   */
         if (mcpp_mode == STD) {
         /* Wrap repl-text with token separators to prevent token merging    */
             *cur_out++ = TOK_SEP;     
@@ -731,112 +1287,144 @@ static char *   replace(
         } else {
             cur_out = stpcpy( cur_out, defp->repl);
         }
-        if (enable_trace_macro) {
-            m_inf->defp = defp;             /* Redefined dynamically*/
-            cur_out = close_macro_inf( cur_out, m_num, in_src_n);
+        if (fp->trace) {
+            mac_inf[ fp->m_num].defp = defp;    /* Redefined dynamically*/
+            cur_out = close_macro_inf( cur_out, fp->m_num, fp->in_src_n);
         }
-        return  cur_out;
-    } else if (nargs == DEF_NOARGS_PREDEF_OLD && standard
+        if (fp->prof_n >= 0)
+            prof_exit( fp->prof_n, (long) (cur_out - fp->out));
+        exp_result = cur_out;
+        return  EXP_DONE;
+    } else if (fp->nargs == DEF_NOARGS_PREDEF_OLD && standard
             && (warn_level & 1)) {          /* Some macros on GCC   */
         cwarn( "Old style predefined macro \"%s\" is used", /* _W2_ */
                 defp->name, 0L, NULL);
-    } else if (nargs >= 0) {                /* Function-like macro  */
+    } else if (fp->nargs >= 0) {            /* Function-like macro  */
         squeeze_ws( NULL, NULL, NULL);      /* Skip to '('          */
             /* Magic sequences are already read over by is_macro_call() */
-        arglist = (char **) xmalloc( (nargs + 1) * sizeof (char *));
-        arglist[ 0] = xmalloc( (size_t) (NMACWORK + IDMAX * 2));
-                            /* Note: arglist[ n] may be reallocated */
-                            /*   and re-written by collect_args()   */
-        if ((num_args = collect_args( defp, arglist, m_num)) == ARG_ERROR) {
-            free( arglist[ 0]);             /* Syntax error         */
-            free( arglist);
-            return  NULL;
+        fp->work = scr_alloc( (fp->nargs + 1) * sizeof (char *));
+        fp->arglist = (char **) fp->work;
+        fp->arglist[ 0] = scr_alloc( mac_work + IDMAX * 2);
+                            /* Note: arglist[ n] may be shrunk and  */
+                            /*   re-written by collect_args()       */
+        if ((num_args = collect_args( defp, fp->arglist, fp->m_num))
+                == ARG_ERROR) {
+            scr_release( fp->work);         /* Syntax error         */
+            exp_result = NULL;
+            return  EXP_DONE;
         }
-        if (enable_trace_macro) {
+        if (fp->trace) {
             /* Save the arglist for later informations  */
-            m_inf->args = arglist[ 0];
+            m_inf = & mac_inf[ fp->m_num];
+            len = (size_t) (scr_ptr - fp->arglist[ 0]);
+            m_inf->args = (char *) memcpy( xmalloc( len), fp->arglist[ 0]
+                    , len);
             m_inf->num_args = num_args;     /* Number of actual args*/
         }
-        if (mcpp_mode == STD && outer && rt_file != infile) {
+        if (fp->prof_n >= 0)
+            prof_calls[ fp->prof_n].arg_bytes
+                    = (long) (scr_ptr - fp->arglist[ 0]);
+        if (mcpp_mode == STD && fp->outer && ! in_text( fp->rt_serial)) {
                                  /* Has read over replacement-text  */
             if (compat_mode) {
-                enable_repl( outer, FALSE); /* Enable re-expansion  */
+                enable_repl( fp->outer, FALSE); /* Enable re-expansion  */
                 if (mcpp_debug & EXPAND)
-                    dump_string( "enabled re-expansion"
-                            , outer ? outer->name : "<arg>");
+                    dump_string( "enabled re-expansion", fp->outer->name);
             } else {
                 replacing[ rescan_level-1].read_over = READ_OVER;
             }
         }
     }
 
-    catbuf = xmalloc( (size_t) (NMACWORK + IDMAX));
+    if (fp->mapped) {
+        map_call( defp, fp->line_col, fp->nargs >= 0 ? map_nargs : 0);
+        map_depth++;                    /* For the nested calls     */
+    }
+
+    catbuf = scr_alloc( mac_work + IDMAX);
+    if (fp->work == NULL)
+        fp->work = catbuf;
     if (mcpp_debug & EXPAND) {
         mcpp_fprintf( DBG, "(%s)", defp->name);
         dump_string( "prescan entry", defp->repl);
     }
-    if (prescan( defp, (const char **) arglist, catbuf, catbuf + NMACWORK)
-            == FALSE) {             /* Process #, ## operators      */
-        diag_macro( CERROR, macbuf_overflow, defp->name, 0L, catbuf, defp
-                , NULL);
-        if (nargs >= 0) {
-            if (! enable_trace_macro)
-                /* arglist[0] is needed for macro infs  */
-                free( arglist[ 0]);
-            free( arglist);
-        }
-        free( catbuf);
-        return  NULL;
+    if (prescan( defp, (const char **) fp->arglist, catbuf
+            , catbuf + mac_work) == FALSE) {    /* Process #, ## operators  */
+        if (! retry_exp())
+            diag_macro( CERROR, macbuf_overflow, defp->name, 0L, catbuf, defp
+                    , NULL);
+        scr_release( fp->work);
+        if (fp->mapped)
+            map_depth--;
+        exp_result = NULL;
+        return  EXP_DONE;
     }
-    catbuf = xrealloc( catbuf, strlen( catbuf) + 1);
-                                            /* Use memory sparingly */
+    scr_trim( catbuf, strlen( catbuf) + 1); /* Use memory sparingly */
     if (mcpp_debug & EXPAND) {
         mcpp_fprintf( DBG, "(%s)", defp->name);
         dump_string( "prescan exit", catbuf);
     }
 
-    if (nargs > 0) {    /* Function-like macro with any argument    */
-        expbuf = xmalloc( (size_t) (NMACWORK + IDMAX));
+    if (fp->nargs > 0) {    /* Function-like macro with any argument    */
+        /* Substitute in place in the output, which rescan() overwrites */
+        /* only after stacking the result as its input.                 */
         if (mcpp_debug & EXPAND) {
             mcpp_fprintf( DBG, "(%s)", defp->name);
             dump_string( "substitute entry", catbuf);
         }
-        out_p = substitute( defp, (const char **) arglist, catbuf, expbuf
-                , expbuf + NMACWORK);   /* Expand each arguments    */
-        if (! enable_trace_macro)
-            free( arglist[ 0]);
-        free( arglist);
-        free( catbuf);
-        expbuf = xrealloc( expbuf, strlen( expbuf) + 1);
+        sub = push_frame( EXP_SUBST);       /* Expand each arguments    */
+        sub->defp = defp;
+        sub->arglist = fp->arglist;
+        sub->in = catbuf;
+        sub->out = fp->out_p;
+        sub->out_end = fp->out_end;
+        fp->state = 1;
+        return  EXP_CALL;
+    } else {                                /* Object-like macro or */
+                            /* function-like macro with no argument */
+        exp_result = fp->expbuf = catbuf;
+    }
+
+substituted:
+    if (fp->nargs > 0) {
+        /* Move the result down over the arguments no longer needed */
+        len = strlen( fp->out_p) + 1;
+        scr_release( fp->work);
+        fp->expbuf = (char *) memcpy( scr_alloc( len), fp->out_p, len);
                                             /* Use memory sparingly */
         if (mcpp_debug & EXPAND) {
             mcpp_fprintf( DBG, "(%s)", defp->name);
-            dump_string( "substitute exit", expbuf);
+            dump_string( "substitute exit", fp->expbuf);
         }
-    } else {                                /* Object-like macro or */
-        if (nargs == 0 && ! enable_trace_macro)
-                            /* Function-like macro with no argument */
-            free( arglist[ 0]);
-        free( arglist);
-        out_p = expbuf = catbuf;
+    }
+    if (exp_result) {
+        sub = push_frame( EXP_RESCAN);
+        sub->outer = defp;
+        sub->in = fp->expbuf;
+        sub->out = fp->out_p;
+        sub->out_end = fp->out_end;
+        fp->state = 2;
+        return  EXP_CALL;
     }
 
-    if (out_p)
-        out_p = rescan( defp, expbuf, cur_out, out_end);
+rescanned:
+    out_p = exp_result;
     if (out_p && defp->nargs == DEF_PRAGMA)
         has_pragma = TRUE;
                     /* Inform mcpp_main() that _Pragma() was found  */
-    free( expbuf);
-    if (enable_trace_macro && out_p)
-        out_p = close_macro_inf( out_p, m_num, in_src_n);
+    scr_release( fp->work);
+    if (fp->mapped)
+        map_depth--;
+    if (fp->trace && out_p)
+        out_p = close_macro_inf( out_p, fp->m_num, fp->in_src_n);
     if (mcpp_debug & EXPAND)
-        dump_string( "replace exit", out);
+        dump_string( "replace exit", fp->out);
 
     if (trace_macro && defp->nargs == DEF_PRAGMA) {
         /* Remove intervening magics if the macro is _Pragma pseudo-macro   */
         /* These magics have been inserted by macros in _Pragma()'s args    */
         int     c;
-        cur_out = out_p = out;
+        cur_out = out_p = fp->out;
         while ((c = *cur_out++) != EOS) {
             if (c == MAC_INF) {
                 if (! option_flags.v) {
@@ -869,8 +1457,11 @@ static char *   replace(
         }
         *out_p = EOS;
     }
+    if (fp->prof_n >= 0 && out_p)
+        prof_exit( fp->prof_n, (long) (out_p - fp->out));
 
-    return  out_p;
+    exp_result = out_p;
+    return  EXP_DONE;
 }
 
 static char *   close_macro_inf(
@@ -897,8 +1488,8 @@ static char *   close_macro_inf(
     *out_p = EOS;
     get_ch();                               /* Clear the garbage    */
     unget_ch();
-    if (infile->fp || in_src_n) {
-        if (infile->fp) {           /* Macro call on source file    */
+    if (infile->src || in_src_n) {
+        if (infile->src) {          /* Macro call on source file    */
             e_line_col.line = src_line;
             e_line_col.col = infile->bptr - infile->buffer;
         } else {    /* Macro in argument of parent macro and from source    */
@@ -940,7 +1531,7 @@ static DEFBUF * def_special(
         break;
     case DEF_NOARGS_DYNAMIC - 2:            /* __FILE__             */
         for (file = infile; file != NULL; file = file->parent) {
-            if (file->fp != NULL) {
+            if (file->src != NULL) {
                 sprintf( work_buf, "\"%s\"", file->filename);
                 if (str_eq( work_buf, defp->repl))
                     break;                          /* No change    */
@@ -967,10 +1558,11 @@ static int  prescan(
  * argument following # by stringize().
  */
 {
-    FILEINFO *  file;
+    long        serial = 0L;        /* Serial number of the text    */
+    const REPL_TOK *    tp;         /* Pointer into defp->toks[]    */
+    const REPL_TOK *    tok_end = defp->toks + defp->num_toks;
     char *      prev_token = NULL;  /* Preceding token              */
     char *      horiz_space = NULL; /* Horizontal white space       */
-    int         c;                  /* Value of a character         */
     /*
      * The replacement lists are --
      *          stuff1<SEP>stuff2
@@ -983,35 +1575,32 @@ static int  prescan(
      * where <QUO> is ST_QUO, possibly with following space.
      *
      * DEF_MAGIC may has been inserted sometimes.
-     * In other than POST_STD modes, TOK_SEP and IN_SRC may have been
-     * inserted, and TOK_SEPs are inserted also in this routine.
+     * In other than POST_STD modes, TOK_SEPs are inserted in this routine.
      * In trace_macro mode, many magic character sequences may have been
      * inserted here and there.
+     * The list has been divided into REPL_TOKs by install_macro(), so it
+     * is not scanned here.  Only the arguments are scanned by catenate()
+     * and stringize(), which may read on to the "file" pushed here in place
+     * of the list.
      */
 
-    if (mcpp_mode == POST_STD) {
-        file = unget_string( defp->repl, defp->name);
-    } else {
+    if (mcpp_mode == STD)
         *out++ = TOK_SEP;                   /* Wrap replacement     */
-        workp = work_buf;                   /*  text with token     */
-        workp = stpcpy( workp, defp->repl); /*   separators to      */
-        *workp++ = TOK_SEP;                 /*    prevent unintended*/
-        *workp = EOS;                       /*     token merging.   */
-        file = unget_string( work_buf, defp->name);
-    }
+    if (defp->has_ops)
+        serial = push_text( " ", defp->name);   /* Under the arguments  */
+    else if (macro_name)
+        expanding( defp->name, FALSE);      /* For diagnostics      */
 
-    while (c = get_ch(), file == infile) {  /* To the end of repl   */
+    for (tp = defp->toks; tp < tok_end; tp++) {
 
-        switch (c) {
-        case ST_QUOTE:
-            skip_ws();      /* Skip spaces and the returned MAC_PARM*/
-            c = get_ch() - 1;               /* Parameter number     */
+        switch (tp->type) {
+        case REPL_STR:
             prev_token = out;               /* Remember the token   */
-            out = stringize( defp, arglist[ c], out);
+            out = stringize( defp, arglist[ tp->parm - 1], out);
                                     /* Stringize without expansion  */
             horiz_space = NULL;
             break;
-        case CAT:
+        case REPL_CAT:
             if (*prev_token == DEF_MAGIC || *prev_token == IN_SRC) {
                 /* Rare case yet possible after catenate()  */
                 size_t  len = 1;
@@ -1035,26 +1624,27 @@ static int  prescan(
                 *--out = EOS;       /* Remove trailing white space  */
                 horiz_space = NULL;
             }
-            out = catenate( defp, arglist, out, out_end, &prev_token);
+            while (++tp < tok_end && tp->type == REPL_SPACE)
+                ;                           /* Skip to the operand  */
+            out = catenate( defp, arglist, out, out_end, &prev_token, &tp);
             if (char_type[ *(out - 1) & UCHARMAX] & HSP)
                 horiz_space = out - 1;      /* TOK_SEP has been appended    */
             break;
-        case MAC_PARM:
+        case REPL_PARM:
             prev_token = out;
             *out++ = MAC_PARM;
-            *out++ = get_ch();              /* Parameter number     */
+            *out++ = tp->parm;              /* Parameter number     */
             break;
-        case TOK_SEP:
-        case ' ':
-        case '\t'   :
+        case REPL_SPACE:
             if (out - 1 == horiz_space)
                 continue;                   /* Squeeze white spaces */
             horiz_space = out;
-            *out++ = c;
+            *out++ = defp->repl[ tp->off];
             break;
         default:
-            prev_token = out;
-            scan_token( c, &out, out_end);  /* Ordinary token       */
+            prev_token = out;               /* Ordinary token       */
+            memcpy( out, defp->repl + tp->off, tp->len);
+            out += tp->len;
             break;
         }
 
@@ -1063,8 +1653,16 @@ static int  prescan(
             return  FALSE;
     }
 
+    if (mcpp_mode == STD && out - 1 != horiz_space)
+        *out++ = TOK_SEP;                   /* Wrap replacement     */
     *out = EOS;         /* Ensure terminatation in case of no token */
-    unget_ch();
+    if (out_end <= out)
+        return  FALSE;
+    if (serial) {
+        while (get_ch(), in_text( serial))
+            ;                               /* Clear the text       */
+        unget_ch();
+    }
     return  TRUE;
 }
 
@@ -1073,7 +1671,8 @@ static char *   catenate(
     const char **   arglist,        /* Pointers to actual arguments */
     char *  out,                    /* Output buffer                */
     char *  out_end,                /* End of output buffer         */
-    char ** token_p         /* Address of preceding token pointer   */
+    char ** token_p,        /* Address of preceding token pointer   */
+    const REPL_TOK ** tok_p         /* Address of following token   */
 )
 /*
  * Concatenate the previous and the following tokens.
@@ -1081,7 +1680,9 @@ static char *   catenate(
  * other characters.
  */
 {
-    FILEINFO *      file;
+    const REPL_TOK *    tp = *tok_p;    /* Following token in repl  */
+    size_t  len;
+    long    serial;                 /* Serial number of the text    */
     char *  prev_prev_token = NULL;
     const char *    invalid_token
     = "Not a valid preprocessing token \"%s\"";     /* _E_ _W2_     */
@@ -1102,14 +1703,14 @@ static char *   catenate(
             *out = EOS;                     /* An empty argument    */
         } else {
             if (mcpp_mode == POST_STD) {
-                file = unget_string( argp, NULL);
-                while (c = get_ch(), file == infile) {
+                serial = push_text( argp, NULL);
+                while (c = get_ch(), in_text( serial)) {
                     prev_token = out;   /* Remember the last token  */
                     scan_token( c, &out, out_end);
                 }       /* Copy actual argument without expansion   */
                 unget_ch();
             } else {
-                unget_string( argp, NULL);
+                push_text( argp, NULL);
                 if (trace_macro)
                     free( (char *) argp);
                     /* malloc()ed in remove_magics()    */
@@ -1135,17 +1736,13 @@ static char *   catenate(
         }
     }   /* Else the previous token is an ordinary token, not an argument    */
 
-    c = skip_ws();
-
     /* Catenate */
-    switch (c) {
-    case ST_QUOTE:          /* First stringize and then catenate    */
-        skip_ws();                  /* Skip MAC_PARM, ST_QUOTE      */
-        c = get_ch() - 1;
-        out = stringize( defp, arglist[ c], out);
+    switch (tp->type) {
+    case REPL_STR:          /* First stringize and then catenate    */
+        out = stringize( defp, arglist[ tp->parm - 1], out);
         break;
-    case MAC_PARM:
-        c = get_ch() - 1;                   /* Parameter number     */
+    case REPL_PARM:
+        c = tp->parm - 1;                   /* Parameter number     */
         argp = arglist[ c];                 /* Actual argument      */
         if (trace_macro)
             argp = remove_magics( argp, FALSE); /* Remove pair of magics    */
@@ -1153,7 +1750,7 @@ static char *   catenate(
                 || (mcpp_mode == STD && *argp == RT_END)) {
             *out = EOS;                     /* An empty argument    */
         } else {
-            unget_string( argp, NULL);
+            push_text( argp, NULL);
             if (trace_macro)
                 free( (char *) argp);
             if ((c = get_ch()) == DEF_MAGIC) {  /* Remove DEF_MAGIC */
@@ -1170,29 +1767,29 @@ static char *   catenate(
                 in_arg = TRUE;
         }
         break;
-    case IN_SRC:
-        if (trace_macro) {
-            get_ch();
-            get_ch();
-        }
-        /* Fall through */
-    case DEF_MAGIC:
-        c = get_ch();                   /* Skip DEF_MAGIC, IN_SRC   */
-        /* Fall through */
     default:
-        scan_token( c, &out, out_end);      /* Copy the token       */
+        len = tp->len;
+        argp = defp->repl + tp->off;
+        if (*argp == DEF_MAGIC) {           /* Skip DEF_MAGIC       */
+            argp++;
+            len--;
+        }
+        memcpy( out, argp, len);            /* Copy the token       */
+        out += len;
+        *out = EOS;
         break;
     }
+    *tok_p = tp;                    /* Report back the last element */
 
     /* The generated sequence is a valid preprocessing-token ?      */
     if (*prev_token) {                      /* There is any token   */
         unget_string( prev_token, NULL);    /* Scan once more       */
         c = get_ch();  /* This line should be before the next line. */
-        infile->fp = (FILE *)-1;            /* To check token length*/
+        infile->src = (char *)-1;           /* To check token length*/
         if (mcpp_debug & EXPAND)
             dump_string( "checking generated token", infile->buffer);
         scan_token( c, (workp = work_buf, &workp), work_end);
-        infile->fp = NULL;
+        infile->src = NULL;
         if (*infile->bptr != EOS) {         /* More than a token    */
             if (option_flags.lang_asm) {    /* Assembler source     */
                 if (warn_level & 2)
@@ -1214,8 +1811,8 @@ static char *   catenate(
     }
     if (in_arg) {       /* There are more tokens after the generated one    */
         if (mcpp_mode == POST_STD) {
-            file = infile;
-            while (c = get_ch(), file == infile) {
+            serial = infile->serial;
+            while (c = get_ch(), in_text( serial)) {
                 prev_token = out;       /* Remember the last token  */
                 scan_token( c, &out, out_end);
             }           /* Copy rest of argument without expansion  */
@@ -1264,7 +1861,7 @@ static const char *     remove_magics(
     char *  space = NULL;
     int     with_rtend;
     int     c;
-    FILEINFO *  file;
+    long    serial;                 /* Serial number of the text    */
 
     mac_id = (char (*)[ MAC_S_LEN]) xmalloc( MAC_S_LEN * INIT_MAGICS);
     arg_id = (char (*)[ ARG_S_LEN]) xmalloc( ARG_S_LEN * INIT_MAGICS * 2);
@@ -1283,11 +1880,11 @@ static const char *     remove_magics(
     } else {
         with_rtend = FALSE;
     }
-    file = unget_string( arg_p, NULL);  /* Stack to "file" for token parsing*/
+    serial = push_text( arg_p, NULL);   /* Stack the text for token parsing */
 
     /* Search all the magics in argument, as well as first and last token   */
     /* Read stacked arg_p and write it to arg_p as a dummy buffer   */
-    while ((*ap++ = c = get_ch()) != RT_END && file == infile) {
+    while ((*ap++ = c = get_ch()) != RT_END && in_text( serial)) {
         if (c == MAC_INF) {
             if (mac_n >= max_magics || arg_n >= max_magics * 2) {
                 max_magics *= 2;
@@ -1360,8 +1957,8 @@ static const char *     remove_magics(
             space = ap;         /* Remember the last white space    */
         scan_token( c, &ap, ep);
     }
-    if (file == infile)
-        get_ch();                               /* Clear the "file" */
+    if (in_text( serial))
+        get_ch();                               /* Clear the text   */
     unget_ch();
     if (space == ep - 1)
         ep--;                       /* Remove trailing white space  */
@@ -1452,12 +2049,12 @@ static const char *     remove_magics(
     }
 
     /* Copy the sequences skipping the to-be-removed magic seqs */
-    file = unget_string( arg_p, NULL);  /* Stack to "file" for token parsing*/
+    serial = push_text( arg_p, NULL);   /* Stack the text for token parsing */
     tp = arg_p;
     ep = arg_p + strlen( arg_p);
     mac_n = arg_n = n = 0;
 
-    while ((*tp++ = c = get_ch()) != RT_END && file == infile) {
+    while ((*tp++ = c = get_ch()) != RT_END && in_text( serial)) {
         char ** loc_tab;
         int     num, mark, rm, magic;
         size_t  len;
@@ -1511,8 +2108,8 @@ static const char *     remove_magics(
     if (! with_rtend)
         tp--;
     *tp = EOS;
-    if (file == infile)
-        get_ch();                               /* Clear the "file" */
+    if (in_text( serial))
+        get_ch();                               /* Clear the text   */
     unget_ch();
 
     return  arg_p;
@@ -1562,7 +2159,7 @@ static char *   stringize(
 {
     char        arg_end_inf[ 8][ ARG_E_LEN_V - 1];
                         /* Verbose information of macro arguments   */
-    FILEINFO *  file;
+    long        serial;             /* Serial number of the text    */
     int         stray_bsl = FALSE;          /* '\\' not in literal  */
     char *      out_p = out;
     int         token_type;
@@ -1586,33 +2183,34 @@ static char *   stringize(
         }
     }
 
-    file = unget_string( argp, NULL);
-    len = strlen( infile->buffer);  /* Sequence ends with RT_END    */
     if (trace_macro) {          /* Remove suffixed argument closing magics  */
         /* There are 0 or more argument closing magic sequences and */
         /* 0 or more TOK_SEPs and no space at the end of argp.      */
         /* This is assured by get_an_arg().                         */
         int         nmagic = 0;
+        char *      arg = save_string( argp);
+
+        len = strlen( arg);             /* Sequence ends with RT_END    */
         while (len > arg_e_len
-            && (((*(infile->buffer + len - arg_e_len - 1) == MAC_INF
-                    && *(infile->buffer + len - arg_e_len) == MAC_ARG_END)
-                || *(infile->buffer + len - 2) == TOK_SEP))) {
-            if (*(infile->buffer + len - arg_e_len - 1) == MAC_INF
-                    && *(infile->buffer + len - arg_e_len) == MAC_ARG_END) {
+            && (((*(arg + len - arg_e_len - 1) == MAC_INF
+                    && *(arg + len - arg_e_len) == MAC_ARG_END)
+                || *(arg + len - 2) == TOK_SEP))) {
+            if (*(arg + len - arg_e_len - 1) == MAC_INF
+                    && *(arg + len - arg_e_len) == MAC_ARG_END) {
                 if (option_flags.v) {
                     memcpy( arg_end_inf[ nmagic]
-                            , infile->buffer + len - arg_e_len + 1
+                            , arg + len - arg_e_len + 1
                             , arg_e_len - 2);
                     arg_end_inf[ nmagic][ arg_e_len - 2] = EOS;
                 }
                 nmagic++;
                 len -= arg_e_len;
-                *(infile->buffer + len - 1) = RT_END;
-                *(infile->buffer + len) = EOS;
-            } else if (*(infile->buffer + len - 2) == TOK_SEP) {
+                *(arg + len - 1) = RT_END;
+                *(arg + len) = EOS;
+            } else if (*(arg + len - 2) == TOK_SEP) {
                 len--;
-                *(infile->buffer + len - 1) = RT_END;
-                *(infile->buffer + len) = EOS;
+                *(arg + len - 1) = RT_END;
+                *(arg + len) = EOS;
             }
         }
         if (nmagic != num_arg_magic) {  /* There are some imbalances    */
@@ -1623,10 +2221,14 @@ static char *   stringize(
                 out_p = out + ARG_S_LEN * num_arg_magic;
             }   /* Else simply ignore the surplus nmagic    */
         }
+        serial = push_text( arg, NULL);
+        free( arg);
+    } else {
+        serial = push_text( argp, NULL);
     }
     *out_p++ = '"';                         /* Starting quote       */
 
-    while ((c = get_ch()), ((mcpp_mode == POST_STD && file == infile)
+    while ((c = get_ch()), ((mcpp_mode == POST_STD && in_text( serial))
             || (mcpp_mode == STD && c != RT_END))) {
         if (c == ' ' || c == '\t') {
             *out_p++ = c;
@@ -1736,35 +2338,67 @@ static char *   stringize(
     return  out_p;
 }
 
-static char *   substitute(
-    const DEFBUF *  defp,           /* The macro getting arguments  */
-    const char **   arglist,    /* Pointers to actual arguments     */
-    const char *    in,                     /* Replacement text     */
-    char *      out,                        /* Output buffer        */
-    char *      out_end                     /* End of output buffer */
+static int  substitute(
+    EXP_FRAME * fp                          /* Frame of the call    */
 )
 /*
- * Replace completely each actual arguments of the macro, and substitute for
- * the formal parameters in the replacement list.
+ * Replace completely each actual arguments of the macro 'fp->defp', and
+ * substitute for the formal parameters in the replacement list 'fp->in'.
+ * An argument is expanded only at the first occurrence of the parameter and
+ * copied from the output at the others, unless the expansion issued some
+ * diagnostic or the macro informations are traced (which are numbered for
+ * each expansion).  An argument is expanded in a frame of rescan(), after
+ * which this routine is called again.
+ * Return EXP_CALL if a frame is pushed, else set the advanced output pointer
+ * or NULL on error to 'exp_result' and return EXP_DONE.
  */
 {
-    char *  out_start = out;
+    const DEFBUF *  defp = fp->defp;        /* The macro getting arguments  */
+    const char *    in = fp->in;            /* Replacement text     */
+    char *  out;                            /* Output pointer       */
+    EXP_FRAME * sub;                        /* Frame pushed         */
     const char *    arg;
+    size_t  len;
     int     c;
-    int     gvar_arg;   /* gvar_arg'th argument is GCC variable argument    */
 
-    gvar_arg = (defp->nargs & GVA_ARGS) ? (defp->nargs & ~AVA_ARGS) : 0;
-    *out = EOS;                             /* Ensure to termanate  */
+    if (fp->state == 0) {
+        fp->gvar_arg = (defp->nargs & GVA_ARGS)
+                ? (defp->nargs & ~AVA_ARGS) : 0;
+        fp->nargs = (defp->nargs == DEF_PRAGMA)
+                ? 1 : (defp->nargs & ~AVA_ARGS);
+        fp->expanded = NULL;
+        if (! trace_macro && ! (mcpp_debug & EXPAND) && fp->nargs > 0) {
+            len = sizeof (EXP_ARG) * fp->nargs;
+            fp->expanded = (EXP_ARG *) memset( scr_alloc( len), 0, len);
+        }
+        out = fp->out;
+        *out = EOS;                         /* Ensure to termanate  */
+    } else {                        /* An argument has been rescanned   */
+        out = exp_result;
+        if (fp->expanded) {
+            fp->exp->log_to = log_exp_mac( FALSE);
+            fp->exp->log_from = fp->log_from;
+        }
+        if (out == NULL) {
+            exp_result = NULL;              /* Error                */
+            return  EXP_DONE;
+        }
+        if (fp->expanded && fp->diags == diag_count) {
+            fp->exp->start = fp->out_p;
+            fp->exp->end = out;
+        }
+        goto  check_out;
+    }
 
     while ((c = *in++) != EOS) {
         if (c == MAC_PARM) {                /* Formal parameter     */
             c = *in++ & UCHARMAX;           /* Parameter number     */
             if (mcpp_debug & EXPAND) {
                 mcpp_fprintf( DBG, " (expanding arg[%d])", c);
-                dump_string( NULL, arglist[ c - 1]);
+                dump_string( NULL, fp->arglist[ c - 1]);
             }
 #if COMPILER == GNUC || COMPILER == MSC
-            arg = arglist[ c - 1];
+            arg = fp->arglist[ c - 1];
             if (trace_macro) {
                 if (*arg == MAC_INF) {
                     if (*++arg == MAC_ARG_START)
@@ -1772,7 +2406,7 @@ static char *   substitute(
                 }
             }
 #if COMPILER == GNUC
-            if (c == gvar_arg && *arg == RT_END && ! ansi) {
+            if (c == fp->gvar_arg && *arg == RT_END && ! ansi) {
                 /*
                  * GCC variadic macro and its variable argument is absent.
                  * Note that in its "strict-ansi" mode GCC does not remove 
@@ -1793,37 +2427,65 @@ static char *   substitute(
                     tmp--;
                 if (*tmp == ',') {
                     out = tmp;      /* Remove the immediately preceding ',' */
+                    if (fp->expanded)   /* Expanded args may be overwritten */
+                        memset( fp->expanded, 0, sizeof (EXP_ARG) * fp->nargs);
                     if (warn_level & 1) {
                         *out = EOS;
                         diag_macro( CWARN,
         "Removed ',' preceding the absent variable argument: %s"    /* _W1_ */
-                                , out_start, 0L, NULL, defp, NULL);
+                                , fp->out, 0L, NULL, defp, NULL);
                     }
                 }
             } else
 #endif
-            if ((out = rescan( NULL, arglist[ c - 1], out, out_end))
-                    == NULL) {              /* Replace completely   */
-                return  NULL;               /* Error                */
+            if (fp->expanded && (fp->exp = &fp->expanded[ c - 1])->start
+                    && (len = fp->exp->end - fp->exp->start)
+                        < (size_t) (fp->out_end - out)) {
+                memcpy( out, fp->exp->start, len);  /* Already expanded */
+                out += len;
+                replay_exp_mac( fp->exp->log_from, fp->exp->log_to);
+                                        /* Names for diagnostics    */
+            } else {
+                fp->in = in;
+                fp->out_p = out;            /* Start of the expansion   */
+                fp->diags = diag_count;
+                fp->log_from = fp->expanded ? log_exp_mac( TRUE) : 0;
+                sub = push_frame( EXP_RESCAN);  /* Replace completely   */
+                sub->outer = NULL;
+                sub->in = fp->arglist[ c - 1];
+                sub->out = out;
+                sub->out_end = fp->out_end;
+                fp->state = 1;
+                return  EXP_CALL;
             }
         } else {
             *out++ = c;                     /* Copy the character   */
         }
+check_out:
+        if (fp->out_end <= out) {           /* Buffer overflow      */
+            *out = EOS;
+            if (! retry_exp())
+                diag_macro( CERROR, macbuf_overflow, defp->name, 0L
+                        , fp->out, defp, NULL);
+            exp_result = NULL;
+            return  EXP_DONE;
+        }
     }
     *out = EOS;
-    return  out;
+    exp_result = out;
+    return  EXP_DONE;
 }
 
-static char *   rescan(
-    const DEFBUF *  outer,          /* Outer macro just replacing   */
-    const char *    in,             /* Sequences to be rescanned    */
-    char *  out,                            /* Output buffer        */
-    char *  out_end                         /* End of output buffer */
+static int  rescan(
+    EXP_FRAME * fp                          /* Frame of the call    */
 )
 /*
- * Re-scan the once replaced sequences to replace the remaining macros
- * completely.
- * rescan() and replace() call each other recursively.
+ * Re-scan the once replaced sequences 'fp->in' of the macro 'fp->outer' (NULL
+ * for an argument) to replace the remaining macros completely.
+ * A macro call found is replaced in a frame of replace(), after which this
+ * routine is called again.
+ * Return EXP_CALL if a frame is pushed, else set the advanced output pointer
+ * or NULL on error to 'exp_result' and return EXP_DONE.
  *
  * Note: POST_STD mode does not use IN_SRC nor TOK_SEP and seldom uses RT_END.
  * Checking of those are unnecessary overhead for POST_STD mode.  To integrate
@@ -1834,41 +2496,56 @@ static char *   rescan(
  * are complicated and not easy to understand.
  */
 {
-    char *  cur_cp = NULL;
-    char *  tp = NULL;              /* Temporary pointer into buffer*/
-    char *  out_p = out;            /* Current output pointer       */
-    FILEINFO *  file;       /* Input sequences stacked on a "file"  */
+    const DEFBUF *  outer = fp->outer;  /* Outer macro just replacing   */
+    char *  tp;                     /* Temporary pointer into buffer*/
+    char *  out_p;                  /* Current output pointer       */
+    EXP_FRAME * sub;                /* Frame pushed                 */
     DEFBUF *    inner;              /* Inner macro to replace       */
     int     c;                      /* First character of token     */
     int     token_type;
-    char *  mac_arg_start = NULL;
-#if COMPILER == GNUC
-    int     within_defined = FALSE;
-    int     within_defined_arg_depth = 0;
-#endif
+
+    if (fp->state == 1) {           /* A macro call has been replaced   */
+        tp = fp->tp;
+        inner = fp->inner;
+        c = fp->c;
+        goto  replaced;
+    }
 
     if (mcpp_debug & EXPAND) {
         mcpp_fprintf( DBG, "rescan_level--%d (%s) "
                 , rescan_level + 1, outer ? outer->name : "<arg>");
-        dump_string( "rescan entry", in);
+        dump_string( "rescan entry", fp->in);
+    }
+    if (! disable_repl( outer)) {   /* Don't re-replace replacing macro */
+        exp_result = NULL;          /* Too deeply nested macro call */
+        return  EXP_DONE;
     }
-    if (! disable_repl( outer)) /* Don't re-replace replacing macro */
-        return  NULL;               /* Too deeply nested macro call */
     if (mcpp_mode == STD) {
-        get_ch();                   /* Clear empty "file"s          */
+        get_ch();                   /* Clear empty texts            */
         unget_ch();                 /*      for diagnostic          */
-        cur_cp = infile->bptr;      /* Remember current location    */
+        fp->cur_serial = infile->serial;    /* Remember current location*/
+        fp->cur_pos = text_pos();
+    } else {
+        fp->cur_serial = 0L;
     }
-    file = unget_string( in, outer ? outer->name : NULL);
-                                    /* Stack input on a "file"      */
+    fp->serial = push_text( fp->in, outer ? outer->name : NULL);
+                                    /* Stack input on the "file"    */
+    out_p = fp->out;
+    tp = NULL;
+    inner = NULL;
+    fp->mac_arg_start = NULL;
+#if COMPILER == GNUC
+    fp->within_defined = FALSE;
+    fp->within_defined_arg_depth = 0;
+#endif
 
-    while ((c = get_ch()), file == infile
-        /* Rescanning is limited to the "file"  */
+    while ((c = get_ch()), in_text( fp->serial)
+        /* Rescanning is limited to the text    */
             && c != RT_END) {
             /*
              * This is the trick of STD mode.  collect_args() via replace()
-             * may read over to file->parent (provided the "file" is macro)
-             * unless stopped by RT_END.
+             * may read over to the text under it (provided the text is
+             * macro) unless stopped by RT_END.
              */
         size_t  len = 0;
 
@@ -1880,7 +2557,7 @@ static char *   rescan(
             *out_p++ = c = get_ch();
             switch (c) {
             case MAC_ARG_START  :
-                mac_arg_start = out_p - 2;      /* Remember the position    */
+                fp->mac_arg_start = out_p - 2;  /* Remember the position    */
                 *out_p++ = get_ch();
                 /* Fall through */
             case MAC_CALL_START :
@@ -1902,21 +2579,22 @@ static char *   rescan(
             }               /* Pass these characters as they are    */
             continue;
         }
-        token_type = scan_token( c, (tp = out_p, &out_p), out_end);
+        token_type = scan_token( c, (tp = out_p, &out_p)
+                , fp->out_end + IDMAX / 2); /* Overflow checked later   */
 #if COMPILER == GNUC
         if (mcpp_mode == STD) {
             /* Pass stuff within defined() as they are, if in_directive */
-            if ((within_defined || within_defined_arg_depth)) {
+            if ((fp->within_defined || fp->within_defined_arg_depth)) {
                 if (c == '(') {
-                    within_defined_arg_depth++;
-                    within_defined = FALSE;
-                } else if (within_defined_arg_depth && c == ')') {
-                    within_defined_arg_depth--;
+                    fp->within_defined_arg_depth++;
+                    fp->within_defined = FALSE;
+                } else if (fp->within_defined_arg_depth && c == ')') {
+                    fp->within_defined_arg_depth--;
                 }       /* Else should be a name (possibly macro)   */
                 continue;
             } else if (token_type == NAM && in_directive
                         && str_eq(identifier, "defined")) {
-                within_defined = TRUE;
+                fp->within_defined = TRUE;
                             /* 'defined' token in directive line    */
                 continue;
             }
@@ -1954,11 +2632,11 @@ static char *   rescan(
                     if (inner->nargs >= 0 && mgc_seq.magic_start) {
                         /* Magic sequence is found between macro */
                         /* name and '('.  This is a nuisance.    */
-                        char *      mgc_cleared;
+                        const char *    mgc_cleared;
                         size_t      seq_len;
                         size_t      arg_elen = option_flags.v ? ARG_E_LEN_V
                                             : ARG_E_LEN;
-                        if ((tp - ARG_S_LEN) == mac_arg_start
+                        if ((tp - ARG_S_LEN) == fp->mac_arg_start
                                 && *mgc_seq.magic_start == MAC_INF
                                 && *(mgc_seq.magic_start + 1) == MAC_ARG_END) {
                             /* Name of function-like macro is surrounded by */
@@ -1976,13 +2654,26 @@ static char *   rescan(
                             mgc_cleared = remove_magics(
                                     (const char *) infile->bptr, FALSE);
                                         /* Remove pair of magics    */
-                            strcpy( infile->bptr, mgc_cleared);
-                            free( mgc_cleared);
+                            reset_bptr( mgc_cleared);
+                            free( (char *) mgc_cleared);
                         }
                     }
                 }
-                if ((out_p = replace( inner, tp, out_end, outer, file
-                        , in_src_line_col, in_src_n)) == NULL)
+                fp->tp = tp;
+                fp->inner = inner;
+                fp->c = c;
+                sub = push_frame( EXP_REPLACE);
+                sub->defp = inner;
+                sub->out = tp;
+                sub->out_end = fp->out_end;
+                sub->outer = outer;
+                sub->rt_serial = fp->serial;
+                sub->line_col = in_src_line_col;
+                sub->in_src_n = in_src_n;
+                fp->state = 1;
+                return  EXP_CALL;
+replaced:
+                if ((out_p = exp_result) == NULL)
                     break;                  /* Error of macro call  */
             } else {
                 if (endf && strlen( endf)) {
@@ -2002,10 +2693,12 @@ static char *   rescan(
                 }                           /* Else not a macro call*/
             }
         }
-        if (out_end <= out_p) {
+        if (fp->out_end <= out_p) {
             *out_p = EOS;
-            diag_macro( CERROR, macbuf_overflow, outer ? outer->name : in, 0L
-                    , out, outer, inner);
+            if (! retry_exp())
+                diag_macro( CERROR, macbuf_overflow
+                        , outer ? outer->name : fp->in, 0L, fp->out, outer
+                        , inner);
             out_p = NULL;
             break;
         }
@@ -2017,7 +2710,8 @@ static char *   rescan(
             if  (c != RT_END) {
                 unget_ch();
                 if (outer != NULL) {    /* outer isn't a macro in argument  */
-                    if (infile && infile->bptr != cur_cp
+                    if (infile && (infile->serial != fp->cur_serial
+                                || text_pos() != fp->cur_pos)
                                     /* Have overrun replacement list*/
                             && !(tp && *tp == DEF_MAGIC)
                                                 /* Macro is enabled */
@@ -2025,7 +2719,7 @@ static char *   rescan(
                                 || (compat_mode && (warn_level & 8)))) {
                         diag_macro( CWARN,
 "Replacement text \"%s\" of macro %.0ld\"%s\" involved subsequent text" /* _W1_ */
-                            , in, 0L, outer->name, outer, inner);
+                            , fp->in, 0L, outer->name, outer, inner);
                     }
                 }
             }                       /* Else remove RT_END           */
@@ -2037,9 +2731,37 @@ static char *   rescan(
     if (mcpp_debug & EXPAND) {
         mcpp_fprintf( DBG, "rescan_level--%d (%s) "
                 , rescan_level + 1, outer ? outer->name : "<arg>");
-        dump_string( "rescan exit", out);
+        dump_string( "rescan exit", fp->out);
+    }
+    exp_result = out_p;
+    return  EXP_DONE;
+}
+
+static size_t   text_pos( void)
+/*
+ * Return the position of 'infile->bptr' to see whether the text has been
+ * read.  It is counted from the end of the buffer, which the texts pushed on
+ * or popped from the "file" of push_text() do not move.
+ */
+{
+    return  (size_t) (infile->buffer + infile->bufsize - infile->bptr);
+}
+
+static void     shift_pos(
+    long    len                     /* Bytes added at 'infile->bptr'    */
+)
+/*
+ * Shift the positions in the current text remembered by rescan(), when the
+ * text of push_text() is rewritten at 'bptr', as the rewriting of the other
+ * "file"s does not move 'bptr'.
+ */
+{
+    EXP_FRAME * fp;
+
+    for (fp = exp_top; fp != NULL; fp = fp->prev) {
+        if (fp->kind == EXP_RESCAN && fp->cur_serial == infile->serial)
+            fp->cur_pos = (size_t) ((long) fp->cur_pos + len);
     }
-    return  out_p;
 }
 
 static int  disable_repl(
@@ -2047,8 +2769,12 @@ static int  disable_repl(
 )
 /*
  * Register the macro name currently replacing.
+ * The innermost entry of the macro is linked from the definition, so that
+ * is_able_repl() need not search replacing[].
  */
 {
+    DEFBUF *    dp = (DEFBUF *) defp;   /* Only 'replacing' is changed  */
+
     if (defp == NULL)
         return  TRUE;
     if (rescan_level >= RESCAN_LIMIT) {
@@ -2057,8 +2783,15 @@ static int  disable_repl(
                 , macro_name, (long) RESCAN_LIMIT, defp->name, defp, NULL);
         return  FALSE;
     }
+    if (rescan_level >= max_replacing) {    /* Enlarge replacing[]  */
+        max_replacing = max_replacing ? max_replacing * 2 : INIT_REPLACING;
+        replacing = (REPLACING *) xrealloc( (char *) replacing
+                , sizeof (REPLACING) * max_replacing);
+    }
     replacing[ rescan_level].def = defp;
-    replacing[ rescan_level++].read_over = NO;
+    replacing[ rescan_level].read_over = NO;
+    replacing[ rescan_level].prev = dp->replacing;
+    dp->replacing = ++rescan_level;
     return  TRUE;
 }
 
@@ -2070,9 +2803,15 @@ static void enable_repl(
  * Un-register the macro name just replaced for later text.
  */
 {
+    REPLACING *     rp;
+
     if (defp == NULL)
         return;
-    replacing[ rescan_level - 1].def = NULL;
+    rp = &replacing[ rescan_level - 1];
+    if (rp->def) {                  /* Not yet enabled in compat_mode   */
+        ((DEFBUF *) rp->def)->replacing = rp->prev;
+        rp->def = NULL;
+    }
     if (done && rescan_level)
         rescan_level--;
 }
@@ -2084,15 +2823,9 @@ static int  is_able_repl(
  * The macro is permitted to replace ?
  */
 {
-    int     i;
-
-    if (defp == NULL)
+    if (defp == NULL || defp->replacing == 0)
         return  YES;
-    for (i = rescan_level-1; i >= 0; i--) {
-        if (defp == replacing[ i].def)
-            return  replacing[ i].read_over;
-    }
-    return  YES;
+    return  replacing[ defp->replacing - 1].read_over;
 }
 
 static char *   insert_to_bptr(
@@ -2105,13 +2838,25 @@ static char *   insert_to_bptr(
  * This routine changes absolute address of infile->bptr, hence rescan() emits
  * a "Replacement text ... involved subsequent text" warning.  Anyway,
  * a macro which needs this routine deserves that warning.
+ * The text of push_text() is lengthened in front of 'bptr' by insert_text().
  */
 {
-    size_t  bptr_offset = infile->bptr - infile->buffer;
-
-    if (infile->fp == NULL) {               /* Not source file      */
-        infile->buffer = xrealloc( infile->buffer
-                , strlen( infile->buffer) + len + 1);
+    size_t  bptr_offset;
+    size_t  size;
+
+    if (infile == exp_file)
+        exp_altered = TRUE;         /* Cannot restore the text      */
+    if (infile->num_segs >= 0) {    /* Text of push_text()          */
+        insert_text( ins, len);
+        shift_pos( (long) len);
+        return  infile->buffer;
+    }
+    bptr_offset = infile->bptr - infile->buffer;
+    size = strlen( infile->buffer) + len + 1;
+    if (infile->src == NULL && infile->bufsize < size) {
+                                /* Not source file and short of buffer  */
+        infile->buffer = xrealloc( infile->buffer, size);
+        infile->bufsize = size;
         infile->bptr = infile->buffer + bptr_offset;
     }
     memmove( infile->bptr + len, infile->bptr, strlen( infile->bptr) + 1);
@@ -2120,6 +2865,1027 @@ static char *   insert_to_bptr(
     return  infile->buffer;
 }
 
+static void     reset_bptr(
+    const char *    text            /* Not longer than the rest     */
+)
+/*
+ * Rewrite the rest of the current text from 'infile->bptr' with 'text'.
+ * The text of push_text() is rewritten to end where it ended, on the texts
+ * under it.
+ */
+{
+    size_t  len;
+
+    if (infile->num_segs < 0) {
+        strcpy( infile->bptr, text);
+        return;
+    }
+    len = strlen( infile->bptr) - strlen( text);
+    infile->bptr += len;
+    memcpy( infile->bptr, text, strlen( text));
+    shift_pos( - (long) len);
+}
+
+static int  retry_exp( void)
+/*
+ * Return TRUE, and remember it, if the expansion which overflowed the work
+ * buffers can be done over again with larger buffers, that is, no
+ * diagnostic has been issued, no line has been read or the lines read can be
+ * read again (see mark_src()), and the text following the macro name has not
+ * been altered since expand_std() started.
+ */
+{
+    const FILEINFO *    file;
+
+    if (! exp_retry || exp_altered || diag_count != exp_diags
+            || (src_line != exp_line && ! rewind_src( FALSE)))
+        return  FALSE;
+    for (file = infile; file && file != exp_file; file = file->parent) {
+        if (file->src)                      /* Not a macro          */
+            return  FALSE;
+    }
+    if (file == NULL || file->serial != exp_serial)
+        return  FALSE;                      /* Has read over 'exp_file'     */
+    exp_overflow = TRUE;
+    return  TRUE;
+}
+
+static int  has_func_name(
+    const char *    out,                    /* Expansion of a macro */
+    const char *    out_end                 /* End of the expansion */
+)
+/*
+ * Return TRUE if the expansion has any name of function-like macro, which
+ * would be replaced or not depending on the following text.
+ * Names in literals are also checked, which is harmless.
+ */
+{
+    char    name[ IDMAX + 1];
+    const DEFBUF *  defp;
+    size_t  len;
+    int     type;
+
+    while (out < out_end) {
+        type = char_type[ *out & UCHARMAX];
+        if (! (type & (LET | DIG))) {
+            out++;
+            continue;
+        }
+        for (len = 0; out < out_end
+                && (char_type[ *out & UCHARMAX] & (LET | DIG)); len++)
+            out++;
+        if (! (type & LET))                 /* pp-number            */
+            continue;
+        if (len > IDMAX)
+            return  TRUE;                   /* Not to cache anyway  */
+        memcpy( name, out - len, len);
+        name[ len] = EOS;
+        if ((defp = look_id( name)) != NULL
+                && (defp->nargs >= 0 || defp->nargs == DEF_PRAGMA))
+            return  TRUE;
+    }
+    return  FALSE;
+}
+
+void    dump_exp_cache( void)
+/*
+ * Report the usage of the cache of object-like macro expansions, for the
+ * MEMORY debug class.
+ */
+{
+    int     i, n;
+
+    for (i = n = 0; i < EXP_CACHE_SIZE; i++)
+        if (exp_cache[ i].defp && exp_cache[ i].gen == macro_gen)
+            n++;
+    mcpp_fprintf( DBG, "Expansion cache: %ld hits, %ld misses, %d of %d"
+            " entries valid\n", exp_cache_hits, exp_cache_misses, n
+            , EXP_CACHE_SIZE);
+}
+
+/*
+ *                      M A C R O   M A P
+ */
+
+void    open_mac_map(
+    const char *    fname                   /* Name of the map file */
+)
+/*
+ * Open the macro map of -Y option.
+ * The map begins with the 7 bytes "MCPPMAP" and the version byte 1, and a
+ * sequence of records follows.  A record is a type byte followed by some
+ * numbers, each written in unsigned LEB128 (7 bits in a byte from the least
+ * significant ones, the highest bit set on the bytes but the last).  A name
+ * is written as its length followed by the bytes.
+ *   MAP_FNAME (1): id, name.  Numbers a file name from 1 prior to its use.
+ *   MAP_MACRO (2): id, macro name, the file id and the line of the
+ *      definition.  Numbers a macro definition from 1 prior to its use.
+ *   MAP_CALL  (3): depth, the macro id, the file id of the call (0 if the
+ *      call is not read from a source file) and, if not 0, the start line,
+ *      start column, end line and end column of the call, then the number
+ *      of the arguments followed by the start line of each argument and, if
+ *      not 0 (the argument is read from a source file), its start column,
+ *      end line and end column.
+ *      A call of depth 0 is a top-level call, and the calls of depth n+1
+ *      following a call of depth n are nested in it, either in its argument
+ *      or in its rescan.
+ *   MAP_OUT   (4): the number of the MAP_CALL record counted from 0, the
+ *      offset in the output and the length of the expansion of a top-level
+ *      call, the former two as the differences from the call number and
+ *      the end offset of the previous MAP_OUT record (from 0 for the first
+ *      one).  A call which is not put out (e.g. by _Pragma()) has none.
+ * The lines and columns start at 1 as in the output of -K option.
+ * The records are written in the order of the output, so that the map can
+ * be read as a stream.
+ */
+{
+    if (fp_mac_map)                 /* The last -Y option is effective  */
+        close_mac_map();
+    if ((fp_mac_map = fopen( fname, "wb")) == NULL)
+        cfatal( "Can't open the macro map file \"%s\""      /* _F_  */
+                , fname, 0L, NULL);
+    mac_map.fp = fp_mac_map;
+    map_write( "MCPPMAP\1", 8, &mac_map);
+}
+
+void    close_mac_map( void)
+/*
+ * Close the macro map and free the memory for it.
+ */
+{
+    map_free( &mac_map);
+    fp_mac_map = NULL;
+    free( map_spans);
+    map_spans = NULL;
+    map_calls = map_out_call = map_out_end = 0L;
+    map_num_spans = map_max_spans = 0;
+    map_last = -1L;
+}
+
+void    open_src_map(
+    const char *    fname                   /* Name of the map file */
+)
+/*
+ * Open the source map of -L option.
+ * The map begins with the 7 bytes "MCPPSRC" and the version byte 1, and the
+ * records follow as in the macro map of -Y option (see open_mac_map()),
+ * MAP_FNAME and MAP_MACRO as well as:
+ *   MAP_CHAIN (5): id, the number of the macro calls of an expansion and
+ *      the depth and the macro id of each call.  Numbers the calls of an
+ *      expansion from 1 prior to its use.  The first call is the top-level
+ *      one of depth 0, and the calls of depth n+1 following a call of depth
+ *      n are nested in it as in MAP_CALL.
+ *   MAP_LINE  (6): the output line, the number of the segments on the line
+ *      and the output column, the file id, the line and the column of the
+ *      source and the chain id of each segment.  A segment lasts until the
+ *      next one or the end of the line.  Its chain id is 0 if the segment is
+ *      the text of the source, which goes on in the source as in the output,
+ *      or the id of the MAP_CHAIN of the macro expansion called at the
+ *      location.
+ *      The output line is the difference from that of the previous MAP_LINE,
+ *      the output column from that of the previous segment on the line (from
+ *      1 for the first segment), the file id is 0 if it is the same as that
+ *      of the previous segment, and the source line is the difference from
+ *      that of the previous segment, whose sign is in the lowest bit (0 or
+ *      2, 4, ... for 0 or 1, 2, ..., and 1, 3, ... for -1, -2, ...).  The
+ *      values of the previous MAP_LINE and segment are reset to 0 at the
+ *      every MAP_BLOCK (256) MAP_LINEs, at which a block of the map begins.
+ *   MAP_INDEX (7): the number of the blocks followed by the first output
+ *      line and the offset of each block in the map, and the numbers of the
+ *      MAP_FNAME, MAP_MACRO and MAP_CHAIN records each followed by the
+ *      offsets of the records in the order of the id.  All the lines and
+ *      offsets are the differences from the previous ones.
+ * The output lines of the text of the source have MAP_LINE records, and
+ * the other lines (#line, comments of -C option, etc.) have none.  The
+ * source lines are those renumbered by #line directive as in -K option,
+ * while the file names are those of the real files.  The map
+ * ends with the MAP_INDEX record and the offset of it in 8 bytes of little-
+ * endian, so that the map can be read from the block of an output line.
+ */
+{
+    if (fp_src_map)                 /* The last -L option is effective  */
+        close_src_map();
+    if ((fp_src_map = fopen( fname, "wb")) == NULL)
+        cfatal( "Can't open the source map file \"%s\""     /* _F_  */
+                , fname, 0L, NULL);
+    src_map.fp = fp_src_map;
+    map_write( "MCPPSRC\1", 8, &src_map);
+}
+
+void    close_src_map( void)
+/*
+ * Write the index to the source map, close it and free the memory for it.
+ */
+{
+    long    offset = src_map.offset;
+    long    prev;
+    long *  lp;
+    MAP_TABLE * tables[ 2];
+    long *  offsets;
+    long    num;
+    int     i;
+    char    bytes[ 8];
+
+    map_num( MAP_INDEX, &src_map);
+    map_num( map_num_blocks, &src_map);
+    for (lp = map_blocks, prev = 0L; lp < map_blocks + map_num_blocks * 2;
+            lp += 2) {
+        map_num( lp[ 0] - prev, &src_map);  /* First output line    */
+        prev = lp[ 0];
+    }
+    for (lp = map_blocks, prev = 0L; lp < map_blocks + map_num_blocks * 2;
+            lp += 2) {
+        map_num( lp[ 1] - prev, &src_map);  /* Offset of the block  */
+        prev = lp[ 1];
+    }
+    tables[ 0] = &src_map.fnames;
+    tables[ 1] = &src_map.macros;
+    for (i = 0; i <= 2; i++) {
+        offsets = i < 2 ? tables[ i]->offsets : map_chain_offsets;
+        num = i < 2 ? tables[ i]->last_id : map_num_chains;
+        map_num( num, &src_map);
+        for (lp = offsets, prev = 0L; lp < offsets + num; lp++) {
+            map_num( *lp - prev, &src_map);
+            prev = *lp;
+        }
+    }
+    for (i = 0; i < 8; i++) {               /* Offset of MAP_INDEX  */
+        bytes[ i] = (char) (offset & 0xFF);
+        offset >>= 8;
+    }
+    map_write( bytes, 8, &src_map);
+    map_free( &src_map);
+    fp_src_map = NULL;
+    free( map_steps);
+    free( map_chains);
+    free( map_chain_offsets);
+    free( map_store);
+    free( map_segs);
+    free( map_blocks);
+    map_steps = NULL;
+    map_chains = NULL;
+    map_chain_offsets = map_blocks = NULL;
+    map_store = NULL;
+    map_segs = NULL;
+    map_num_steps = map_max_steps = map_num_segs = map_max_segs = 0;
+    map_chains_size = map_store_len = map_store_size = 0;
+    map_num_chains = map_chain_last = map_lines = map_num_blocks = 0L;
+    map_prev_line = map_prev_fid = map_prev_sline = 0L;
+    map_tok_name = NULL;
+}
+
+void    map_token(
+    size_t      col,                /* Column in output[]           */
+    LINE_COL    line_col            /* Location of the token        */
+)
+/*
+ * Record the source location of the token to be put at 'col' of output[]
+ * for the source map, starting a new segment of the line unless the token
+ * goes on with the text of the last segment in the source as in output[].
+ */
+{
+    MAP_SEG *   segp;
+
+    get_src_location( &line_col);   /* Before line splicing         */
+    if (cur_fullname != map_tok_name) {
+        map_tok_name = cur_fullname;
+        map_tok.fid = map_fname( &src_map, cur_fullname);
+    }
+    map_tok.col = col;
+    map_tok.line = line_col.line;
+    map_tok.scol = line_col.col;
+    map_tok.chain = 0L;
+    if (map_num_segs) {
+        segp = &map_segs[ map_num_segs - 1];
+        if (segp->chain == 0L && segp->fid == map_tok.fid
+                && segp->line == map_tok.line
+                && segp->scol + (long) (col - segp->col) == map_tok.scol)
+            return;                 /* Goes on with the segment     */
+        if (segp->col == col) {     /* Replaces an empty segment    */
+            *segp = map_tok;
+            return;
+        }
+    }
+    map_seg();
+}
+
+void    map_output(
+    size_t  start,                  /* Start column in output[]     */
+    size_t  end                     /* End column in output[]       */
+)
+/*
+ * Remember the output span of the top-level call just expanded from the
+ * last token to record it when the line is put out.
+ */
+{
+    if (map_last >= 0L) {           /* Recorded to the macro map    */
+        if (map_num_spans >= map_max_spans) {
+            map_max_spans = map_max_spans ? map_max_spans * 2 : 16;
+            map_spans = (MAP_SPAN *) xrealloc( (char *) map_spans
+                    , sizeof (MAP_SPAN) * map_max_spans);
+        }
+        map_spans[ map_num_spans].call = map_last;
+        map_spans[ map_num_spans].start = start;
+        map_spans[ map_num_spans].end = end;
+        map_num_spans++;
+        map_last = -1L;
+    }
+    if (map_chain_last) {           /* Recorded to the source map   */
+        if (map_num_segs == 0 || map_segs[ map_num_segs - 1].col != start) {
+            map_tok.col = start;    /* Split the segment of text    */
+            map_seg();
+        }
+        map_segs[ map_num_segs - 1].chain = map_chain_last;
+        map_chain_last = 0L;
+    }
+}
+
+void    put_map_out(
+    const char *    out             /* The line to be put out       */
+)
+/*
+ * Record the output spans of the macro calls and the segments of the line
+ * 'out', which is about to be put out at 'out_offset', to the maps.  The
+ * spans of a line are in order and do not overlap each other.
+ * NULL 'out' discards the spans of the line not to be put out.
+ * Note: A line divided by devide_line() is recorded as if not divided.
+ */
+{
+    MAP_SPAN *  sp;
+    size_t  len;
+    size_t  start, end;
+
+    if (out) {
+        len = strlen( out) - 1;             /* Excluding '\n'       */
+        while (len && (char_type[ out[ len - 1] & UCHARMAX] & SPA))
+            len--;              /* Trailing spaces are removed      */
+        for (sp = map_spans; sp < map_spans + map_num_spans; sp++) {
+            start = sp->start < len ? sp->start : len;
+            end = sp->end < len ? sp->end : len;
+            while (start < end && (char_type[ out[ start] & UCHARMAX] & HSP))
+                start++;            /* Spaces surrounding the expansion */
+            while (start < end && (char_type[ out[ end - 1] & UCHARMAX] & HSP))
+                end--;
+            map_num( MAP_OUT, &mac_map);
+            map_num( sp->call - map_out_call, &mac_map);
+            map_num( out_offset + start - map_out_end, &mac_map);
+            map_num( end - start, &mac_map);
+            map_out_call = sp->call;
+            map_out_end = out_offset + end;
+        }
+        if (map_num_segs)
+            map_line( len);
+    }
+    map_num_spans = map_num_segs = 0;
+}
+
+static void map_call(
+    const DEFBUF *  defp,                   /* The macro            */
+    LINE_COL    line_col,   /* Location of the call, line 0 if unknown  */
+    int     nargs               /* Number of the arguments in map_locs[]    */
+)
+/*
+ * Append the macro call to map_steps[] for the source map, and append a
+ * record of the call to map_buf[] for the macro map.  A top-level call has
+ * its location in 'line_col' and ends at the current position of the source.
+ */
+{
+    LINE_COL    e_line_col;
+    LOCATION *  loc;
+
+    if (fp_src_map) {
+        if (map_num_steps >= map_max_steps) {
+            map_max_steps = map_max_steps ? map_max_steps * 2 : 64;
+            map_steps = (MAP_STEP *) xrealloc( (char *) map_steps
+                    , sizeof (MAP_STEP) * map_max_steps);
+        }
+        map_steps[ map_num_steps].depth = map_depth;
+        map_steps[ map_num_steps].defp = defp;
+        map_num_steps++;
+    }
+    if (! fp_mac_map)
+        return;
+    map_num( MAP_CALL, NULL);
+    map_num( map_depth, NULL);
+    map_num( map_defbuf( &mac_map, defp), NULL);
+    if (line_col.line && infile->src) {
+        e_line_col.line = src_line;
+        e_line_col.col = infile->bptr - infile->buffer;
+        /* Get the location before line splicing    */
+        get_src_location( & line_col);
+        get_src_location( & e_line_col);
+        map_num( map_fname( &mac_map, cur_fullname), NULL);
+        map_num( line_col.line, NULL);
+        map_num( line_col.col, NULL);
+        map_num( e_line_col.line, NULL);
+        map_num( e_line_col.col, NULL);
+    } else {
+        map_num( 0L, NULL);
+    }
+    map_num( nargs, NULL);
+    for (loc = map_locs; loc < map_locs + nargs; loc++) {
+        map_num( loc->start_line, NULL);
+        if (loc->start_line == 0L)          /* Not in the source    */
+            continue;
+        map_num( loc->start_col, NULL);
+        map_num( loc->end_line, NULL);
+        map_num( loc->end_col, NULL);
+    }
+    map_calls++;
+}
+
+static void map_seg( void)
+/*
+ * Append the location of the last token to the segments of the line.
+ */
+{
+    if (map_num_segs >= map_max_segs) {
+        map_max_segs = map_max_segs ? map_max_segs * 2 : 16;
+        map_segs = (MAP_SEG *) xrealloc( (char *) map_segs
+                , sizeof (MAP_SEG) * map_max_segs);
+    }
+    map_segs[ map_num_segs++] = map_tok;
+}
+
+static void map_line(
+    size_t  len                 /* Length of the line in output[]   */
+)
+/*
+ * Write the MAP_LINE record of the segments of the line to the source map.
+ * The columns of output[] are shifted by the spaces already put out on the
+ * line (by sharp() of keep_spaces mode).
+ */
+{
+    MAP_SEG *   segp;
+    MAP_SEG *   seg_end = map_segs + map_num_segs;
+    long    line = out_line + 1;            /* Lines start at 1     */
+    size_t  base = (size_t) (out_offset - out_line_top) + 1;
+    size_t  col = 1;                        /* Columns start at 1   */
+    long    diff;
+
+    while (seg_end > map_segs && len <= (seg_end - 1)->col
+            && map_segs < seg_end - 1)
+        seg_end--;              /* Segments of the trailing spaces  */
+    if (map_lines % MAP_BLOCK == 0) {       /* A block begins       */
+        if ((map_num_blocks & (map_num_blocks - 1)) == 0)
+            map_blocks = (long *) xrealloc( (char *) map_blocks
+                    , sizeof (long) * 2 * (map_num_blocks ? map_num_blocks * 2
+                        : 1));
+        map_blocks[ map_num_blocks * 2] = line;
+        map_blocks[ map_num_blocks * 2 + 1] = src_map.offset;
+        map_num_blocks++;
+        map_prev_line = map_prev_fid = map_prev_sline = 0L;
+    }
+    map_lines++;
+    map_num( MAP_LINE, &src_map);
+    map_num( line - map_prev_line, &src_map);
+    map_num( seg_end - map_segs, &src_map);
+    for (segp = map_segs; segp < seg_end; segp++) {
+        map_num( base + segp->col - col, &src_map);
+        col = base + segp->col;
+        map_num( segp->fid == map_prev_fid ? 0L : segp->fid, &src_map);
+        diff = segp->line - map_prev_sline;
+        map_num( diff < 0L ? ((unsigned long) -(diff + 1) << 1) | 1
+                : (unsigned long) diff << 1, &src_map);
+        map_num( segp->scol, &src_map);
+        map_num( segp->chain, &src_map);
+        map_prev_fid = segp->fid;
+        map_prev_sline = segp->line;
+    }
+    map_prev_line = line;
+}
+
+static long map_fname(
+    MAP_FILE *      mf,                     /* The map              */
+    const char *    name                    /* A file name          */
+)
+/*
+ * Return the id of the file name in the map, writing a MAP_FNAME record if
+ * the name is new.  The names are looked up by the address, since they are
+ * mostly registered in fname_table[], and an address not yet seen is compared
+ * by the string.
+ */
+{
+    MAP_TABLE * tp = &mf->fnames;
+    MAP_ID *    fnp;
+    MAP_ID *    ip;
+    size_t  len;
+    long    id = 0L;
+
+    fnp = map_slot( tp, name);
+    if (fnp->key)
+        return  fnp->id;
+    for (ip = tp->ids; ip < tp->ids + tp->size; ip++) {
+        if (ip->key && str_eq( (const char *) ip->key, name)) {
+            id = ip->id;                    /* A new address        */
+            break;
+        }
+    }
+    if (id == 0L) {                         /* A new name           */
+        id = ++tp->last_id;
+        tp->offsets = map_offset( tp->offsets, id, mf->offset);
+        len = strlen( name);
+        map_num( MAP_FNAME, mf);
+        map_num( id, mf);
+        map_num( len, mf);
+        map_write( name, len, mf);
+    }
+    fnp->key = name;
+    fnp->id = id;
+    tp->num++;
+    return  id;
+}
+
+static long map_defbuf(
+    MAP_FILE *      mf,                     /* The map              */
+    const DEFBUF *  defp                    /* The macro            */
+)
+/*
+ * Return the id of the macro definition in the map, writing a MAP_MACRO
+ * record if the definition is new.  The definitions are looked up by the
+ * address and the definition site, since a DEFBUF freed by #undef may be
+ * reused for another definition.
+ */
+{
+    MAP_TABLE * tp = &mf->macros;
+    MAP_ID *    mp;
+    size_t  len;
+    long    fid;
+
+    mp = map_slot( tp, defp);
+    if (mp->key && mp->fname == defp->fname && mp->mline == defp->mline)
+        return  mp->id;
+    fid = defp->fname ? map_fname( mf, defp->fname) : 0L;
+    if (mp->key == NULL)
+        tp->num++;
+    mp->key = defp;
+    mp->fname = defp->fname;
+    mp->mline = defp->mline;
+    mp->id = ++tp->last_id;
+    tp->offsets = map_offset( tp->offsets, mp->id, mf->offset);
+    len = strlen( defp->name);
+    map_num( MAP_MACRO, mf);
+    map_num( mp->id, mf);
+    map_num( len, mf);
+    map_write( defp->name, len, mf);
+    map_num( fid, mf);
+    map_num( defp->mline, mf);
+    return  mp->id;
+}
+
+static MAP_ID * map_slot(
+    MAP_TABLE * tp,
+    const void *    key
+)
+/*
+ * Return the slot of the key in the table, or the empty slot to register it,
+ * enlarging the table on demand.
+ */
+{
+    MAP_ID *    ip;
+    size_t  mask;
+    size_t  i;
+
+    if (tp->num * 2 >= tp->size) {
+        MAP_ID *    old = tp->ids;
+        size_t  old_size = tp->size;
+
+        tp->size = old_size ? old_size * 2 : 64;
+        tp->ids = (MAP_ID *) xmalloc( sizeof (MAP_ID) * tp->size);
+        memset( tp->ids, 0, sizeof (MAP_ID) * tp->size);
+        mask = tp->size - 1;
+        for (ip = old; ip < old + old_size; ip++) {     /* Rehash   */
+            if (ip->key == NULL)
+                continue;
+            i = ((size_t) ip->key ^ ((size_t) ip->key >> 7)) & mask;
+            while (tp->ids[ i].key)
+                i = (i + 1) & mask;
+            tp->ids[ i] = *ip;
+        }
+        free( old);
+    }
+    mask = tp->size - 1;
+    i = ((size_t) key ^ ((size_t) key >> 7)) & mask;
+    while ((ip = &tp->ids[ i])->key != NULL && ip->key != key)
+        i = (i + 1) & mask;
+    return  ip;
+}
+
+static long map_chain( void)
+/*
+ * Return the id of the MAP_CHAIN of the calls in map_steps[], writing the
+ * record if the calls are new.  The records are looked up by the contents,
+ * since the same calls are repeated by the same macro in most cases.
+ */
+{
+    MAP_STEP *  stp;
+    MAP_CHAIN_ID *  cp;
+    size_t  hash = 0;
+    size_t  mask;
+    size_t  i;
+
+    for (stp = map_steps; stp < map_steps + map_num_steps; stp++) {
+        map_num( stp->depth, NULL);
+        map_num( map_defbuf( &src_map, stp->defp), NULL);
+    }
+    for (i = 0; i < map_len; i++)
+        hash = hash * 31 + (map_buf[ i] & UCHARMAX);
+    if ((size_t) map_num_chains * 2 >= map_chains_size) {
+        MAP_CHAIN_ID *  old = map_chains;
+        size_t  old_size = map_chains_size;
+
+        map_chains_size = old_size ? old_size * 2 : 256;
+        map_chains = (MAP_CHAIN_ID *) xmalloc( sizeof (MAP_CHAIN_ID)
+                * map_chains_size);
+        memset( map_chains, 0, sizeof (MAP_CHAIN_ID) * map_chains_size);
+        mask = map_chains_size - 1;
+        for (cp = old; cp < old + old_size; cp++) {     /* Rehash   */
+            if (cp->id == 0L)
+                continue;
+            i = cp->hash & mask;
+            while (map_chains[ i].id)
+                i = (i + 1) & mask;
+            map_chains[ i] = *cp;
+        }
+        free( old);
+    }
+    mask = map_chains_size - 1;
+    i = hash & mask;
+    while ((cp = &map_chains[ i])->id != 0L) {
+        if (cp->hash == hash && cp->len == map_len
+                && memcmp( map_store + cp->start, map_buf, map_len) == 0) {
+            map_len = 0;
+            return  cp->id;                 /* Already recorded     */
+        }
+        i = (i + 1) & mask;
+    }
+    if (map_store_len + map_len > map_store_size) {
+        map_store_size = map_store_size ? map_store_size * 2 : NWORK;
+        if (map_store_len + map_len > map_store_size)
+            map_store_size = map_store_len + map_len;
+        map_store = xrealloc( map_store, map_store_size);
+    }
+    memcpy( map_store + map_store_len, map_buf, map_len);
+    cp->hash = hash;
+    cp->start = map_store_len;
+    cp->len = map_len;
+    cp->id = ++map_num_chains;
+    map_store_len += map_len;
+    map_chain_offsets = map_offset( map_chain_offsets, cp->id
+            , src_map.offset);
+    map_num( MAP_CHAIN, &src_map);
+    map_num( cp->id, &src_map);
+    map_num( map_num_steps, &src_map);
+    map_write( map_buf, map_len, &src_map);
+    map_len = 0;
+    return  cp->id;
+}
+
+static long *   map_offset(
+    long *  offsets,                /* Offsets of the records by id */
+    long    id,                     /* Id of the new record         */
+    long    offset                  /* Offset of the record         */
+)
+/*
+ * Remember the offset of the record for the index of the source map, and
+ * return 'offsets' enlarged whenever 'id' reaches a power of 2.
+ */
+{
+    if ((id & (id - 1)) == 0)
+        offsets = (long *) xrealloc( (char *) offsets
+                , sizeof (long) * id * 2);
+    offsets[ id - 1] = offset;
+    return  offsets;
+}
+
+static void map_free(
+    MAP_FILE *  mf
+)
+/*
+ * Close the map and free its tables.
+ */
+{
+    fclose( mf->fp);
+    free( mf->fnames.ids);
+    free( mf->fnames.offsets);
+    free( mf->macros.ids);
+    free( mf->macros.offsets);
+    memset( mf, 0, sizeof (MAP_FILE));
+    free( map_buf);
+    map_buf = NULL;
+    map_len = map_size = 0;
+}
+
+static void map_num(
+    unsigned long   num,
+    MAP_FILE *  mf                  /* The map, or NULL for map_buf */
+)
+/*
+ * Write the number in unsigned LEB128.
+ */
+{
+    char    bytes[ sizeof (unsigned long) * 2];
+    size_t  len = 0;
+
+    do {
+        bytes[ len] = (char) (num & 0x7F);
+        num >>= 7;
+        if (num)
+            bytes[ len] |= 0x80;
+        len++;
+    } while (num);
+    map_write( bytes, len, mf);
+}
+
+static void map_write(
+    const char *    bytes,
+    size_t  len,
+    MAP_FILE *  mf                  /* The map, or NULL for map_buf */
+)
+/*
+ * Write the bytes to the map file, or append them to map_buf[] to be written
+ * when the expansion succeeds.
+ */
+{
+    if (mf) {
+        if (fwrite( bytes, 1, len, mf->fp) != len)
+            cfatal( "File write error", NULL, 0L, NULL);    /* _F_  */
+        mf->offset += len;
+        return;
+    }
+    if (map_len + len > map_size) {
+        map_size = map_size ? map_size * 2 : NWORK;
+        if (map_len + len > map_size)
+            map_size = map_len + len;
+        map_buf = xrealloc( map_buf, map_size);
+    }
+    memcpy( map_buf + map_len, bytes, len);
+    map_len += len;
+}
+
+/*
+ *                  M A C R O   P R O F I L E
+ */
+
+void    open_profile(
+    const char *    fname                   /* Name of the report   */
+)
+/*
+ * Open the report of the macro profile of -y option, which is written in
+ * JSON if the name ends with ".json", otherwise in CSV.
+ */
+{
+    size_t  len = strlen( fname);
+
+    if (fp_prof)                    /* The last -y option is effective  */
+        fclose( fp_prof);
+    if ((fp_prof = fopen( fname, "w")) == NULL)
+        cfatal( "Can't open the profile report \"%s\""      /* _F_  */
+                , fname, 0L, NULL);
+    prof_json = len >= 5 && str_eq( fname + len - 5, ".json");
+}
+
+void    put_profile( void)
+/*
+ * Write the report of the macro profile to the file of -y option, or in
+ * CSV to the debugging output for '#pragma MCPP debug profile', and free
+ * the counters.  The macro definitions are sorted by the time spent in
+ * them, and each has the name, the file and the line of the definition,
+ * the number of the calls, the bytes of the expansions and of the
+ * arguments, the seconds spent in the calls including the nested ones, and
+ * the deepest nesting level of the macro calls in the expansions.
+ */
+{
+    MAC_PROF ** profs;
+    MAC_PROF *  pp;
+    char *  buf = NULL;
+    char *  cp;
+    size_t  size = 0;
+    size_t  len;
+    long    i;
+
+    if (fp_prof == NULL && prof_list == NULL)
+        return;
+    profs = (MAC_PROF **) xmalloc( sizeof (MAC_PROF *) * (prof_num + 1));
+    for (i = 0, pp = prof_list; pp; pp = pp->next)
+        profs[ i++] = pp;
+    qsort( profs, (size_t) prof_num, sizeof (MAC_PROF *), prof_cmp);
+    prof_put( prof_json ? "["
+            : "macro,file,line,calls,bytes,arg_bytes,seconds,depth\n");
+    for (i = 0; i < prof_num; i++) {
+        pp = profs[ i];
+        /* A character may be escaped into 6 bytes  */
+        len = (strlen( pp->name) + strlen( pp->fname)) * 6 + 256;
+        if (size < len)
+            buf = xrealloc( buf, size = len);
+        if (prof_json) {
+            cp = stpcpy( buf, i ? ",\n  {\"macro\": " : "\n  {\"macro\": ");
+            cp = prof_str( cp, pp->name);
+            cp = stpcpy( cp, ", \"file\": ");
+            cp = prof_str( cp, pp->fname);
+            sprintf( cp, ", \"line\": %ld, \"calls\": %ld, \"bytes\": %ld"
+                    ", \"arg_bytes\": %ld, \"seconds\": %.6f, \"depth\": %d}"
+                    , pp->mline, pp->calls, pp->out_bytes, pp->arg_bytes
+                    , (double) pp->time / CLOCKS_PER_SEC, pp->depth);
+        } else {
+            cp = prof_str( buf, pp->name);
+            *cp++ = ',';
+            cp = prof_str( cp, pp->fname);
+            sprintf( cp, ",%ld,%ld,%ld,%ld,%.6f,%d\n", pp->mline
+                    , pp->calls, pp->out_bytes, pp->arg_bytes
+                    , (double) pp->time / CLOCKS_PER_SEC, pp->depth);
+        }
+        prof_put( buf);
+    }
+    if (prof_json)
+        prof_put( prof_num ? "\n]\n" : "]\n");
+    if (fp_prof) {
+        fclose( fp_prof);
+        fp_prof = NULL;
+    }
+    free( buf);
+    free( profs);
+    while ((pp = prof_list) != NULL) {
+        prof_list = pp->next;
+        free( pp);
+    }
+    prof_num = 0L;
+    free( prof_calls);
+    prof_calls = NULL;
+    prof_num_calls = prof_max_calls = 0;
+    prof_cur = -1;
+}
+
+static int  prof_enter(
+    DEFBUF *    defp                        /* The macro            */
+)
+/*
+ * Log a call of replace() for the macro profile and return the index of it
+ * in prof_calls[].
+ */
+{
+    PROF_CALL * callp;
+
+    if (prof_num_calls >= prof_max_calls) {
+        prof_max_calls = prof_max_calls ? prof_max_calls * 2 : INIT_REPLACING;
+        prof_calls = (PROF_CALL *) xrealloc( (char *) prof_calls
+                , sizeof (PROF_CALL) * prof_max_calls);
+    }
+    callp = &prof_calls[ prof_num_calls];
+    callp->prof = prof_of( defp);
+    callp->prof->active++;
+    callp->parent = prof_cur;
+    callp->depth = callp->max_depth
+            = prof_cur < 0 ? 0 : prof_calls[ prof_cur].depth + 1;
+    callp->out_bytes = callp->arg_bytes = 0L;
+    callp->time = clock();
+    return  prof_cur = prof_num_calls++;
+}
+
+static void prof_exit(
+    int     n,                      /* Index into prof_calls[]      */
+    long    out_bytes               /* Bytes of the expansion       */
+)
+/*
+ * Close the call of replace() logged at prof_calls[ n], abandoning the calls
+ * nested in it which have failed without returning.
+ */
+{
+    clock_t     now = clock();
+    PROF_CALL * callp;
+
+    while (prof_cur > n) {
+        callp = &prof_calls[ prof_cur];
+        callp->prof->active--;
+        callp->prof = NULL;
+        prof_cur = callp->parent;
+    }
+    callp = &prof_calls[ n];
+    callp->out_bytes = out_bytes;
+    /* Not to add twice the time of a call nested in the same macro */
+    callp->time = --callp->prof->active ? 0 : now - callp->time;
+    prof_cur = callp->parent;
+    if (prof_cur >= 0 && prof_calls[ prof_cur].max_depth < callp->max_depth)
+        prof_calls[ prof_cur].max_depth = callp->max_depth;
+}
+
+static void prof_done(
+    int     commit                  /* Add the log to the counters  */
+)
+/*
+ * Clear the log of the calls of an expansion, adding it to the counters of
+ * the macros if 'commit' is TRUE, or discarding it on error or on retry.
+ */
+{
+    PROF_CALL * callp;
+    MAC_PROF *  pp;
+    int     depth;
+
+    while (prof_cur >= 0) {             /* Abandon unclosed calls   */
+        callp = &prof_calls[ prof_cur];
+        callp->prof->active--;
+        callp->prof = NULL;
+        prof_cur = callp->parent;
+    }
+    for (callp = prof_calls; commit && callp < prof_calls + prof_num_calls;
+            callp++) {
+        if ((pp = callp->prof) == NULL)
+            continue;
+        pp->calls++;
+        pp->out_bytes += callp->out_bytes;
+        pp->arg_bytes += callp->arg_bytes;
+        pp->time += callp->time;
+        if ((depth = callp->max_depth - callp->depth) > pp->depth)
+            pp->depth = depth;
+    }
+    prof_num_calls = 0;
+}
+
+static MAC_PROF *   prof_of(
+    DEFBUF *    defp
+)
+/*
+ * Return the counters of the macro definition, creating them on its first
+ * call.  The counters outlive the definition removed by #undef.
+ */
+{
+    MAC_PROF *  pp;
+    size_t  len;
+
+    if ((pp = defp->prof) != NULL)
+        return  pp;
+    len = strlen( defp->name);
+    pp = (MAC_PROF *) xmalloc( sizeof (MAC_PROF) + len);
+    memset( pp, 0, sizeof (MAC_PROF));
+    memcpy( pp->name, defp->name, len + 1);
+    pp->fname = defp->fname ? defp->fname : "";
+    pp->mline = defp->mline;
+    pp->next = prof_list;
+    prof_list = pp;
+    prof_num++;
+    return  defp->prof = pp;
+}
+
+static int  prof_cmp(
+    const void *    a,
+    const void *    b
+)
+/*
+ * Order the counters by the time, by the number of calls and by the name.
+ */
+{
+    const MAC_PROF *    pa = *(MAC_PROF * const *) a;
+    const MAC_PROF *    pb = *(MAC_PROF * const *) b;
+
+    if (pa->time != pb->time)
+        return  pa->time < pb->time ? 1 : -1;
+    if (pa->calls != pb->calls)
+        return  pa->calls < pb->calls ? 1 : -1;
+    return  strcmp( pa->name, pb->name);
+}
+
+static char *   prof_str(
+    char *          out,            /* Output buffer                */
+    const char *    str             /* Name of a macro or a file    */
+)
+/*
+ * Write the string quoted for JSON or CSV, and return the advanced output
+ * pointer.
+ */
+{
+    int     c;
+
+    *out++ = '"';
+    while ((c = *str++ & UCHARMAX) != EOS) {
+        if (prof_json && (c == '"' || c == '\\')) {
+            *out++ = '\\';
+        } else if (prof_json && c < 0x20) {
+            sprintf( out, "\\u%04x", c);
+            out += 6;
+            continue;
+        } else if (c == '"') {                  /* CSV          */
+            *out++ = '"';
+        }
+        *out++ = c;
+    }
+    *out++ = '"';
+    *out = EOS;
+    return  out;
+}
+
+static void prof_put(
+    const char *    str
+)
+/*
+ * Write the string to the report.
+ */
+{
+    if (fp_prof)
+        fputs( str, fp_prof);
+    else
+        mcpp_fputs( str, DBG);
+}
+
 /*
  *  M a c r o   E x p a n s i o n   i n   P R E - S T A N D A R D   M o d e
  */
@@ -2158,6 +3924,7 @@ static char *   expand_prestd(
     int     c;
 
     macro_line = src_line;                  /* Line number for diag.*/
+    scr_release( NULL);             /* Clear the arena left by error*/
     unget_string( identifier, identifier);  /* To re-read           */
     macro_name = defp->name;
     rescan_level = 0;
@@ -2169,12 +3936,12 @@ static char *   expand_prestd(
         goto  err_end;
     }
 
-    while ((c = get_ch()) != CHAR_EOF && infile->fp == NULL) {
+    while ((c = get_ch()) != CHAR_EOF && infile->src == NULL) {
                             /* While the input stream is a macro    */
         while (c == ' ' || c == '\t') {     /* Output the spaces    */
             *mp++ = c;
             c = get_ch();
-            if (infile == NULL || infile->fp != NULL)
+            if (infile == NULL || infile->src != NULL)
                 goto  exp_end;
         }
         token_type = rescan_pre( c, mp, mac_end);   /* Scan token   */
@@ -2234,6 +4001,7 @@ err_end:
     }
     macro_name = NULL;
     clear_exp_mac();
+    recycle_files();
     *pragma_op = FALSE;
     return  out_p;
 }
@@ -2254,7 +4022,7 @@ static int  rescan_pre(
     FILEINFO *  file;
 
     while ((token_type = scan_token( c, &cp, mac_end)) == NAM
-            && (defp = look_id( identifier)) != NULL) { /* Macro    */
+            && (defp = look_token()) != NULL) {  /* Macro    */
         if (replace_pre( defp) == FALSE)
             break;                  /* Macro name with no argument  */
         file = infile;
@@ -2312,11 +4080,11 @@ static int  replace_pre(
                 diag_macro( CWARN, only_name, defp->name, 0L, NULL, defp, NULL);
             return  FALSE;
         } else {
-            arglist_pre[ 0] = xmalloc( (size_t) (NMACWORK + IDMAX * 2));
+            arglist_pre[ 0] = scr_alloc( mac_work + IDMAX * 2);
             arg_len = collect_args( defp, arglist_pre, 0);
                                             /* Collect arguments    */
             if (arg_len == ARG_ERROR) {     /* End of input         */
-                free( arglist_pre[ 0]);
+                scr_release( arglist_pre[ 0]);
                 longjmp( jump, 1);
             }
         }
@@ -2331,7 +4099,7 @@ static int  replace_pre(
     if (mcpp_debug & EXPAND)
         dump_unget( "replace_pre exit");
     if (defp->nargs >= 0)
-        free( arglist_pre[ 0]);
+        scr_release( arglist_pre[ 0]);
     return  TRUE;
 }
 
@@ -2371,7 +4139,8 @@ static void substitute_pre(
     }
 
     *out_p = EOS;
-    file->buffer = xrealloc( file->buffer, strlen( file->buffer) + 1);
+    file->bufsize = strlen( file->buffer) + 1;
+    file->buffer = xrealloc( file->buffer, file->bufsize);
     file->bptr = file->buffer;              /* Truncate buffer      */
     if (mcpp_debug & EXPAND)
         dump_string( "substitute_pre macroline", file->buffer);
@@ -2390,6 +4159,84 @@ nospace:
  *  f o r   S T A N D A R D   a n d   p r e - S T A N D A R D   M o d e s
  */
 
+static char *   scr_alloc(
+    size_t  size
+)
+/*
+ * Allocate a block of 'size' bytes from the scratch arena.
+ * A new chunk is linked only when the following ones are exhausted.
+ */
+{
+    SCR_CHUNK * chunk;
+    char *  block;
+
+    size = SCR_ROUND( size);
+    if (scr_cur == NULL || (size_t) (scr_cur->end - scr_ptr) < size) {
+        chunk = scr_cur ? scr_cur->next : NULL;
+        if (chunk == NULL
+                || (size_t) (chunk->end - (char *) chunk->area) < size) {
+            size_t  c_size = size < SCR_SIZE ? SCR_SIZE : size;
+
+            chunk = (SCR_CHUNK *) xmalloc( sizeof (SCR_CHUNK) + c_size);
+            chunk->end = (char *) chunk->area + c_size;
+            chunk->prev = scr_cur;
+            chunk->next = scr_cur ? scr_cur->next : NULL;
+            if (chunk->next)
+                chunk->next->prev = chunk;
+            if (scr_cur)
+                scr_cur->next = chunk;
+        }
+        scr_cur = chunk;
+        scr_ptr = (char *) chunk->area;
+    }
+    block = scr_ptr;
+    scr_ptr += size;
+    return  block;
+}
+
+static void     scr_trim(
+    char *  block,                  /* The last allocated block     */
+    size_t  size                    /* New size                     */
+)
+/*
+ * Shrink the last allocated block to release the unused area.
+ */
+{
+    scr_ptr = block + SCR_ROUND( size);
+}
+
+static void     scr_release(
+    char *  block
+)
+/*
+ * Release the block and all the blocks allocated after it, or all the blocks
+ * if 'block' is NULL.
+ */
+{
+    if (scr_cur == NULL)
+        return;
+    while (scr_cur->prev && (block == NULL || block < (char *) scr_cur->area
+            || scr_cur->end < block))
+        scr_cur = scr_cur->prev;
+    scr_ptr = block ? block : (char *) scr_cur->area;
+}
+
+static void     scr_free( void)
+/*
+ * Free all the chunks of the arena, which should have been released.
+ */
+{
+    SCR_CHUNK * chunk;
+
+    while (scr_cur && scr_cur->prev)
+        scr_cur = scr_cur->prev;
+    while ((chunk = scr_cur) != NULL) {
+        scr_cur = chunk->next;
+        free( chunk);
+    }
+    scr_ptr = NULL;
+}
+
 static int  collect_args(
     const DEFBUF *  defp,       /* Definition of the macro          */
     char **     arglist,        /* Pointers to actual arguments     */
@@ -2407,7 +4254,7 @@ static int  collect_args(
  * unless stopped by RT_END (provided the "file" is macro).  This is a key
  * trick of STD mode macro expansion.  Meanwhile, POST_STD mode limits the
  * arguments in the "file" (macro or not).
- *   Note: arglist[ n] may be reallocated by collect_args().
+ *   Note: arglist[ n] is shrunk to its used size by collect_args().
  */
 {
     const char *    name = defp->name;
@@ -2421,7 +4268,7 @@ static int  collect_args(
     int     nargs = 0;                  /* Number of collected args */
     int     var_arg = defp->nargs & VA_ARGS;    /* Variable args    */
     int     more_to_come = FALSE;       /* Next argument is expected*/
-    LOCATION *  locs;           /* Location of args in source file  */
+    LOCATION *  locs = NULL;    /* Location of args in source file  */
     LOCATION *  loc;                            /* Current locs     */
     MAGIC_SEQ   mgc_prefix;     /* MAC_INF seqs and spaces preceding an arg */
     int     c;
@@ -2432,9 +4279,9 @@ static int  collect_args(
     if (args == 0)                      /* Need no argument         */
         valid_argp = argp;
     *argp = EOS;                        /* Make sure termination    */
-    arg_end = argp + NMACWORK/2;
+    arg_end = argp + mac_work/2;
     seq = sequence = arg_end + IDMAX;   /* Use latter half of argp  */
-    seq_end = seq + NMACWORK/2;
+    seq_end = seq + mac_work/2;
     seq = stpcpy( seq, name);
     *seq++ = '(';
     if (mcpp_mode == STD) {
@@ -2449,10 +4296,18 @@ static int  collect_args(
                     = (LOCATION *) xmalloc( (sizeof (LOCATION)) * UCHARMAX);
             memset( loc, 0, (sizeof (LOCATION)) * UCHARMAX);
                     /* 0-clear for default values, including empty argument */
+        } else if (map_args) {
+            loc = locs = map_locs;
         }
     }
 
     while (1) {
+        if (locs == map_locs) {
+            if (loc > map_locs + NMACPARS)  /* Excess arguments are */
+                loc = map_locs + NMACPARS;  /*   not recorded       */
+            memset( loc, 0, (sizeof (LOCATION)) * 2);
+                    /* 0-clear this argument and the variable one after */
+        }
         memset( &mgc_prefix, 0, sizeof (MAGIC_SEQ));
         c = squeeze_ws( &seq, NULL
                 , (trace_macro && m_num) ? &mgc_prefix : NULL);
@@ -2466,12 +4321,12 @@ static int  collect_args(
         switch (c) {                    /* First character of token */
         case ')':
             if (! more_to_come) {       /* Zero argument            */
-                if (trace_macro && m_num)
+                if ((trace_macro && m_num) || map_args)
                     loc++;
                 break;
             }                           /* Else fall through        */
         case ',':                       /* Empty argument           */
-            if (trace_macro && m_num)
+            if ((trace_macro && m_num) || map_args)
                 loc++;                  /* Advance pointer to infs  */
             if (warn_level & 2)
                 diag_macro( CWARN, empty_arg, sequence, 0L, NULL, defp, NULL);
@@ -2486,6 +4341,10 @@ static int  collect_args(
             }
             if (++nargs == args)
                 valid_argp = argp;
+            if (c == 0) {               /* End of file or overflow  */
+                nargs = ARG_ERROR;
+                goto  arg_ret;
+            }
             if (c == ',') {
                 more_to_come = TRUE;
                 continue;
@@ -2555,11 +4414,18 @@ static int  collect_args(
         if (c == 0)
             argp++;                     /* Ensure positive length   */
     }
-    arglist[ 0] = argp
-            = xrealloc( arglist[ 0], (size_t) (argp - arglist[ 0]));
+    scr_trim( arglist[ 0], (size_t) (argp - arglist[ 0]));
                                         /* Use memory sparingly     */
+    argp = arglist[ 0];
     for (c = 1; c < args; c++)
         arglist[ c] = argp += strlen( argp) + 1;
+    if (map_args) {
+        map_nargs = (int) (loc - locs);
+        if (map_nargs > NMACPARS)
+            map_nargs = NMACPARS;
+        if (locs != map_locs)           /* Located for tracing, too */
+            memcpy( map_locs, locs, map_nargs * sizeof (LOCATION));
+    }
     if (trace_macro && m_num)
         mac_inf[ m_num].loc_args        /* Truncate excess memory   */
                 = (LOCATION *) xrealloc( (char *) locs
@@ -2596,7 +4462,8 @@ static int  get_an_arg(
  * Get an argument of macro into '*argpp', return the next punctuator.
  * Variable arguments are read as a merged argument.
  * Note: nargs, locp and m_num are used only in macro trace mode of
- * '#pragma MCPP debug macro_call' or -K option.
+ * '#pragma MCPP debug macro_call' or -K option, and locp also by the macro
+ * map of -Y option.
  */
 {
     struct {
@@ -2610,25 +4477,27 @@ static int  get_an_arg(
     char *  prevp;
     char *  argp = *argpp;
     int     trace_arg = 0;                  /* Enable tracing arg   */
+    int     locate_arg = FALSE;     /* Record the location of the arg   */
     LINE_COL    s_line_col, e_line_col; /* Location of macro in an argument */
     MAGIC_SEQ   mgc_seq;        /* Magic seqs and spaces succeeding an arg  */
     size_t  len;
 
+    if (((trace_macro && m_num) || map_args) && infile->src) {
+        locate_arg = TRUE;          /* The macro call is in source  */
+        s_line_col.line = src_line;
+        s_line_col.col = infile->bptr - infile->buffer - 1;
+            /* '-1': bptr is one byte passed beginning of the token */
+        get_src_location( & s_line_col);
+        (*locp)->start_line = s_line_col.line;
+        (*locp)->start_col = s_line_col.col;
+        e_line_col = s_line_col;
+            /* Save the location, also for end of arg in case of empty arg  */
+    }
     if (trace_macro) {
-        trace_arg = m_num && infile->fp;
+        trace_arg = m_num && infile->src;
         if (m_num) {
-            if (trace_arg) {        /* The macro call is in source  */
-                s_line_col.line = src_line;
-                s_line_col.col = infile->bptr - infile->buffer - 1;
-                    /* '-1': bptr is one byte passed beginning of the token */
-                get_src_location( & s_line_col);
-                (*locp)->start_line = s_line_col.line;
-                (*locp)->start_col = s_line_col.col;
-                e_line_col = s_line_col;
-                    /* Save the location,   */
-                    /*      also for end of arg in case of empty arg*/
+            if (trace_arg)
                 memset( n_paren, 0, sizeof (n_paren));
-            }
             *argp++ = MAC_INF;
             *argp++ = MAC_ARG_START;
             *argp++ = (m_num / UCHARMAX) + 1;
@@ -2656,8 +4525,8 @@ static int  get_an_arg(
             s_line_col.line = src_line;     /*      of the token    */
             s_line_col.col = infile->bptr - infile->buffer - 1;
         }
-        token_type = scan_token( c, (prevp = argp, &argp), arg_end);
-                                            /* Scan the next token  */
+        token_type = scan_token( c, (prevp = argp, &argp)
+                , arg_end + IDMAX / 2);     /* Scan the next token  */
         switch (c) {
         case '(':                           /* Worry about balance  */
             paren++;                        /* To know about commas */
@@ -2707,10 +4576,10 @@ static int  get_an_arg(
             return  0;
         default :                           /* Any token            */
             if (mcpp_mode == STD && token_type == NAM
-                    && c != IN_SRC && c != DEF_MAGIC && infile->fp) {
+                    && c != IN_SRC && c != DEF_MAGIC && infile->src) {
                 len = trace_arg ? IN_SRC_LEN : 1;
-                memmove( prevp + len, prevp, (size_t) (argp - prevp));
-                argp += len;
+                memmove( prevp + len, prevp, (size_t) (argp - prevp) + 1);
+                argp += len;                /* Also move the EOS    */
                 *prevp = IN_SRC;
                     /* Mark that the name is read from source file  */
                 if (trace_arg) {
@@ -2722,7 +4591,7 @@ static int  get_an_arg(
                         "Too many names in arguments tracing %s"    /* _E_  */
                                 , defp ? defp->name : null, 0L, NULL);
                         return  0;
-                    } else if (++in_src_num > max_in_src_num) {
+                    } else if (++in_src_num >= max_in_src_num) {
                         size_t  old_len;
                         old_len = sizeof (LOCATION) * max_in_src_num;
                         /* Enlarge the array    */
@@ -2754,9 +4623,15 @@ static int  get_an_arg(
             break;
         }                                   /* End of switch        */
 
+        if (arg_end < argp) {               /* Buffer overflow      */
+            *argp = EOS;
+            if (! retry_exp())
+                cerror( macbuf_overflow, macro_name, 0L, *argpp);
+            return  0;
+        }
         if (end_an_arg)                     /* End of an argument   */
             break;
-        if (trace_arg) {                    /* Save the location    */
+        if (locate_arg) {                   /* Save the location    */
             e_line_col.line = src_line;     /*      before spaces   */
             e_line_col.col = infile->bptr - infile->buffer;
         }
@@ -2773,13 +4648,14 @@ static int  get_an_arg(
     if (mgc_seq.space)
         --argp;                     /* Remove trailing space        */
     if (mcpp_mode == STD) {
+        if (locate_arg) {           /* Location of end of an arg    */
+            get_src_location( & e_line_col);
+            (*locp)->end_line = e_line_col.line;
+            (*locp)->end_col = e_line_col.col;
+        }
+        if ((trace_macro && m_num) || map_args)
+            (*locp)++;      /* Advance pointer even if !locate_arg  */
         if (trace_macro && m_num) {
-            if (trace_arg) {        /* Location of end of an arg    */
-                get_src_location( & e_line_col);
-                (*locp)->end_line = e_line_col.line;
-                (*locp)->end_col = e_line_col.col;
-            }
-            (*locp)++;      /* Advance pointer even if !trace_arg   */
             *argp++ = MAC_INF;
             *argp++ = MAC_ARG_END;
             if (option_flags.v) {
@@ -2822,17 +4698,18 @@ static int  squeeze_ws(
     int     c;
     int     space = 0;
     int     tsep = 0;
-    FILEINFO *      file = infile;
-    FILE *  fp = infile->fp;
+    long    serial = infile->serial;    /* The text or the file     */
+    char *  src = infile->src;
     int     end_of_file = (out && endf) ? FALSE : TRUE;
 
     while (((char_type[ c = get_ch()] & SPA) && (! standard 
-                || (mcpp_mode == POST_STD && file == infile)
+                || (mcpp_mode == POST_STD && in_text( serial))
                 || (mcpp_mode == STD
                     && ((macro_line != 0 && macro_line != MACRO_ERROR)
-                        || file == infile))))
+                        || in_text( serial)))))
             || c == MAC_INF) {
-        if (! end_of_file && file != infile) {  /* Infile has been read over*/
+        if (! end_of_file && ! in_text( serial)) {
+                                        /* Infile has been read over*/
             *endf = *out;               /* Remember the location    */
             end_of_file = TRUE;
         }
@@ -2909,11 +4786,11 @@ static int  squeeze_ws(
             *(*out)++ = TOK_SEP;
         **out = EOS;
     }
-    if (mcpp_mode == POST_STD && file != infile) {
+    if (mcpp_mode == POST_STD && ! in_text( serial)) {
         unget_ch();             /* Arguments cannot cross "file"s   */
-        c = fp ? CHAR_EOF : RT_END; /* EOF is diagnosed by at_eof() */
+        c = src ? CHAR_EOF : RT_END;    /* EOF is diagnosed by at_eof() */
     } else if (mcpp_mode == STD && macro_line == MACRO_ERROR
-            && file != infile) {            /* EOF                  */
+            && ! in_text( serial)) {        /* EOF                  */
         unget_ch();             /*   diagnosed by at_eof() or only  */
         c = CHAR_EOF;           /*   name of a function-like macro. */
     }                       /* at_eof() resets macro_line on error  */
@@ -2927,9 +4804,9 @@ static void skip_macro( void)
 {
     if (infile == NULL)                     /* End of input         */
         return;
-    if (infile->fp)                         /* Source file          */
+    if (infile->src)                        /* Source file          */
         return;
-    while (infile->fp == NULL) {            /* Stacked stuff        */
+    while (infile->src == NULL) {           /* Stacked stuff        */
         infile->bptr += strlen( infile->bptr);
         get_ch();                           /* To the parent "file" */
     }
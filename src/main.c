@@ -91,10 +91,13 @@
  * identifier   holds the last identifier scanned (which might be a candidate
  *              for macro expansion).
  * errors       is the running mcpp error counter.
+ * diag_count   is the count of all the diagnostics issued so far.
+ * macro_gen    is incremented whenever a macro is defined, undefined, pushed
+ *              or popped, to invalidate the cached expansions.
  * infile       is the head of a linked list of input files (extended by
  *              #include and macros being expanded).  'infile' always points
  *              to the current file/macro.  'infile->parent' to the includer,
- *              etc.  'infile->fp' is NULL if this input stream is not a file.
+ *              etc.  'infile->src' is NULL if this input stream is not a file.
  * inc_dirp     Directory of #includer with trailing PATH_DELIM.  This points
  *              to one of incdir[] or to the current directory (represented as
  *              "".  This should not be NULL.
@@ -103,6 +106,8 @@
     int         wrong_line;         /* Force #line to compiler      */
     int         newlines;           /* Count of blank lines         */
     int         errors = 0;         /* Cpp error counter            */
+    long        diag_count = 0L;    /* Count of diagnostics issued  */
+    long        macro_gen = 0L;     /* Generation of macro table    */
     int         warn_level = -1;    /* Level of warning (have to initialize)*/
     FILEINFO *  infile = NULL;      /* Current input file           */
     int         include_nest = 0;   /* Nesting level of #include    */
@@ -114,6 +119,7 @@
         /* Full path of current source file (i.e. infile->full_fname)       */
     int         no_source_line;     /* Do not output line in diag.  */
     char        identifier[ IDMAX + IDMAX/8];       /* Current identifier   */
+    TOKENINFO   cur_token;          /* Record of the last token     */
     int         mcpp_debug = 0;     /* != 0 if debugging now        */
 
 /*
@@ -211,6 +217,11 @@
     FILE *  fp_out;                 /* Output stream preprocessed   */
     FILE *  fp_err;                 /* Diagnostics stream           */
     FILE *  fp_debug;               /* Debugging information stream */
+    FILE *  fp_mac_map;             /* Macro map by -Y option       */
+    FILE *  fp_src_map;             /* Source map by -L option      */
+    long    out_offset;     /* Bytes put out to OUT, for -Y and -L  */
+    long    out_line;               /* Lines put out to OUT, for -L */
+    long    out_line_top;   /* Offset of the current output line, for -L */
 
 /* Variables on multi-byte character encodings. */
     int     mbchar = MBCHAR;        /* Encoding of multi-byte char  */
@@ -257,6 +268,20 @@
  */
 static int      src_col = 0;        /* Column number of source line */
 
+/*
+ * output[] and out_ptr are used for:
+ *      buffer to store preprocessed line (this line is put out or handed to
+ *      post_preproc() via putout() in some cases)
+ * output[] is allocated NMACWORK bytes at first, and enlarged by
+ * grow_output() when a macro expansion does not fit in it.
+ */
+static char *   output = NULL;      /* Buffer for preprocessed line */
+static size_t   output_size;        /* Allocated size of output[]   */
+static char *   out_end;
+                /* Limit of output line for other than GCC and VC   */
+static char *   out_wend;           /* Buffer end of output line    */
+static char *   out_ptr;            /* Current pointer into output[]*/
+
 #define MBCHAR_IS_ESCAPE_FREE   (SJIS_IS_ESCAPE_FREE && \
             BIGFIVE_IS_ESCAPE_FREE && ISO2022_JP_IS_ESCAPE_FREE)
 
@@ -359,6 +384,8 @@ int     main
     fp_out = stdout;
     fp_err = stderr;
     fp_debug = stdout;
+    fp_mac_map = fp_src_map = NULL;
+    out_offset = out_line = out_line_top = 0L;
         /*
          * Debugging information is output to stdout in order to
          *      synchronize with preprocessed output.
@@ -366,8 +393,9 @@ int     main
 
     inc_dirp = &null;   /* Initialize to current (null) directory   */
     cur_fname = cur_fullname = "(predefined)";  /* For predefined macros    */
-    init_defines();                         /* Predefine macros     */
     mb_init();      /* Should be initialized prior to get options   */
+                    /*   and to predefine macros to be tokenized    */
+    init_defines();                         /* Predefine macros     */
     do_options( argc, argv, &in_file, &out_file);   /* Command line options */
 
     /* Open input file, "-" means stdin.    */
@@ -411,6 +439,7 @@ int     main
     init_sys_macro();       /* Initialize system-specific macros    */
     add_file( fp_in, NULL, in_file, in_file, FALSE);
                                         /* "open" main input file   */
+    fp_in = NULL;                       /* add_file() has closed it */
     infile->dirp = inc_dirp;
     infile->sys_header = FALSE;
     cur_fullname = in_file;
@@ -425,6 +454,11 @@ int     main
     at_end();                       /* Do the final commands        */
 
 fatal_error_exit:
+    if (fp_mac_map)
+        close_mac_map();
+    if (fp_src_map)
+        close_src_map();
+    put_profile();                  /* Report of the macro profile  */
 #if MCPP_LIB
     /* Free malloced memory */
     if (mcpp_debug & MACRO_CALL) {
@@ -433,9 +467,12 @@ fatal_error_exit:
     }
     clear_filelist();
     clear_symtable();
+    free_file_pool();
+    free( output);
+    output = NULL;
 #endif
 
-    if (fp_in != stdin)
+    if (fp_in != NULL && fp_in != stdin)
         fclose( fp_in);
     if (fp_out != stdout)
         fclose( fp_out);
@@ -580,18 +617,6 @@ void    un_predefine(
     }
 }
 
-/*
- * output[] and out_ptr are used for:
- *      buffer to store preprocessed line (this line is put out or handed to
- *      post_preproc() via putout() in some cases)
- */
-static char     output[ NMACWORK];  /* Buffer for preprocessed line */
-static char * const out_end = & output[ NWORK - 2];
-                /* Limit of output line for other than GCC and VC   */
-static char * const out_wend = & output[ NMACWORK - 2];
-                                    /* Buffer end of output line    */
-static char *       out_ptr;        /* Current pointer into output[]*/
-
 static void mcpp_main( void)
 /*
  * Main process for mcpp -- copies tokens from the current input stream
@@ -607,6 +632,12 @@ static void mcpp_main( void)
     keep_comments = option_flags.c && !no_output;
     keep_spaces = option_flags.k;       /* Will be turned off if !compiling */
     line_col.col = line_col.line = 0L;
+    if (output == NULL) {
+        output_size = NMACWORK;
+        output = xmalloc( output_size);
+        out_end = output + NWORK - 2;
+        out_wend = output + output_size - 2;
+    }
 
     /*
      * This loop is started "from the top" at the beginning of each line.
@@ -623,6 +654,7 @@ static void mcpp_main( void)
 
         while (1) {                         /* For each line, ...   */
             out_ptr = output;               /* Top of the line buf  */
+            recycle_files();                /* No "file" is watched */
             c = get_ch();
             if (src_col)
                 break;  /* There is a residual tokens on the line   */
@@ -666,6 +698,8 @@ static void mcpp_main( void)
 
         if (c == CHAR_EOF)                  /* Exit process at      */
             break;                          /*   end of input       */
+        if (infile->guard_state != GUARD_IN)
+            infile->guard_state = GUARD_NONE;   /* Token out of guard   */
 
         /*
          * If the loop didn't terminate because of end of file, we
@@ -699,9 +733,12 @@ static void mcpp_main( void)
              */
             int     has_pragma;
 
-            if ((mcpp_debug & MACRO_CALL) && ! in_directive) {
+            if (((mcpp_debug & MACRO_CALL) || fp_mac_map || fp_src_map)
+                    && ! in_directive) {
                 line_col.line = src_line;       /* Location in source   */
                 line_col.col = infile->bptr - infile->buffer - 1;
+                if (fp_src_map)
+                    map_token( out_ptr - output, line_col);
             }
             if (scan_token( c, (wp = out_ptr, &wp), out_wend) == NAM
                     && (defp = is_macro( &wp)) != NULL) {   /* A macro  */
@@ -714,8 +751,12 @@ static void mcpp_main( void)
                     memmove( out_ptr, tp, strlen( tp) + 1);
                     wp -= (tp - out_ptr);
                 }
+                if ((fp_mac_map || fp_src_map) && ! has_pragma)
+                    map_output( out_ptr - output, wp - output);
                 if (has_pragma) {           /* Found _Pramga()      */
                     do_pragma_op();         /* Do _Pragma() operator*/
+                    if (fp_mac_map || fp_src_map)
+                        put_map_out( NULL); /* Discard the rest of spans*/
                     out_ptr = output;       /* Do the rest of line  */
                     wrong_line = TRUE;      /* Line-num out of sync */
                 } else {
@@ -743,6 +784,40 @@ static void mcpp_main( void)
     }                                       /* Continue until EOF   */
 }
 
+char *  grow_output(
+    char *  out,                    /* Output pointer               */
+    size_t  len,                    /* Length to be written         */
+    char ** out_endp                /* Limit of the output          */
+)
+/*
+ * Enlarge output[] so that 'len' bytes and the rest of the line can be
+ * written at 'out', if 'out' points into output[].  Set the new limit to
+ * '*out_endp' and return the moved 'out', or return NULL if 'out' is not in
+ * output[].  out_ptr is moved together.
+ */
+{
+    size_t  offset;
+    size_t  size;
+
+    if (output == NULL || out < output || out_wend < out)
+        return  NULL;                       /* Other buffer         */
+    offset = out - output;
+    size = output_size;
+    while (size - 2 < offset + len + NWORK)
+        size *= 2;
+    if (size != output_size) {
+        size_t  ptr_offset = out_ptr - output;
+
+        output = xrealloc( output, size);
+        output_size = size;
+        out_end = output + NWORK - 2;
+        out_wend = output + output_size - 2;
+        out_ptr = output + ptr_offset;
+    }
+    *out_endp = out_wend;
+    return  output + offset;
+}
+
 static void do_pragma_op( void)
 /*
  * Execute the _Pragma() operator contained in an expanded macro.
@@ -872,6 +947,8 @@ static void putout(
         post_preproc( out);
 #endif
     /* Else no post-preprocess  */
+    if (fp_mac_map || fp_src_map)
+        put_map_out( no_output ? NULL : out);
 #if COMPILER != GNUC && COMPILER != MSC
     /* GCC and Visual C can accept very long line   */
     len = strlen( out);
@@ -959,7 +1036,7 @@ static void put_a_line(
         return;
     len = strlen( out);
     tp = out_p = out + len - 2;             /* Just before '\n'     */
-    while (char_type[ *out_p & UCHARMAX] & SPA)
+    while (out <= out_p && (char_type[ *out_p & UCHARMAX] & SPA))
         out_p--;                    /* Remove trailing white spaces */
     if (out_p < tp) {
         *++out_p = '\n';
@@ -50,14 +50,20 @@
  *              returns the advanced output pointer.
  * get_ch()     Reads the next byte from the current input stream, handling
  *              end of (macro/file) input and embedded comments appropriately.
+ * mcpp_fgets() Reads the next physical line from the text of source file.
+ * index_lines()    Makes the index of physical lines of source file.
  * cnv_trigraph()   Maps trigraph sequence to C character.
  * cnv_digraph()    Maps digraph sequence to C character.
  * id_operator()    See whether the identifier is an operator in C++.
  * unget_ch()   Pushs last gotten character back on the input stream.
  * unget_string()   Pushs sequence on the input stream.
+ * push_text()  Stacks a text of macro expansion on the input stream.
+ * insert_text()    Inserts a sequence into the text stacked last.
  * save_string() Saves a string in malloc() memory.
  * get_file()   Initializes a new FILEINFO structure, called when #include
  *              opens a new file, or from unget_string().
+ * free_file()  Releases a FILEINFO structure to the pool.
+ * recycle_files()  Makes the released FILEINFO structures reusable.
  * xmalloc()    Gets a specified number of bytes from heap memory.
  *              If malloc() returns NULL, exits with a message.
  * xrealloc()   realloc().  If it fails, exits with a message.
@@ -77,6 +83,10 @@
 #include    "internal.H"
 #endif
 
+#if HOST_HAVE_SSE2
+#include    <emmintrin.h>
+#endif
+
 static void     scan_id( int c);
                 /* Scan an identifier           */
 static char *   scan_number( int c, char * out, char * out_end);
@@ -91,21 +101,49 @@ static char *   scan_op( int c, char * out);
                 /* Scan an operator or a punctuator     */
 static char *   parse_line( void);
                 /* Parse a logical line and convert comments    */
+static char *   parse_a_line( char * temp);
+                /* Parse a logical line into the work buffer    */
+static char *   skip_plain( char * sp, const char * end, int hsp);
+                /* Skip a run of ordinary characters            */
 static char *   read_a_comment( char * sp, size_t * sizp);
                 /* Read over a comment          */
 static char *   get_line( int in_comment);
                 /* Get a logical line from file, handle line-splicing   */
+static size_t   line_flags( const char * end, const char * top);
+                /* Flags of a line for the index of lines       */
+static size_t   pair_flags( const char * cp, const char * end, size_t want);
+                /* Find trigraph and digraph for the index      */
+static size_t   read_src_line( char * s, int size, FILEINFO * file
+        , int * flagp);
+                /* Copy a physical line with the flags of the line      */
+static void     skip_lines( void);
+                /* Skip plain lines in skipped group at a time  */
+static char *   skip_text( char * cp, const char * end, int * in_comment
+        , int * at_top);
+                /* Skip a physical line for skip_lines()        */
 static char *   at_eof( int in_comment);
                 /* Check erroneous end of file  */
 static void     do_msg( const char * severity, const char * format
         , const char * arg1, long arg2, const char * arg3);
                 /* Putout diagnostic message    */
+static void     free_exp_mac( void);
+                /* Free the names of macros     */
 static char *   cat_line( int del_bsl);
                 /* Splice the line              */
 static void     put_line( char * out, FILE * fp);
                 /* Put out a logical line       */
 static void     dump_token( int token_type, const char * cp);
                 /* Dump a token and its type    */
+static const char *     text_name( const FILEINFO * file, int i);
+                /* Name of the macro of a text  */
+static char *   get_buf( size_t size, size_t * sizp);
+                /* Get a buffer from the pool   */
+static void     put_buf( char * buf, size_t size);
+                /* Return a buffer to the pool  */
+static void     text_room( FILEINFO * file, size_t len);
+                /* Make room to stack a text    */
+static void     count_out( const char * s, size_t len);
+                /* Count bytes and lines put out*/
 
 #define EXP_MAC_IND_MAX     16
 /* Information of current expanding macros for diagnostic   */
@@ -114,10 +152,54 @@ static struct {
     int             to_be_freed;    /* Name should be freed later   */
 } expanding_macro[ EXP_MAC_IND_MAX];
 static int  exp_mac_ind = 0;        /* Index into expanding_macro[] */
+/* Names registered while an argument is expanded at the first time, to be */
+/* registered again where the expansion is reused (see substitute()).       */
+static char *   exp_log = NULL;     /* Names separated by EOS       */
+static size_t   exp_log_len = 0;    /* Current length of exp_log    */
+static size_t   exp_log_max = 0;    /* Allocated size of exp_log    */
+static int      exp_logging = 0;    /* Nesting level of logging     */
+
+/*
+ * Pools of FILEINFO records and of their buffers.  unget_string() is called
+ * so many times in macro expansion of pre-Standard modes, and the "file" of
+ * push_text() is made at each macro call on the source, so that malloc()
+ * and free() of them cost much.  Some routines compare a FILEINFO pointer
+ * saved beforehand to 'infile' to know whether the "file" has been read
+ * over, hence a released record is not reused until recycle_files() is
+ * called where no routine keeps a pointer to a record.  Buffers are reused
+ * at once, sorted into the size classes of BUF_CLASS_MIN times powers of 2.
+ */
+#define BUF_CLASS_MIN   0x40            /* Size of the smallest class   */
+#define NUM_BUF_CLASS   11              /* Up to BUF_CLASS_MIN << 10    */
+#define TEXT_BUF_INIT   (BUF_CLASS_MIN << 6)    /* Buffer of push_text()*/
+#define TEXT_SEGS_INIT  0x40            /* Initial elements of segs[]   */
+static FILEINFO *   file_pool = NULL;   /* Reusable records linked by   */
+                                        /*   'parent'                   */
+static FILEINFO *   file_released = NULL;   /* Released records waiting */
+                                        /*   for recycle_files()        */
+static char *   buf_pool[ NUM_BUF_CLASS];   /* Reusable buffers linked  */
+                                        /*   by their first bytes       */
+static long     file_serial = 0L;       /* Serial number of the records */
+static long     num_files;              /* Number of records allocated  */
+static long     num_files_reused;       /* Number of records reused     */
+static long     num_bufs;               /* Number of buffers allocated  */
+static long     num_bufs_reused;        /* Number of buffers reused     */
+static long     num_xmalloc;            /* Number of calls of xmalloc() */
+static long     num_xrealloc;           /* Number of calls of xrealloc()*/
 
 static int  in_token = FALSE;       /* For token scanning functions */
+/*
+ * No token crosses "file"s in Standard mode (see get_ch()), hence the token
+ * scanning functions read the buffer directly while 'in_token' is set.
+ */
+#define get_tch()       (in_token ? (*infile->bptr++ & UCHARMAX) : get_ch())
+#define unget_tch()     (in_token ? (void) infile->bptr-- : unget_ch())
 static int  in_string = FALSE;      /* For get_ch() and parse_line()*/
 static int  squeezews = FALSE;
+static char parse_buf[ NBUFF + 1];
+        /* Work buffer of parse_line().  parse_buf[ 0] is always EOS, so */
+        /* that *(tp - 1) is safely referred at the top of a line.      */
+static int  parse_depth = 0;        /* Nesting of parse_line()      */
 
 #define MAX_CAT_LINE    256
 /* Information on line catenated by <backslash><newline>    */
@@ -133,14 +215,35 @@ static CAT_LINE bsl_cat_line;
 static CAT_LINE com_cat_line;
         /* Datum on the last catenated line by a line-crossing comment  */
 
+/*
+ * Read position of the source file at the start of a macro expansion.  It is
+ * saved when the macro call reads over the lines, so that the expansion can
+ * be done over again from the start (see mark_src()).
+ */
+static struct {
+    FILEINFO *  file;           /* 'infile' marked, or NULL         */
+    char *      text;           /* Copy of the buffer, or NULL      */
+    char *      src_ptr;        /* file->src_ptr                    */
+    size_t *    lptr;           /* file->lptr                       */
+    long        line;           /* src_line                         */
+    long        reread;         /* Last line read before rewinding  */
+    CAT_LINE    bsl;            /* bsl_cat_line                     */
+    CAT_LINE    com;            /* com_cat_line                     */
+} src_mark;
+static void     save_src_mark( void);
+
 #if MCPP_LIB
 static int  use_mem_buffers = FALSE;
 
 void    init_support( void)
 {
     in_token = in_string = squeezews = FALSE;
+    parse_depth = 0;
+    mark_src( FALSE);
     bsl_cat_line.len[ 0] = com_cat_line.len[ 0] = 0;
     clear_exp_mac();
+    num_files = num_files_reused = num_bufs = num_bufs_reused = 0L;
+    num_xmalloc = num_xrealloc = 0L;
 }
 
 typedef struct  mem_buf {
@@ -263,11 +366,33 @@ char *  mcpp_get_mem_buffer(
  * function call - i.e. mcpp_lib_main().
  */
 
+static void count_out(
+    const char *    s,
+    size_t  len
+)
+/*
+ * Count the bytes and lines put out to OUT for the maps of -Y and -L options.
+ */
+{
+    const char *    cp = s;
+
+    while ((cp = memchr( cp, '\n', len - (cp - s))) != NULL) {
+        out_line++;
+        out_line_top = out_offset + (++cp - s);
+    }
+    out_offset += len;
+}
+
 int    mcpp_lib_fputc(
     int     c,
     OUTDEST od
 )
 {
+    if (od == OUT && (fp_mac_map || fp_src_map)) {
+        char    ch = c;
+
+        count_out( &ch, 1);
+    }
 #if MCPP_LIB
     if (use_mem_buffers) {
         return mem_putc( c, od);
@@ -288,6 +413,8 @@ int    mcpp_lib_fputs(
     OUTDEST od
 )
 {
+    if (od == OUT && (fp_mac_map || fp_src_map))
+        count_out( s, strlen( s));
 #if MCPP_LIB
     if (use_mem_buffers) {
         return mem_puts( s, od);
@@ -318,8 +445,15 @@ int    mcpp_lib_fprintf(
         int rc;
 
         va_start( ap, format);
+        if (od == OUT && (fp_mac_map || fp_src_map)) {
+            static char     out_buffer[ NWORK];
+
+            /* Put out by mcpp_lib_fputs() to count the bytes and lines */
+            rc = vsprintf( out_buffer, format, ap);
+            if (rc > 0 && mcpp_lib_fputs( out_buffer, od) == EOF)
+                rc = EOF;
 #if MCPP_LIB
-        if (use_mem_buffers) {
+        } else if (use_mem_buffers) {
             static char     mem_buffer[ NWORK];
 
             rc = vsprintf( mem_buffer, format, ap);
@@ -327,12 +461,10 @@ int    mcpp_lib_fprintf(
             if (rc != 0) {
                 rc = mem_puts( mem_buffer, od);
             }
-        } else {
 #endif
+        } else {
             rc = vfprintf( stream, format, ap);
-#if MCPP_LIB
         }
-#endif
         va_end( ap);
 
         return rc;
@@ -378,17 +510,17 @@ int     get_unexpandable(
 {
     DEFBUF *    defp = NULL;
     FILEINFO *  file;
-    FILE *  fp = NULL;
+    char *  src = NULL;
     LINE_COL    line_col = { 0L, 0};
     int     token_type = NO_TOKEN;
     int     has_pragma;
 
     while (c != EOS && c != '\n'                /* In a line        */
-            && (fp = infile->fp         /* Preserve current state   */
+            && (src = infile->src       /* Preserve current state   */
                 , (token_type
                     = scan_token( c, (workp = work_buf, &workp), work_end))
                     == NAM)                     /* Identifier       */
-            && fp != NULL                       /* In source !      */
+            && src != NULL                      /* In source !      */
             && (defp = is_macro( NULL)) != NULL) {      /* Macro    */
         expand_macro( defp, work_buf, work_end, line_col, & has_pragma);
                                                 /* Expand macro     */
@@ -411,7 +543,7 @@ int     get_unexpandable(
         return  NO_TOKEN;
     }
 
-    if (diag && fp == NULL && defp && (warn_level & 1)) {
+    if (diag && src == NULL && defp && (warn_level & 1)) {
         char    tmp[ NWORK + 16];
         char *  tmp_end = tmp + NWORK;
         char *  tmp_p;
@@ -454,7 +586,7 @@ void    skip_nl( void)
  */
 {
     insert_sep = NO_SEP;
-    while (infile && infile->fp == NULL) {  /* Stacked text         */
+    while (infile && infile->src == NULL) { /* Stacked text         */
         infile->bptr += strlen( infile->bptr);
         get_ch();                           /* To the parent        */
     }
@@ -489,6 +621,8 @@ int     scan_token(
  * is advanced.  Token is terminated by EOS.  Return the type of token.
  *   If the token is an identifier, the token is also in identifier[].
  *   If the token is a operator or punctuator, return OPE.
+ *   The type, the span in the output buffer, the hash value (of identifier)
+ * and the operator code of the token are recorded in cur_token.
  *   If 'c' is token separator, then return SEP.
  *   If 'c' is not the first character of any known token and not a token
  * separator, return SPE.
@@ -500,6 +634,8 @@ int     scan_token(
     int     ch_type;                    /* Type of character        */
     int     token_type = 0;             /* Type of token            */
     int     ch;
+    unsigned    hash;                   /* Hash value of identifier */
+    const char *    np;
 
     if (standard)
         in_token = TRUE;                /* While a token is scanned */
@@ -512,7 +648,7 @@ int     scan_token(
         case 'L':
             if (! standard)
                 goto  ident;
-            ch = get_ch();
+            ch = get_tch();
             if (char_type[ ch] & QUO) { /* char_type[ ch] == QUO    */
                 if (ch == '"')
                     token_type = WSTR;  /* Wide-char string literal */
@@ -522,12 +658,17 @@ int     scan_token(
                 *out++ = 'L';
                 break;                  /* Fall down to "case QUO:" */
             } else {
-                unget_ch();
+                unget_tch();
             }                           /* Fall through             */
         default:                        /* An identifier            */
 ident:
             scan_id( c);
-            out = stpcpy( out, identifier);
+            /* Copy the name, computing the hash value to intern it */
+            for (hash = 0, np = identifier; (*out = *np) != EOS; np++, out++)
+                hash = ATOM_HASH( hash, *np);
+            cur_token.hash = hash;
+            cur_token.atom = intern_id( identifier
+                    , (size_t) (np - identifier), hash);
             token_type = NAM;
             break;
         }
@@ -544,8 +685,8 @@ ident:
         }   /* Else WSTR or WCHR    */
         break;
     case DOT:
-        ch = get_ch();
-        unget_ch();
+        ch = get_tch();
+        unget_tch();
         if ((char_type[ ch] & DIG) == 0)        /* Operator '.' or '...'    */
             goto  operat;
         /* Else fall through    */
@@ -561,8 +702,8 @@ operat: out = scan_op( c, out);         /* Operator or punctuator   */
     default:                /* Special tokens or special characters */
 #if OK_UCN
         if (mcpp_mode == STD && c == '\\' && stdc2) {
-            ch = get_ch();
-            unget_ch();
+            ch = get_tch();
+            unget_tch();
             if (ch == 'U' || ch == 'u')
                 goto  ident;            /* Universal-Characte-Name  */
         }
@@ -592,7 +733,11 @@ operat: out = scan_op( c, out);         /* Operator or punctuator   */
                 , *out_pp, 0L, NULL);
     if (mcpp_debug & TOKEN)
         dump_token( token_type, *out_pp);
-    if (mcpp_mode == POST_STD && token_type != SEP && infile->fp != NULL
+    cur_token.type = token_type;
+    cur_token.ptr = *out_pp;
+    cur_token.len = out ? (size_t) (out - *out_pp) : 0;
+    cur_token.openum = (token_type == OPE) ? openum : 0;
+    if (mcpp_mode == POST_STD && token_type != SEP && infile->src != NULL
             && (char_type[ *infile->bptr & UCHARMAX] & SPA) == 0)
         insert_sep = INSERT_SEP;    /* Insert token separator       */
     *out_pp = out;
@@ -623,10 +768,10 @@ static void scan_id(
     if (c == IN_SRC) {                  /* Magic character  */
         *bp++ = c;
         if ((mcpp_debug & MACRO_CALL) && ! in_directive) {
-            *bp++ = get_ch();           /* Its 2-bytes      */
-            *bp++ = get_ch();           /*      argument    */
+            *bp++ = get_tch();          /* Its 2-bytes      */
+            *bp++ = get_tch();          /*      argument    */
         }
-        c = get_ch();
+        c = get_tch();
     }
 
     do {
@@ -637,12 +782,12 @@ static void scan_id(
             int     cnt;
             char *  tp = bp;
             
-            if ((c = get_ch()) == 'u') {
+            if ((c = get_tch()) == 'u') {
                 cnt = 4;
             } else if (c == 'U') {
                 cnt = 8;
             } else {
-                unget_ch();
+                unget_tch();
                 bp--;
                 break;
             }
@@ -662,7 +807,7 @@ static void scan_id(
         if (mcpp_mode == STD && (char_type[ c] & mbchk) && stdc3) {
             len = mb_read( c, &infile->bptr, &bp);
             if (len & MB_ERROR) {
-                if (infile->fp)
+                if (infile->src)
                     cerror(
                     "Illegal multi-byte character sequence."    /* _E_  */
                             , NULL, 0L, NULL);
@@ -674,7 +819,19 @@ static void scan_id(
 #if OK_UCN
 next_c:
 #endif
-        c = get_ch();
+        if (in_token) {
+            /* Read the run of letters and digits directly on the buffer */
+            char *  sp = infile->bptr;
+
+            while ((char_type[ c = *sp++ & UCHARMAX] & (LET | DIG))
+                    && (char_type[ c] & mbchk) == 0) {
+                if (bp < limit)
+                    *bp++ = c;
+            }
+            infile->bptr = sp;
+        } else {
+            c = get_tch();
+        }
     } while ((char_type[ c] & (LET | DIG))      /* Letter or digit  */
 #if OK_UCN
             || (mcpp_mode == STD && c == '\\' && stdc2)
@@ -684,7 +841,7 @@ next_c:
 #endif
         );
 
-    unget_ch();
+    unget_tch();
     *bp = EOS;
 
     if (bp >= limit && (warn_level & 1))        /* Limit of token   */
@@ -702,7 +859,7 @@ next_c:
     if (mcpp_mode == STD)
         len -= mb;
 #endif
-    if (standard && infile->fp && len > std_limits.id_len && (warn_level & 4))
+    if (standard && infile->src && len > std_limits.id_len && (warn_level & 4))
         cwarn( "Identifier longer than %.0s%ld characters \"%s\""   /* _W4_ */
                 , NULL, (long) std_limits.id_len, identifier);
 #endif  /* IDMAX > IDLEN90MIN   */
@@ -747,7 +904,7 @@ char *  scan_quote(
         delim = '>';
 
 scan:
-    while ((c = get_ch()) != EOS) {
+    while ((c = get_tch()) != EOS) {
 
 #if MBCHAR
         if (char_type[ c] & mbchk) {
@@ -755,7 +912,7 @@ scan:
             char *  bptr = infile->bptr;
             len = mb_read( c, &infile->bptr, (*out_p++ = c, &out_p));
             if (len & MB_ERROR) {
-                if (infile->fp != NULL && compiling && diag) {
+                if (infile->src != NULL && compiling && diag) {
                     if (warn_level & 1) {
                         char *  buf;
                         size_t  chlen;
@@ -783,7 +940,7 @@ scan:
                 char *      tp;
 
                 *out_p++ = c;
-                if ((c = get_ch()) == 'u') {
+                if ((c = get_tch()) == 'u') {
                     cnt = 4;
                 } else if (c == 'U') {
                     cnt = 8;
@@ -798,12 +955,12 @@ scan:
             }
 #endif  /* OK_UCN   */
             *out_p++ = c;                   /* Escape sequence      */
-            c = get_ch();
+            c = get_tch();
 escape:
 #if MBCHAR
             if (char_type[ c] & mbchk) {
                                 /* '\\' followed by multi-byte char */
-                unget_ch();
+                unget_tch();
                 continue;
             }
 #endif
@@ -811,10 +968,10 @@ escape:
                 out_p--;                    /* Splice the lines     */
                 if (cat_line( TRUE) == NULL)        /* End of file  */
                     break;
-                c = get_ch();
+                c = get_tch();
             }
         } else if (mcpp_mode == POST_STD && c == ' ' && delim == '>'
-                && infile->fp == NULL) {
+                && infile->src == NULL) {
             continue;   /* Skip space possibly inserted by macro expansion  */
         } else if (c == '\n') {
             break;
@@ -833,12 +990,12 @@ chk_limit:
     }
 
     if (c == '\n' || c == EOS)
-        unget_ch();
+        unget_tch();
     if (c == delim)
         *out_p++ = delim;
     *out_p = EOS;
     if (diag) {                         /* At translation phase 3   */
-        skip = (infile->fp == NULL) ? NULL : skip_line;
+        skip = (infile->src == NULL) ? NULL : skip_line;
         if (c != delim) {
             if (mcpp_mode == OLD_PREP   /* Implicit closing of quote*/
                     && (delim == '"' || delim == '\''))
@@ -958,22 +1115,22 @@ static char *   scan_number(
                 || (stdc3 && (c == 'P' || c == 'p'))
                                             /* 'P' or 'p'.          */
                 ) {
-            c = get_ch();
+            c = get_tch();
             if (c == '+' || c == '-') {
                 *out_p++ = c;
-                c = get_ch();
+                c = get_tch();
             }
 #if OK_UCN
         } else if (mcpp_mode == STD && c == '\\' && stdc3) {
             int     cnt;
             char *  tp;
 
-            if ((c = get_ch()) == 'u') {
+            if ((c = get_tch()) == 'u') {
                 cnt = 4;
             } else if (c == 'U') {
                 cnt = 8;
             } else {
-                unget_ch();
+                unget_tch();
                 out_p--;
                 break;
             }
@@ -982,20 +1139,20 @@ static char *   scan_number(
                 break;
             else
                 out_p = tp;
-            c = get_ch();
+            c = get_tch();
 #endif  /* OK_UCN   */
 #if OK_MBIDENT
         } else if (mcpp_mode == STD && (char_type[ c] & mbchk) && stdc3) {
             len = mb_read( c, &infile->bptr, &out_p);
             if (len & MB_ERROR) {
-                if (infile->fp)
+                if (infile->src)
                     cerror(
                     "Illegal multi-byte character sequence."    /* _E_  */
                             , NULL, 0L, NULL);
             }
 #endif  /* OK_MBIDENT   */
         } else {
-            c = get_ch();
+            c = get_tch();
         }
     } while ((char_type[ c] & (DIG | DOT | LET))    /* Digit, dot or letter */
 #if OK_UCN
@@ -1010,7 +1167,7 @@ static char *   scan_number(
     if (out_end < out_p)
         cfatal( "Too long pp-number token \"%s\""           /* _F_  */
                 , out, 0L, NULL);
-    unget_ch();
+    unget_tch();
     return  out_p;
 }
 
@@ -1154,13 +1311,13 @@ static char *   scan_ucn(
 
     value = 0L;
     for (i = 0; i < cnt; i++) {
-        c = get_ch();
+        c = get_tch();
         if (! isxdigit( c)) {
-            if (infile->fp)
+            if (infile->src)
                 cerror( "Illegal UCN sequence"              /* _E_  */
                         , NULL, 0L, NULL);
                 *out = EOS;
-                unget_ch();
+                unget_tch();
                 return  NULL;
         }
         c = tolower( c);
@@ -1168,7 +1325,7 @@ static char *   scan_ucn(
         c = (isdigit( c) ? (c - '0') : (c - 'a' + 10));
         value = (value << 4) | c;
     }
-    if (infile->fp                              /* In source        */
+    if (infile->src                             /* In source        */
             && ((value >= 0L && value <= 0x9FL
                 && value != 0x24L && value != 0x40L && value != 0x60L)
                                     /* Basic source character       */
@@ -1214,7 +1371,7 @@ static char *   scan_op(
         return  out;
     }
 
-    c2 = get_ch();                      /* Possibly two bytes ops   */
+    c2 = get_tch();                     /* Possibly two bytes ops   */
     *out++ = c2;
 
     switch (c) {
@@ -1240,13 +1397,13 @@ static char *   scan_op(
         break;
     case '<':
         switch (c2) {
-        case '<':   c3 = get_ch();
+        case '<':   c3 = get_tch();
             if (c3 == '=') {
                 openum = OP_3;                          /* <<=      */
                 *out++ = c3;
             } else {
                 openum = OP_SL;                         /* <<       */
-                unget_ch();
+                unget_tch();
             }
             break;
         case '=':   openum = OP_LE;         break;      /* <=       */
@@ -1267,13 +1424,13 @@ static char *   scan_op(
         break;
     case '>':
         switch (c2) {
-        case '>':   c3 = get_ch();
+        case '>':   c3 = get_tch();
             if (c3 == '=') {
                 openum = OP_3;                          /* >>=      */
                 *out++ = c3;
             } else {
                 openum = OP_SR;                         /* >>       */
-                unget_ch();
+                unget_tch();
             }
             break;
         case '=':   openum = OP_GE;     break;          /* >=       */
@@ -1301,12 +1458,12 @@ static char *   scan_op(
             break;
         case '>':
             if (cplus_val) {
-                if ((c3 = get_ch()) == '*') {           /* ->*      */
+                if ((c3 = get_tch()) == '*') {          /* ->*      */
                     openum = OP_3;
                     *out++ = c3;
                 } else {
                     /* openum = OP_2;   */
-                    unget_ch();
+                    unget_tch();
                 }
             }   /* else openum = OP_2;  */              /* ->       */
             /* else openum = OP_2;      */
@@ -1325,18 +1482,18 @@ static char *   scan_op(
             break;
         case ':':
             if (mcpp_mode == STD && option_flags.dig) {
-                if ((c3 = get_ch()) == '%') {
-                    if ((c4 = get_ch()) == ':') {   /* %:%: i.e. ## */
+                if ((c3 = get_tch()) == '%') {
+                    if ((c4 = get_tch()) == ':') {  /* %:%: i.e. ## */
                         openum = OP_DSHARP_D;
                         *out++ = c3;
                         *out++ = c4;
                     } else {
-                        unget_ch();
-                        unget_ch();
+                        unget_tch();
+                        unget_tch();
                         openum = OP_SHARP_D;        /* %: i.e. #    */
                     }
                 } else {
-                    unget_ch();
+                    unget_tch();
                     openum = OP_SHARP_D;            /* %: i.e. #    */
                 }
                 if (in_define) {                    /* in #define   */
@@ -1370,13 +1527,13 @@ static char *   scan_op(
     case '.':
         if (standard) {
             if (c2 == '.') {
-                c3 = get_ch();
+                c3 = get_tch();
                 if (c3 == '.') {
                     openum = OP_ELL;                    /* ...      */
                     *out++ = c3;
                     break;
                 } else {
-                    unget_ch();
+                    unget_tch();
                     openum = OP_1;
                 }
             } else if (cplus_val && c2 == '*') {        /* .*       */
@@ -1411,7 +1568,7 @@ static char *   scan_op(
     case OP_GT:     case OP_ADD:    case OP_SUB:    case OP_MOD:
     case OP_MUL:    case OP_DIV:    case OP_XOR:    case OP_COM:
     case OP_COL:    /* Any single byte operator or punctuator       */
-        unget_ch();
+        unget_tch();
         out--;
         break;
     default:        /* Two or more bytes operators or punctuators   */
@@ -1470,17 +1627,75 @@ void    expanding(
  * Remember used macro name for diagnostic.
  */
 {
+    size_t  len;
+
     if (exp_mac_ind < EXP_MAC_IND_MAX - 1) {
         exp_mac_ind++;
     } else {
-        clear_exp_mac();
+        free_exp_mac();
         exp_mac_ind++;
     }
     expanding_macro[ exp_mac_ind].name = name;
     expanding_macro[ exp_mac_ind].to_be_freed = to_be_freed;
+
+    if (exp_logging) {
+        len = strlen( name) + 1;
+        if (exp_log_len + len > exp_log_max) {
+            exp_log_max = exp_log_max ? exp_log_max * 2 : NWORK;
+            if (exp_log_max < exp_log_len + len)
+                exp_log_max = exp_log_len + len;
+            exp_log = xrealloc( exp_log, exp_log_max);
+        }
+        memcpy( exp_log + exp_log_len, name, len);
+        exp_log_len += len;
+    }
+}
+
+size_t  log_exp_mac(
+    int     start               /* Start (TRUE) or end (FALSE) logging  */
+)
+/*
+ * Start or end logging the names registered by expanding(), and return the
+ * current length of the log.  The loggings may nest.  The log is kept until
+ * clear_exp_mac().
+ */
+{
+    if (start)
+        exp_logging++;
+    else if (exp_logging)
+        exp_logging--;
+    return  exp_log_len;
+}
+
+void    replay_exp_mac(
+    size_t  from,
+    size_t  to
+)
+/*
+ * Register again the names logged between 'from' and 'to' of the log.
+ */
+{
+    char *  name;
+
+    while (from < to) {
+        name = save_string( exp_log + from);    /* The log may be moved */
+        from += strlen( name) + 1;
+        expanding( name, TRUE);
+    }
 }
 
 void    clear_exp_mac( void)
+/*
+ * Initialize expanding_macro[] freeing names registered in
+ * name_to_be_freed[], and clear the log.
+ */
+{
+    free_exp_mac();
+    exp_log_len = 0;
+    exp_logging = 0;
+}
+
+static void free_exp_mac( void)
 /*
  * Initialize expanding_macro[] freeing names registered in
  * name_to_be_freed[].
@@ -1519,7 +1734,7 @@ int     get_ch( void)
     if ((file = infile) == NULL)
         return  CHAR_EOF;                   /* End of all input     */
 
-    if (mcpp_mode == POST_STD && file->fp) {        /* In a source file     */
+    if (mcpp_mode == POST_STD && file->src) {       /* In a source file     */
         switch (insert_sep) {
         case NO_SEP:
             break;
@@ -1539,11 +1754,11 @@ int     get_ch( void)
 
     if (mcpp_debug & GETC) {
         mcpp_fprintf( DBG, "get_ch(%s) '%c' line %ld, bptr = %d, buffer"
-            , file->fp ? cur_fullname : file->real_fname ? file->real_fname
+            , file->src ? cur_fullname : file->real_fname ? file->real_fname
             : file->filename ? file->filename : "NULL"
             , *file->bptr & UCHARMAX
             , src_line, (int) (file->bptr - file->buffer));
-        dump_string( NULL, file->buffer);
+        dump_string( NULL, file->num_segs < 0 ? file->buffer : file->bptr);
         dump_unget( "get entrance");
     }
 
@@ -1576,35 +1791,55 @@ int     get_ch( void)
      * file), or do end of file/macro processing, and reenter get_ch() to
      * restart from the top.
      */
-    if (file->fp &&                         /* In source file       */
-            parse_line() != NULL)           /* Get line from file   */
-        return  get_ch();
+    if (file->src) {                        /* In source file       */
+        int     keep = keep_comments;
+        char *  line;
+
+        if (file == src_mark.file) {
+            if (src_mark.text == NULL)
+                save_src_mark();    /* Before the macro call reads over */
+            else if (src_line < src_mark.reread)
+                keep_comments = FALSE;  /* -C: Already put out  */
+        }
+        line = parse_line();                /* Get line from file   */
+        keep_comments = keep;
+        if (line != NULL)
+            return  get_ch();
+    }
+    if (file->num_segs >= 0) {      /* Texts stacked by push_text() */
+        while (1) {
+            if (file->real_fname && macro_name)
+                expanding( file->real_fname, FALSE);
+            if (file->num_segs == 0)
+                break;                      /* The last text        */
+            file->serial = file->segs[ --file->num_segs].serial;
+            file->real_fname = file->segs[ file->num_segs].name;
+            if ((c = (*file->bptr++ & UCHARMAX)) != EOS)
+                return  c;                  /* From the text under  */
+        }
+    }
     /*
      * Free up space used by the (finished) file or macro and restart
      * input from the parent file/macro, if any.
      */
     infile = file->parent;                  /* Unwind file chain    */
-    free( file->buffer);                    /* Free buffer          */
     if (infile == NULL) {                   /* If at end of input   */
-        free( file->filename);
-        free( file->src_dir);
-        free( file);    /* full_fname is the same with filename for main file*/
+        unload_file( file);
+        free_file( file);
+            /* full_fname is the same with filename for main file   */
         return  CHAR_EOF;                   /* Return end of file   */
     }
-    if (file->fp) {                         /* Source file included */
-        free( file->filename);              /* Free filename        */
-        free( file->src_dir);               /* Free src_dir         */
-        fclose( file->fp);                  /* Close finished file  */
+    if (file->src) {                        /* Source file included */
+        if (file->guard_state == GUARD_END)
+            add_guard( file);       /* Not to re-read the file later*/
+        unload_file( file);                 /* Free the source text */
         /* Do not free file->real_fname and file->full_fname        */
         cur_fullname = infile->full_fname;
         cur_fname = infile->real_fname;     /* Restore current fname*/
-        if (infile->pos != 0L) {            /* Includer was closed  */
-            infile->fp = fopen( cur_fullname, "r");
-            fseek( infile->fp, infile->pos, SEEK_SET);
-        }   /* Re-open the includer and restore the file-position   */
         len = (int) (infile->bptr - infile->buffer);
         infile->buffer = xrealloc( infile->buffer, NBUFF);
             /* Restore full size buffer to get the next line        */
+        infile->bufsize = NBUFF;
         infile->bptr = infile->buffer + len;
         src_line = infile->line;            /* Reset line number    */
         inc_dirp = infile->dirp;            /* Includer's directory */
@@ -1622,19 +1857,45 @@ int     get_ch( void)
             /* Else, it is normal includer file, and marked as 2.   */
         src_line--;
         newlines = 0;                       /* Clear the blank lines*/
-        if (mcpp_debug & MACRO_CALL)    /* Should be re-initialized */
+        if ((mcpp_debug & MACRO_CALL) || fp_mac_map || fp_src_map)
+            /* Re-initialize    */
             com_cat_line.last_line = bsl_cat_line.last_line = 0L;
-    } else if (file->filename) {            /* Expanding macro      */
-        if (macro_name)     /* file->filename should be freed later */
-            expanding( file->filename, TRUE);
-        else
-            free( file->filename);
+    } else if (file->filename && macro_name) {  /* Expanding macro  */
+        /* The name should be freed later   */
+        expanding( file->filename == file->fname
+                ? save_string( file->filename) : file->filename, TRUE);
+        file->filename = NULL;
     }
-    free( file);                            /* Free file space      */
+    free_file( file);                       /* Free file space      */
     return  get_ch();                       /* Get from the parent  */
 }
 
 static char *   parse_line( void)
+/*
+ * Parse a logical line in parse_buf.  In pre-Standard modes get_ch() calls
+ * parse_line() back to continue a quotation on the next line, while the
+ * outer parse_line() is still writing the quotation into parse_buf.  The
+ * nested call uses a buffer of its own then.
+ */
+{
+    char *      buf = parse_buf;
+    char *      result;
+
+    if (parse_depth) {
+        buf = xmalloc( NBUFF + 1);
+        buf[ 0] = EOS;
+    }
+    parse_depth++;
+    result = parse_a_line( buf + 1);
+    parse_depth--;
+    if (buf != parse_buf)
+        free( buf);
+    return  result;
+}
+
+static char *   parse_a_line(
+    char *      temp                        /* Temporary buffer     */
+)
 /*
  * ANSI (ISO) C: translation phase 3.
  * Parse a logical line.
@@ -1647,13 +1908,15 @@ static char *   parse_line( void)
  * The lines might be spliced by comments which cross the lines.
  */
 {
-    char *      temp;                       /* Temporary buffer     */
     char *      limit;                      /* Buffer end           */
     char *      tp;     /* Current pointer into temporary buffer    */
     char *      sp;                 /* Pointer into input buffer    */
     size_t      com_size;
+    size_t      run;
     int         c;
 
+    if (! compiling && ! in_asm && parse_depth == 1)
+        skip_lines();   /* In a skipped group, not called back by get_ch()  */
     if ((sp = get_line( FALSE)) == NULL)    /* Next logical line    */
         return  NULL;                       /* End of a file        */
     if (in_asm) {                           /* In #asm block        */
@@ -1663,7 +1926,7 @@ static char *   parse_line( void)
             infile->bptr = sp;
         return  infile->bptr;               /* Don't tokenize       */
     }
-    tp = temp = xmalloc( (size_t) NBUFF);
+    tp = temp;
     limit = temp + NBUFF - 2;
 
     while (char_type[ c = *sp++ & UCHARMAX] & HSP) {
@@ -1682,10 +1945,9 @@ static char *   parse_line( void)
             switch (*sp++) {
             case '*':                       /* Start of a comment   */
 com_start:
-                if ((sp = read_a_comment( sp, &com_size)) == NULL) {
-                    free( temp);            /* End of file with un- */
-                    return  NULL;           /*   terminated comment */
-                }
+                if ((sp = read_a_comment( sp, &com_size)) == NULL)
+                    return  NULL;           /* End of file with un- */
+                                            /*   terminated comment */
                 if (keep_spaces && mcpp_mode != OLD_PREP) {
                     if (tp + com_size >= limit - 1)     /* Too long comment */
                         com_size = limit - tp - 1;      /* Truncate */
@@ -1763,10 +2025,8 @@ not_comment:
                 tp = scan_quote( c, tp, limit, TRUE);   /* (not by get_ch())*/
                 in_string = FALSE;
             }
-            if (tp == NULL) {
-                free( temp);                /* Unbalanced quotation */
-                return  parse_line();       /* Skip the line        */
-            }
+            if (tp == NULL)                 /* Unbalanced quotation */
+                return  parse_a_line( temp);        /* Skip the line    */
             sp = infile->bptr;
             break;
         default:
@@ -1775,7 +2035,13 @@ not_comment:
     "Illegal control character %.0s0x%lx, skipped the character"    /* _E_  */
                         , NULL, (long) c, NULL);
             } else {                        /* Any valid character  */
-                *tp++ = c;
+                /* Copy the run of ordinary characters at a time    */
+                run = skip_plain( sp, infile->buffer + NBUFF, FALSE) - sp + 1;
+                if (run > (size_t) (limit - tp) + 1)
+                    run = (size_t) (limit - tp) + 1;    /* Too long */
+                memcpy( tp, sp - 1, run);
+                tp += run;
+                sp += run - 1;
             }
             break;
         }
@@ -1792,8 +2058,8 @@ end_line:
         tp--;                       /* Remove trailing white space  */
     *tp++ = '\n';
     *tp = EOS;
-    infile->bptr = strcpy( infile->buffer, temp);   /* Write back to buffer */
-    free( temp);
+    infile->bptr = memcpy( infile->buffer, temp, tp - temp + 1);
+                                            /* Write back to buffer */
     if (macro_line != 0 && macro_line != MACRO_ERROR) { /* Expanding macro  */
         temp = infile->buffer;
         while (char_type[ *temp & UCHARMAX] & HSP)
@@ -1808,6 +2074,58 @@ end_line:
     return  infile->buffer;
 }
 
+static char *   skip_plain(
+    char *      sp,
+    const char *    end,                    /* End of the buffer    */
+    int         hsp                         /* Skip ' ' and '\t'    */
+)
+/*
+ * Skip the run of characters which parse_line() copies as they are, and
+ * return the pointer to the next character to be examined: '/', '"', '\'',
+ * white space, <newline> or other control character.  If 'hsp' is TRUE, ' '
+ * and '\t' are skipped too.  A logical line always ends with <newline>,
+ * hence the run never reaches 'end'.  With SSE2, 16 bytes are examined at a
+ * time while not beyond 'end'.
+ */
+{
+#if HOST_HAVE_SSE2
+    const __m128i   ctl_max = _mm_set1_epi8( hsp ? 0x1F : ' ');
+    const __m128i   tab = _mm_set1_epi8( hsp ? '\t' : 0x7F);
+                                    /* 0x7F is never <= ctl_max     */
+    const __m128i   del = _mm_set1_epi8( 0x7F);
+    const __m128i   sl = _mm_set1_epi8( '/');
+    const __m128i   dq = _mm_set1_epi8( '"');
+    const __m128i   sq = _mm_set1_epi8( '\'');
+    __m128i     chunk;
+    unsigned    hits;
+
+    while (end - sp >= 16) {
+        chunk = _mm_loadu_si128( (const __m128i *) sp);
+        hits = _mm_movemask_epi8( _mm_or_si128( _mm_or_si128(
+                    _mm_andnot_si128( _mm_cmpeq_epi8( chunk, tab)
+                        , _mm_cmpeq_epi8( _mm_min_epu8( chunk, ctl_max)
+                            , chunk))           /* <= ctl_max but tab   */
+                    , _mm_cmpeq_epi8( chunk, del)),
+                _mm_or_si128( _mm_cmpeq_epi8( chunk, sl)
+                    , _mm_or_si128( _mm_cmpeq_epi8( chunk, dq)
+                        , _mm_cmpeq_epi8( chunk, sq)))));
+        if (hits) {
+            while ((hits & 1) == 0) {
+                hits >>= 1;
+                sp++;
+            }
+            return  sp;
+        }
+        sp += 16;
+    }
+#endif
+    while (((*sp & UCHARMAX) > ' '
+                || (hsp && (*sp == ' ' || *sp == '\t')))
+            && *sp != 0x7F && *sp != '/' && *sp != '"' && *sp != '\'')
+        sp++;
+    return  sp;
+}
+
 static char *   read_a_comment(
     char *      sp,                         /* Source               */
     size_t *    sizp                        /* Size of the comment  */
@@ -1852,7 +2170,8 @@ static char *   read_a_comment(
             }
             if (keep_spaces)                /* Save the length      */
                 *sizp = *sizp + (sp - saved_sp);
-            if ((mcpp_debug & MACRO_CALL) && compiling) {
+            if (((mcpp_debug & MACRO_CALL) || fp_mac_map || fp_src_map)
+                    && compiling) {
                 if (cat_line) {
                     cat_line++;
                     com_cat_line.len[ cat_line]         /* Catenated length */
@@ -1866,7 +2185,8 @@ static char *   read_a_comment(
         case '\n':                          /* Line-crossing comment*/
             if (keep_spaces)                /* Save the length      */
                 *sizp = *sizp + (sp - saved_sp) - 1;    /* '-1' for '\n'    */
-            if ((mcpp_debug & MACRO_CALL) && compiling) {
+            if (((mcpp_debug & MACRO_CALL) || fp_mac_map || fp_src_map)
+                    && compiling) {
                                     /* Save location informations   */
                 if (cat_line == 0)  /* First line of catenation     */
                     com_cat_line.start_line = src_line;
@@ -1898,13 +2218,437 @@ static char *   read_a_comment(
     return  sp;                             /* Never reach here     */
 }
 
-static char *   mcpp_fgets(
+/*
+ * An entry of the index of lines made by index_lines() is the offset of the
+ * end of a physical line (next to the '\n') shifted by LINE_SHIFT bits with
+ * the following flags in the lower bits.  A flag is only a hint: get_line()
+ * examines the line when the flag is set, and need not when it is not set.
+ */
+#define LINE_CR         1       /* Line ends with [CR+LF]           */
+#define LINE_BSL        2       /* <backslash> before the newline   */
+#define LINE_NUL        4       /* Line has NUL byte, scan it anew  */
+#define LINE_TRI        8       /* Line has "??", maybe trigraph    */
+#define LINE_DIG        16      /* Line has digraph                 */
+#define LINE_SHIFT      5
+#define LINE_FLAGS      ((1 << LINE_SHIFT) - 1)
+
+static size_t   line_flags(
+    const char *    end,                /* Next to the '\n' of the line */
+    const char *    top                 /* Top of the line          */
+)
+/*
+ * Set the flags of the line terminated by the newline of end[ -1].
+ */
+{
+    size_t  flags = 0;
+    const char *    cp = end - 2;
+
+    if (cp >= top && *cp == '\r') {
+        flags |= LINE_CR;
+        cp--;
+    }
+    if (cp >= top && *cp == '\\')
+        flags |= LINE_BSL;
+    return  flags;
+}
+
+static size_t   pair_flags(
+    const char *    cp,
+    const char *    end,
+    size_t          want                /* LINE_TRI and/or LINE_DIG */
+)
+/*
+ * Scan the bytes from 'cp' up to 'end' for the "??" of trigraph and for the
+ * digraphs, and return the flags of those found.
+ */
+{
+    size_t  flags = 0;
+
+    for (end--; cp < end && flags != want; cp++) {
+        switch (*cp) {
+        case '?':
+            if (*(cp + 1) == '?')
+                flags |= LINE_TRI;
+            break;
+        case '<':
+            if (*(cp + 1) == ':' || *(cp + 1) == '%')
+                flags |= LINE_DIG;
+            break;
+        case '%':
+            if (*(cp + 1) == ':' || *(cp + 1) == '>')
+                flags |= LINE_DIG;
+            break;
+        case ':':
+            if (*(cp + 1) == '>')
+                flags |= LINE_DIG;
+            break;
+        }
+    }
+    return  flags & want;
+}
+
+void    index_lines(
+    FILEINFO *  file
+)
+/*
+ * Translation phase 1 and 2 at once for the whole text of source file:
+ * Sweep the text to find the ends of all the physical lines, and mark the
+ * lines ending with [CR+LF] or <backslash><newline> and the lines including
+ * NUL.  If trigraphs or digraphs are enabled, mark also the lines which may
+ * have them, so that get_line() can skip the conversion of the other lines.
+ * get_line() consumes this index instead of scanning the text line by line.
+ * The sweep is done by 16 bytes with SSE2 if available.
+ */
+{
+    const char *    top = file->src;
+    const char *    end = file->src_end;
+    const char *    line = top;         /* Top of the current line  */
+    const char *    cp;
+    size_t  want = 0;                   /* LINE_TRI, LINE_DIG       */
+    size_t  flags = 0;                  /* Flags of current line    */
+    size_t  num = 0;
+    size_t  max = (end - top) / 32 + 16;    /* Initial guess        */
+    size_t *    lines;
+
+    if (standard && option_flags.trig)
+        want |= LINE_TRI;
+    if (standard && mcpp_mode == POST_STD && option_flags.dig)
+        want |= LINE_DIG;
+    lines = (size_t *) xmalloc( sizeof (size_t) * max);
+    cp = top;
+#if HOST_HAVE_SSE2
+    {
+        const __m128i   nl = _mm_set1_epi8( '\n');
+        const __m128i   nul = _mm_setzero_si128();
+        const __m128i   qu = _mm_set1_epi8( '?');
+        const __m128i   lt = _mm_set1_epi8( '<');
+        const __m128i   pc = _mm_set1_epi8( '%');
+        const __m128i   co = _mm_set1_epi8( ':');
+        const __m128i   gt = _mm_set1_epi8( '>');
+        __m128i     chunk, next;
+        unsigned    nls, nuls, tris, digs, events;
+        int         i;
+
+        tris = digs = 0;
+        /* Leave 1 byte at least to the rest to compare the next byte   */
+        for ( ; end - cp > 16; cp += 16) {
+            chunk = _mm_loadu_si128( (const __m128i *) cp);
+            nls = _mm_movemask_epi8( _mm_cmpeq_epi8( chunk, nl));
+            nuls = _mm_movemask_epi8( _mm_cmpeq_epi8( chunk, nul));
+            if (want) {
+                next = _mm_loadu_si128( (const __m128i *) (cp + 1));
+                if (want & LINE_TRI)            /* "??"                 */
+                    tris = _mm_movemask_epi8( _mm_and_si128(
+                            _mm_cmpeq_epi8( chunk, qu)
+                            , _mm_cmpeq_epi8( next, qu)));
+                if (want & LINE_DIG)    /* "<:", "<%", "%:", "%>", ":>" */
+                    digs = _mm_movemask_epi8( _mm_or_si128( _mm_or_si128(
+                        _mm_and_si128( _mm_cmpeq_epi8( chunk, lt)
+                            , _mm_or_si128( _mm_cmpeq_epi8( next, co)
+                                , _mm_cmpeq_epi8( next, pc))),
+                        _mm_and_si128( _mm_cmpeq_epi8( chunk, pc)
+                            , _mm_or_si128( _mm_cmpeq_epi8( next, co)
+                                , _mm_cmpeq_epi8( next, gt)))),
+                        _mm_and_si128( _mm_cmpeq_epi8( chunk, co)
+                            , _mm_cmpeq_epi8( next, gt))));
+            }
+            if ((events = nls | nuls | tris | digs) == 0)
+                continue;           /* The most frequent case   */
+            for (i = 0; events >> i; i++) {
+                if (tris & (1U << i))
+                    flags |= LINE_TRI;
+                if (digs & (1U << i))
+                    flags |= LINE_DIG;
+                if (nuls & (1U << i)) {
+                    flags |= LINE_NUL;
+                } else if (nls & (1U << i)) {
+                    if (num == max)
+                        lines = (size_t *) xrealloc( (char *) lines
+                                , sizeof (size_t) * (max *= 2));
+                    lines[ num++] = ((size_t) (cp + i + 1 - top) << LINE_SHIFT)
+                            | flags | line_flags( cp + i + 1, line);
+                    line = cp + i + 1;
+                    flags = 0;
+                }
+            }
+        }
+    }
+#endif
+    /* The rest of text, or the whole text without SSE2 */
+    while (cp < end) {
+        const char *    nlp;
+
+        if ((nlp = (const char *) memchr( cp, '\n', end - cp)) == NULL)
+            nlp = end;              /* Unterminated last line   */
+        else
+            nlp++;
+        if (memchr( cp, '\0', nlp - cp) != NULL)
+            flags |= LINE_NUL;
+        if (want)
+            flags |= pair_flags( cp, nlp, want);
+        if (num == max)
+            lines = (size_t *) xrealloc( (char *) lines
+                    , sizeof (size_t) * (max *= 2));
+        lines[ num++] = ((size_t) (nlp - top) << LINE_SHIFT) | flags
+                | (nlp[ -1] == '\n' ? line_flags( nlp, line) : 0);
+        cp = line = nlp;
+        flags = 0;
+    }
+    file->lines = file->lptr = lines;
+}
+
+static size_t   read_src_line(
     char *  s,
     int     size,
-    FILE *  stream
+    FILEINFO *  file,
+    int *   flagp                       /* Flags of the line        */
+)
+/*
+ * Copy the next physical line of the source text into 's' as fgets() does:
+ * at most 'size' - 1 bytes up to and including the newline.
+ * Return the length of the line, 0 at the end of the text.
+ * The line is found by the index of lines.  A line longer than 'size' - 1
+ * is read in pieces, and the flags of a piece are LINE_NUL meaning to scan
+ * the piece anew.
+ */
+{
+    char *  sp = file->src_ptr;
+    char *  ep;
+    size_t  entry;
+    size_t  len;
+
+    if (sp >= file->src_end || size <= 1)
+        return  0;
+    entry = *file->lptr;
+    ep = file->src + (entry >> LINE_SHIFT);     /* End of the line  */
+    len = ep - sp;
+    if (len > (size_t) size - 1) {          /* A piece of the line  */
+        len = (size_t) size - 1;
+        *flagp = LINE_NUL;
+    } else {
+        if (file->lptr == file->lines
+                ? sp == file->src : sp == file->src
+                    + (file->lptr[ -1] >> LINE_SHIFT))
+            *flagp = (int) (entry & LINE_FLAGS);
+        else                        /* The rest of a line   */
+            *flagp = LINE_NUL;
+        file->lptr++;
+    }
+    memcpy( s, sp, len);
+    s[ len] = EOS;
+    file->src_ptr = sp + len;
+    return  len;
+}
+
+char *  mcpp_fgets(
+    char *  s,
+    int     size,
+    FILEINFO *  file
+)
+/*
+ * fgets() on the text of source file.
+ * Return NULL at the end of the text.
+ */
+{
+    int     flags;
+
+    return  read_src_line( s, size, file, & flags) ? s : NULL;
+}
+
+void    mark_src(
+    int     on
+)
+/*
+ * Mark the current read position of the source file, if 'on' is TRUE, or
+ * clear the mark.  The source file is the current "file" then.  The lines
+ * read after the mark can be read again by rewind_src().
+ */
+{
+    free( src_mark.text);
+    src_mark.text = NULL;
+    src_mark.file = on ? infile : NULL;
+    src_mark.reread = 0L;
+}
+
+static void     save_src_mark( void)
+/*
+ * Save the line in the buffer and the read position before get_ch() reads
+ * the next line over the mark.
+ */
+{
+    FILEINFO *  file = src_mark.file;
+
+    src_mark.text = save_string( file->buffer);
+    src_mark.src_ptr = file->src_ptr;
+    src_mark.lptr = file->lptr;
+    src_mark.line = src_line;
+    src_mark.bsl = bsl_cat_line;
+    src_mark.com = com_cat_line;
+}
+
+int     rewind_src(
+    int     do_it                           /* Rewind, or just check*/
+)
+/*
+ * Return TRUE if the source file can be rewound to the mark, i.e. the mark
+ * is on the current "file".  Rewind it if 'do_it' is TRUE.  The comments
+ * put out by -C option on the lines read are not put out again.
+ */
+{
+    FILEINFO *  file = src_mark.file;
+
+    if (file == NULL || file != infile)
+        return  FALSE;
+    if (src_mark.text == NULL)              /* Still on the line    */
+        return  TRUE;
+    if (do_it) {
+        if (src_mark.reread < src_line)
+            src_mark.reread = src_line;
+        strcpy( file->buffer, src_mark.text);
+        file->src_ptr = src_mark.src_ptr;
+        file->lptr = src_mark.lptr;
+        src_line = src_mark.line;
+        bsl_cat_line = src_mark.bsl;
+        com_cat_line = src_mark.com;
+    }
+    return  TRUE;
+}
+
+static void     skip_lines( void)
+/*
+ * Skip the plain lines in a skipped group at a time, directly on the text of
+ * source file using the index of lines.  A plain line has neither control
+ * character other than '\t', [CR+LF], line splicing, trigraph nor digraph,
+ * does not begin with '#' or '%' (possibly after comments), and has only the
+ * comments and (in Standard modes) the quotations which get_line() and
+ * parse_line() read over without any diagnostic.  A comment may cross the
+ * lines, and the lines are skipped as one logical line then.  get_line(),
+ * parse_line() and mcpp_main() do nothing on such a line in a skipped group
+ * but count it, so we count it here without reading it into the buffer.
+ * Stop at any other line and leave it to get_line().
+ */
+{
+    FILEINFO *  file = infile;
+    char *      sp = file->src_ptr;
+    char *      ep;
+    char *      cp;
+    size_t *    lptr;
+    size_t      entry;
+    long        lines;
+    int         in_comment;
+    int         at_top;
+
+    if (file->lines == NULL || (mcpp_debug & (TOKEN | GETC)) || keep_comments
+            || sp != file->src + (file->lptr == file->lines
+                ? 0 : (file->lptr[ -1] >> LINE_SHIFT)))
+        return;             /* In the middle of a line, or debugging    */
+
+    while (sp < file->src_end) {
+        lptr = file->lptr;
+        cp = sp;
+        lines = 0L;
+        in_comment = FALSE;
+        at_top = TRUE;
+        do {                /* For each physical line of a logical line */
+            entry = *lptr;
+            ep = file->src + (entry >> LINE_SHIFT);
+            if ((entry & LINE_FLAGS) || *(ep - 1) != '\n'
+                    || ep - sp >= NBUFF - 2
+                    || ep == file->src_end) /* Diagnostic at end of file*/
+                goto  done;                 /*   shows the last line    */
+            if (standard && (src_line + lines == std_limits.line_num
+                        || ep - cp > std_limits.str_len))
+                goto  done;         /* get_line() may warn  */
+            if ((cp = skip_text( cp, ep, &in_comment, &at_top)) == NULL)
+                goto  done;         /* Not a plain line     */
+            cp = ep;
+            lines++;
+            lptr++;
+        } while (in_comment);
+        src_line += lines;
+        newlines++;         /* Count it as mcpp_main() does         */
+        if (lines > 1)
+            wrong_line = TRUE;      /* As read_a_comment() does     */
+        sp = ep;
+        file->lptr = lptr;
+    }
+done:
+    file->src_ptr = sp;
+}
+
+static char *   skip_text(
+    char *      cp,                 /* Top of the physical line     */
+    const char *    end,            /* Next to the '\n' of the line */
+    int *       in_comment,         /* In a comment crossing lines  */
+    int *       at_top              /* No token yet on the line     */
 )
+/*
+ * Read over a physical line for skip_lines(), and return the pointer to the
+ * '\n' or NULL if the line needs the normal path: a line which may be a
+ * directive, a control character, a comment to be warned of, or a quotation
+ * to be diagnosed or not quite simple.  '*in_comment' is TRUE at the end of
+ * the line if a comment continues to the next line.
+ */
 {
-    return fgets( s, size, stream);
+    int     c, delim;
+
+    while (1) {
+        if (*in_comment) {
+            while ((c = *cp++) != '\n') {
+                if (c == '*' && *cp == '/') {
+                    cp++;
+                    break;                  /* End of the comment   */
+                } else if (c == '/' && *cp == '*') {
+                    return  NULL;           /* get_line() warns     */
+                }
+            }
+            if (c == '\n')
+                return  cp - 1;             /* Continues to next line   */
+            *in_comment = FALSE;
+        }
+        if (*at_top) {
+            while (*cp == ' ' || *cp == '\t')
+                cp++;
+            if (*cp == '#' || *cp == '%')   /* Maybe a directive    */
+                return  NULL;
+            if (*cp != '/' || *(cp + 1) != '*')
+                *at_top = FALSE;
+        }
+        cp = skip_plain( cp, end, TRUE);
+        switch (c = *cp++ & UCHARMAX) {
+        case '\n':
+            return  cp - 1;
+        case '/':
+            if (*cp == '*') {               /* Start of a comment   */
+                cp++;
+                *in_comment = TRUE;
+            } else if (*cp == '/' && standard) {
+                if (! stdc2 && (warn_level & 2))
+                    return  NULL;           /* parse_line() warns   */
+                return  (char *) end - 1;   /* Comment to end of line   */
+            }
+            break;
+        case '"':                           /* String literal       */
+        case '\'':                          /* Character constant   */
+            if (! standard || (c == '\'' && *cp == '\''))
+                return  NULL;   /* Pre-Standard quotation or empty constant */
+            delim = c;
+            while ((c = *cp++ & UCHARMAX) != delim) {
+                if (c == '\\') {             /* Escape sequence      */
+                    c = *cp++ & UCHARMAX;
+                    if (c == 'u' || c == 'U')
+                        return  NULL;       /* Maybe UCN            */
+                }
+                if (c == '\n' || (char_type[ c] & mbchk)
+                        || (c < ' ' && c != '\t') || c == 0x7F)
+                    return  NULL;   /* Unterminated, multi-byte character   */
+                                    /*   or control character           */
+            }
+            break;
+        default:                            /* Control character    */
+            return  NULL;
+        }
+    }
 }
 
 static char *   get_line(
@@ -1924,17 +2668,19 @@ static char *   get_line(
     static int  cr_converted;
     int     converted = FALSE;
     int     len;                            /* Line length - alpha  */
+    int     lflags;                         /* Flags of the line    */
     char *  ptr;
     int     cat_line = 0;           /* Number of catenated lines    */
 
     if (infile == NULL)                     /* End of a source file */
         return  NULL;
     ptr = infile->bptr = infile->buffer;
-    if ((mcpp_debug & MACRO_CALL) && src_line == 0) /* Initialize   */
+    if (((mcpp_debug & MACRO_CALL) || fp_mac_map || fp_src_map)
+            && src_line == 0)               /* Initialize   */
         com_cat_line.last_line = bsl_cat_line.last_line = 0L;
 
-    while (mcpp_fgets( ptr, (int) (infile->buffer + NBUFF - ptr), infile->fp)
-            != NULL) {
+    while ((len = (int) read_src_line( ptr
+            , (int) (infile->buffer + NBUFF - ptr), infile, & lflags)) != 0) {
         /* Translation phase 1  */
         src_line++;                 /* Gotten next physical line    */
         if (standard && src_line == std_limits.line_num + 1
@@ -1945,7 +2691,10 @@ static char *   get_line(
             mcpp_fprintf( DBG, "\n#line %ld (%s)", src_line, cur_fullname);
             dump_string( NULL, ptr);
         }
-        len = strlen( ptr);
+        if (lflags & LINE_NUL) {    /* Length is not known      */
+            len = strlen( ptr);
+            lflags = LINE_FLAGS;
+        }
         if (NBUFF - 1 <= ptr - infile->buffer + len
                 && *(ptr + len - 1) != '\n') {
                 /* The line does not yet end, though the buffer is full.    */
@@ -1958,7 +2707,8 @@ static char *   get_line(
         }
         if (*(ptr + len - 1) != '\n')   /* Unterminated source line */
             break;
-        if (len >= 2 && *(ptr + len - 2) == '\r') {         /* [CR+LF]      */
+        if ((lflags & LINE_CR) && len >= 2 && *(ptr + len - 2) == '\r') {
+                                                    /* [CR+LF]      */
             *(ptr + len - 2) = '\n';
             *(ptr + --len) = EOS;
             if (! cr_converted && (warn_level & cr_warn_level)) {
@@ -1968,20 +2718,23 @@ static char *   get_line(
             }
         }
         if (standard) {
-            if (option_flags.trig)
-                converted = cnv_trigraph( ptr);
-            if (mcpp_mode == POST_STD && option_flags.dig)
+            if (option_flags.trig)      /* Skip the line without "??"   */
+                converted = (lflags & LINE_TRI) ? cnv_trigraph( ptr) : 0;
+            if (mcpp_mode == POST_STD && option_flags.dig
+                    && (lflags & LINE_DIG))
                 converted += cnv_digraph( ptr);
             if (converted)
                 len = strlen( ptr);
             /* Translation phase 2  */
             len -= 2;
-            if (len >= 0) {
+            if (len >= 0 && ((lflags & LINE_BSL) || converted)) {
                 if ((*(ptr + len) == '\\') && ! last_is_mbchar( ptr, len)) {
                             /* <backslash><newline> (not MBCHAR)    */
                     ptr = infile->bptr += len;  /* Splice the lines */
                     wrong_line = TRUE;
-                    if ((mcpp_debug & MACRO_CALL) && compiling) {
+                    if (((mcpp_debug & MACRO_CALL) || fp_mac_map
+                                || fp_src_map)
+                            && compiling) {
                                     /* Save location informations   */
                         if (cat_line == 0)      /* First line of catenation */
                             bsl_cat_line.start_line = src_line;
@@ -2001,7 +2754,8 @@ static char *   get_line(
                         , NULL, std_limits.str_len, NULL);
 #endif
         }
-        if ((mcpp_debug & MACRO_CALL) && compiling) {
+        if (((mcpp_debug & MACRO_CALL) || fp_mac_map || fp_src_map)
+                && compiling) {
             if (cat_line && cat_line < MAX_CAT_LINE) {
                 bsl_cat_line.len[ ++cat_line] = strlen( infile->buffer) - 1;
                                 /* Catenated length: '-1' for '\n'  */
@@ -2012,8 +2766,6 @@ static char *   get_line(
     }
 
     /* End of a (possibly included) source file */
-    if (ferror( infile->fp))
-        cfatal( "File read error", NULL, 0L, NULL);         /* _F_  */
     if ((ptr = at_eof( in_comment)) != NULL)        /* Check at end of file */
         return  ptr;                        /* Partial line supplemented    */
     if (option_flags.z) {
@@ -2032,6 +2784,8 @@ int     cnv_trigraph(
  * Perform in-place trigraph replacement on a physical line.  This was added
  * to the C90.  In an input text line, the sequence ??[something] is
  * transformed to a character (which might not appear on the input keyboard).
+ * The text between trigraphs is moved at a time rather than shifting the
+ * whole rest of line at each trigraph.
  */
 {
     const char * const  tritext = "=(/)'<!>-\0#[\\]^{|}~";
@@ -2041,6 +2795,9 @@ int     cnv_trigraph(
      */
     int     count = 0;
     const char *    tp;
+    char *  out = in;           /* Where to copy the converted text */
+    char *  top = in;           /* Top of the text not yet copied   */
+    size_t  len;
 
     while ((in = strchr( in, '?')) != NULL) {
         if (*++in != '?')
@@ -2049,11 +2806,17 @@ int     cnv_trigraph(
             ;
         if ((tp = strchr( tritext, *in)) == NULL)
             continue;
-        *(in - 2) = *(tp + TRIOFFSET);
-        in--;
-        memmove( in, in + 2, strlen( in + 1));
+        /* Copy the text preceding the trigraph at a time   */
+        len = in - 2 - top;
+        if (out != top)
+            memmove( out, top, len);
+        out += len;
+        *out++ = *(tp + TRIOFFSET);
+        top = *in ? ++in : in;
         count++;
     }
+    if (count)
+        memmove( out, top, strlen( top) + 1);   /* The rest and EOS */
 
     if (count && (warn_level & 16))
         cwarn( "%.0s%ld trigraph(s) converted"          /* _W16_    */
@@ -2067,11 +2830,15 @@ int     cnv_digraph(
 /*
  * Perform in-place digraph replacement on a physical line.
  * Called only in POST_STD mode.
+ * The text between digraphs is moved at a time as cnv_trigraph() does.
  */
 {
     int     count = 0;
     int     i;
     int     c1, c2;
+    char *  out = in;           /* Where to copy the converted text */
+    char *  top = in;           /* Top of the text not yet copied   */
+    size_t  len;
 
     while ((i = strcspn( in, "%:<")), (c1 = *(in + i)) != '\0') {
         in += i + 1;
@@ -2079,28 +2846,36 @@ int     cnv_digraph(
         switch (c1) {
         case '%'    :
             switch (c2) {
-            case ':'    :   *(in - 1) = '#';    break;
-            case '>'    :   *(in - 1) = '}';    break;
+            case ':'    :   c1 = '#';   break;
+            case '>'    :   c1 = '}';   break;
             default     :   continue;
             }
             break;
         case ':'    :
             switch (c2) {
-            case '>'    :   *(in - 1) = ']';    break;
+            case '>'    :   c1 = ']';   break;
             default     :   continue;
             }
             break;
         case '<'    :
             switch (c2) {
-            case '%'    :   *(in - 1) = '{';    break;
-            case ':'    :   *(in - 1) = '[';    break;
+            case '%'    :   c1 = '{';   break;
+            case ':'    :   c1 = '[';   break;
             default     :   continue;
             }
             break;
         }
-        memmove( in, in + 1, strlen( in));
+        /* Copy the text preceding the digraph at a time    */
+        len = in - 1 - top;
+        if (out != top)
+            memmove( out, top, len);
+        out += len;
+        *out++ = c1;
+        top = ++in;
         count++;
     }
+    if (count)
+        memmove( out, top, strlen( top) + 1);   /* The rest and EOS */
 
     if (count && (warn_level & 16))
         cwarn( "%.0s%ld digraph(s) converted"           /* _W16_    */
@@ -2204,7 +2979,7 @@ void    unget_ch( void)
     }
 
     if (infile != NULL) {
-        if (mcpp_mode == POST_STD && infile->fp) {
+        if (mcpp_mode == POST_STD && infile->src) {
             switch (insert_sep) {
             case INSERTED_SEP:  /* Have just read an inserted separator */
                 insert_sep = INSERT_SEP;
@@ -2250,6 +3025,83 @@ FILEINFO *  unget_string(
     return  file;
 }
 
+long    push_text(
+    const char *    text,               /* Text to stack            */
+    const char *    name                /* Name of the macro, if any*/
+)
+/*
+ * Push a text back on the input stream in macro expansion, and return the
+ * serial number of the text, which is 'infile->serial' while the text is
+ * read.  The text is stacked in front of the pending texts of the "file"
+ * made by the first call, hence nested expansions do not make a "file" for
+ * each level.  get_ch() pops the text at its end.  Unlike unget_string(),
+ * the text is not at 'infile->buffer' and the name is not copied.
+ */
+{
+    FILEINFO *      file = infile;
+    size_t          len = strlen( text) + 1;
+
+    if (file == NULL || file->num_segs < 0) {   /* Make a stack     */
+        file = get_file( NULL, NULL, NULL
+                , len < TEXT_BUF_INIT ? TEXT_BUF_INIT : len * 2, FALSE);
+        file->num_segs = 0;
+    } else {
+        text_room( file, len);
+        if (file->num_segs >= file->max_segs) {
+            file->max_segs = file->max_segs ? file->max_segs * 2
+                    : TEXT_SEGS_INIT;
+            file->segs = (TEXT_SEG *) xrealloc( (char *) file->segs
+                    , sizeof (TEXT_SEG) * file->max_segs);
+        }
+        file->segs[ file->num_segs].serial = file->serial;
+        file->segs[ file->num_segs++].name = file->real_fname;
+        file->serial = ++file_serial;
+    }
+    if (file->num_segs == 0)        /* The first text at the end    */
+        file->bptr = file->buffer + file->bufsize;
+    file->bptr -= len;
+    memcpy( file->bptr, text, len);
+    file->real_fname = name;
+    return  file->serial;
+}
+
+void    insert_text(
+    const char *    text,               /* Sequence to insert       */
+    size_t          len                 /* Its length               */
+)
+/*
+ * Insert a sequence in front of 'infile->bptr' of the "file" made by
+ * push_text(), as a part of the current text.
+ */
+{
+    text_room( infile, len);
+    infile->bptr -= len;
+    memcpy( infile->bptr, text, len);
+}
+
+static void text_room(
+    FILEINFO *      file,               /* "File" of push_text()    */
+    size_t          len                 /* Bytes required           */
+)
+/*
+ * Ensure the room of 'len' bytes in front of 'file->bptr', moving the
+ * pending texts to the end of a larger buffer if necessary.
+ */
+{
+    size_t          rest, size;
+    char *          buf;
+
+    if ((size_t) (file->bptr - file->buffer) >= len)
+        return;
+    rest = file->buffer + file->bufsize - file->bptr;
+    buf = get_buf( (rest + len) * 2, &size);
+    memcpy( buf + size - rest, file->bptr, rest);
+    put_buf( file->buffer, file->bufsize);
+    file->buffer = buf;
+    file->bufsize = size;
+    file->bptr = buf + size - rest;
+}
+
 char *  save_string(
     const char *      text
 )
@@ -2278,23 +3130,42 @@ FILEINFO *  get_file(
  */
 {
     FILEINFO *  file;
+    size_t      len;
 
-    file = (FILEINFO *) xmalloc( sizeof (FILEINFO));
-    file->buffer = xmalloc( bufsize);
+    if (file_pool) {                        /* Reuse a record       */
+        file = file_pool;
+        file_pool = file->parent;
+        num_files_reused++;
+    } else {
+        file = (FILEINFO *) xmalloc( sizeof (FILEINFO));
+        file->segs = NULL;
+        file->max_segs = 0;
+        num_files++;
+    }
+    file->serial = ++file_serial;
+    file->num_segs = -1;                    /* Not a stack of texts */
+    file->buffer = get_buf( bufsize, &file->bufsize);
     file->bptr = file->buffer;              /* Initialize line ptr  */
     file->buffer[ 0] = EOS;                 /* Force first read     */
     file->line = 0L;                        /* (Not used just yet)  */
-    file->fp = NULL;                        /* No file yet          */
-    file->pos = 0L;                         /* No pos to remember   */
+    file->src = file->src_ptr = file->src_end = NULL;   /* No file yet  */
+    file->src_mapped = FALSE;
+    file->lines = file->lptr = NULL;
     file->parent = infile;                  /* Chain files together */
     file->initif = ifptr;                   /* Initial ifstack      */
     file->include_opt = include_opt;        /* Specified by -include*/
     file->dirp = NULL;                      /* No include dir yet   */
     file->real_fname = name;                /* Save file/macro name */
     file->full_fname = fullname;            /* Full path list       */
+    file->guard_state = GUARD_START;        /* No include guard yet */
+    file->guard = NULL;
     if (name) {
-        file->filename = xmalloc( strlen( name) + 1);
-        strcpy( file->filename, name);      /* Copy for #line       */
+        len = strlen( name) + 1;
+        if (fullname == NULL && len <= FNAME_INLINE)
+            file->filename = file->fname;   /* Name of macro        */
+        else
+            file->filename = xmalloc( len); /* Copy for #line       */
+        memcpy( file->filename, name, len);
     } else {
         file->filename = NULL;
     }
@@ -2322,6 +3193,134 @@ FILEINFO *  get_file(
     return  file;                           /* All done.            */
 }
 
+void    free_file(
+    FILEINFO *  file
+)
+/*
+ * Free the buffer and the names of the file or macro, and release the
+ * FILEINFO record.  The record of a macro is kept in the pool, while that of
+ * a source file, which sharp() remembers, is freed.
+ */
+{
+
+    put_buf( file->buffer, file->bufsize);
+    if (file->filename != file->fname)
+        free( file->filename);
+    free( (char *) file->src_dir);
+    if (file->full_fname) {
+        free( file->segs);
+        free( file);
+        return;
+    }
+    file->parent = file_released;
+    file_released = file;
+}
+
+void    recycle_files( void)
+/*
+ * Move the released FILEINFO records to the pool to be reused, which should
+ * be called only where no routine keeps a pointer to a record.
+ */
+{
+    FILEINFO *  file;
+
+    while ((file = file_released) != NULL) {
+        file_released = file->parent;
+        file->parent = file_pool;
+        file_pool = file;
+    }
+}
+
+void    free_file_pool( void)
+/*
+ * Free all the pooled FILEINFO records and buffers.
+ */
+{
+    FILEINFO *  file;
+    char *      buf;
+    int         i;
+
+    recycle_files();
+    while ((file = file_pool) != NULL) {
+        file_pool = file->parent;
+        free( file->segs);
+        free( file);
+    }
+    for (i = 0; i < NUM_BUF_CLASS; i++) {
+        while ((buf = buf_pool[ i]) != NULL) {
+            buf_pool[ i] = *(char **) buf;
+            free( buf);
+        }
+    }
+}
+
+static char *   get_buf(
+    size_t      size,                   /* Required size            */
+    size_t *    sizp                    /* Allocated size           */
+)
+/*
+ * Get a buffer of the smallest size class not less than 'size' from the
+ * pool, or allocate a new one.  A buffer larger than any class is simply
+ * malloc()ed.
+ */
+{
+    size_t      csize = BUF_CLASS_MIN;
+    char *      buf;
+    int         i;
+
+    for (i = 0; i < NUM_BUF_CLASS && csize < size; i++)
+        csize <<= 1;
+    if (i == NUM_BUF_CLASS) {
+        *sizp = size;
+        num_bufs++;
+        return  xmalloc( size);
+    }
+    *sizp = csize;
+    if ((buf = buf_pool[ i]) != NULL) {
+        buf_pool[ i] = *(char **) buf;
+        num_bufs_reused++;
+    } else {
+        buf = xmalloc( csize);
+        num_bufs++;
+    }
+    return  buf;
+}
+
+static void put_buf(
+    char *      buf,
+    size_t      size                    /* Allocated size           */
+)
+/*
+ * Return the buffer to the pool of its size class.  A buffer which has been
+ * reallocated to other than a class size is freed.
+ */
+{
+    size_t      csize = BUF_CLASS_MIN;
+    int         i;
+
+    for (i = 0; i < NUM_BUF_CLASS && csize < size; i++)
+        csize <<= 1;
+    if (i == NUM_BUF_CLASS || csize != size) {
+        free( buf);
+        return;
+    }
+    *(char **) buf = buf_pool[ i];
+    buf_pool[ i] = buf;
+}
+
+void    dump_file_pool( void)
+/*
+ * Report the usage of the pools of FILEINFO and of the heap, for the MEMORY
+ * debug class.
+ */
+{
+    mcpp_fprintf( DBG, "FILEINFO: %ld allocated, %ld reused;"
+            " buffers: %ld allocated, %ld reused\n"
+            , num_files, num_files_reused, num_bufs, num_bufs_reused);
+    mcpp_fprintf( DBG, "Heap: %ld xmalloc(), %ld xrealloc()\n"
+            , num_xmalloc, num_xrealloc);
+}
+
 static const char * const   out_of_memory
     = "Out of memory (required size is %.0s0x%lx bytes)";   /* _F_  */
 
@@ -2335,6 +3334,7 @@ char *
 {
     char *      result;
 
+    num_xmalloc++;
     if ((result = (char *) malloc( size)) == NULL) {
         if (mcpp_debug & MEMORY)
             print_heap();
@@ -2353,6 +3353,7 @@ char *  (xrealloc)(
 {
     char *      result;
 
+    num_xrealloc++;
     if ((result = (char *) realloc( ptr, size)) == NULL && size != 0) {
         /* 'size != 0' is necessary to cope with some               */
         /*   implementation of realloc( ptr, 0) which returns NULL. */
@@ -2440,6 +3441,8 @@ static void do_msg(
 {
     FILEINFO *  file;
     DEFBUF *    defp;
+    const char *    name;
+    const char *    under;
     int         i;
     size_t      slen;
     const char *    arg_s[ 2];
@@ -2449,6 +3452,7 @@ static void do_msg(
     int         c;
     int         ind;
 
+    diag_count++;
     fflush( fp_out);                /* Synchronize output and diagnostics   */
     arg_s[ 0] = arg1;  arg_s[ 1] = arg3;
 
@@ -2525,7 +3529,7 @@ static void do_msg(
 
     /* Print source location and diagnostic */
     file = infile;
-    while (file != NULL && (file->fp == NULL || file->fp == (FILE *)-1))
+    while (file != NULL && (file->src == NULL || file->src == (char *)-1))
         file = file->parent;                        /* Skip macro   */
     if (file != NULL) {
         file->line = src_line;
@@ -2538,7 +3542,7 @@ static void do_msg(
 
     /* Print source line, includers and expanding macros    */
     file = infile;
-    if (file != NULL && file->fp != NULL) {
+    if (file != NULL && file->src != NULL) {
         if (mcpp_mode == OLD_PREP) {
             mcpp_fputs( "    ", ERR);
             put_line( file->buffer, fp_err);
@@ -2549,12 +3553,17 @@ static void do_msg(
         file = file->parent;
     }
     while (file != NULL) {                  /* Print #includes, too */
-        if (file->fp == NULL) {             /* Macro                */
-            if (file->filename) {
-                defp = look_id( file->filename);
+        if (file->src == NULL) {            /* Macro                */
+            for (i = file->num_segs < 0 ? 0 : file->num_segs; i >= 0; i--) {
+                name = text_name( file, i);
+                under = i ? text_name( file, i - 1) : file->parent
+                        ? text_name( file->parent, file->parent->num_segs)
+                        : NULL;
+                if (name == NULL)
+                    continue;
+                defp = look_id( name);
                 if ((defp->nargs > DEF_NOARGS_STANDARD)
-                    && ! (file->parent && file->parent->filename
-                        && str_eq( file->filename, file->parent->filename)))
+                        && ! (under && str_eq( name, under)))
                         /* If the name is not duplicate of parent   */
                     dump_a_def( "    macro", defp, FALSE, TRUE, fp_err);
             }
@@ -2589,10 +3598,16 @@ static void do_msg(
                 break;                      /* Already reported     */
         if (ind_done < ind)
             continue;
-        for (file = infile; file; file = file->parent)
-            if (file->fp == NULL && file->filename
-                    && str_eq( expanding_macro[ ind].name, file->filename))
-                break;                      /* Already reported     */
+        for (file = infile; file; file = file->parent) {
+            if (file->src)
+                continue;
+            for (i = file->num_segs < 0 ? 0 : file->num_segs; i >= 0; i--)
+                if ((name = text_name( file, i)) != NULL
+                        && str_eq( expanding_macro[ ind].name, name))
+                    break;                  /* Already reported     */
+            if (i >= 0)
+                break;
+        }
         if (file)
             continue;
         if ((defp = look_id( expanding_macro[ ind].name)) != NULL) {
@@ -2608,6 +3623,20 @@ free_arg:
         free( arg_t[ i]);
 }
 
+static const char *     text_name(
+    const FILEINFO *    file,
+    int         i               /* Index into segs[], or 'num_segs' */
+)
+/*
+ * Return the name of the macro of the i'th text stacked on the "file" by
+ * push_text(), or the name of the "file" made by unget_string().
+ */
+{
+    if (file->num_segs < 0)
+        return  file->filename;
+    return  i == file->num_segs ? file->real_fname : file->segs[ i].name;
+}
+
 void    cfatal(
     const char *    format,
     const char *    arg1,
@@ -2780,6 +3809,7 @@ void    dump_unget(
  */
 {
     const FILEINFO *    file;
+    const char *    name;
 
     mcpp_fputs( "dump of pending input text", DBG);
     if (why != NULL) {
@@ -2788,9 +3818,21 @@ void    dump_unget(
     }
     mcpp_fputc( '\n', DBG);
 
-    for (file = infile; file != NULL; file = file->parent)
+    for (file = infile; file != NULL; file = file->parent) {
+        if (file->num_segs >= 0) {      /* Texts stacked by push_text() */
+            const char *    cp = file->bptr;
+            int     i;
+
+            for (i = file->num_segs; i >= 0; i--) {
+                dump_string( (name = text_name( file, i)) ? name : "NULL"
+                        , cp);
+                cp += strlen( cp) + 1;
+            }
+            continue;
+        }
         dump_string( file->real_fname ? file->real_fname
                 : file->filename ? file->filename : "NULL", file->bptr);
+    }
 }
 
 static void dump_token(
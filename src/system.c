@@ -48,6 +48,8 @@
 #define __USE_XOPEN_EXTENDED
 #endif
 #include    <unistd.h>              /* For getcwd(), readlink() */
+#include    <sys/mman.h>            /* For mmap()               */
+#include    <dirent.h>              /* For opendir(), readdir() */
 #elif   HOST_COMPILER == MSC || HOST_COMPILER == LCC
 #include    "direct.h"
 #define getcwd( buf, size)  _getcwd( buf, size)
@@ -66,6 +68,16 @@
 #define S_IFDIR     _S_IFDIR
 #define stat( path, stbuf)  _stat( path, stbuf)
 #endif
+#if     HOST_SYS_FAMILY == SYS_UNIX && defined( st_mtime)
+            /* st_mtime is a member of struct timespec of POSIX.1-2008  */
+#if     HOST_SYSTEM == SYS_MAC
+#define mtime_nsec( st)     ((long) (st).st_mtimespec.tv_nsec)
+#else
+#define mtime_nsec( st)     ((long) (st).st_mtim.tv_nsec)
+#endif
+#else
+#define mtime_nsec( st)     0L
+#endif
 
 /* Function to compare path-list    */
 #if     FNAME_FOLD
@@ -151,6 +163,8 @@ static char *   norm_path( const char * dir, const char * fname, int inf
 #if SYS_FAMILY == SYS_UNIX
 static void     deref_syml( char * slbuf1, char * slbuf2, char * chk_start);
                 /* Dereference symbolic linked directory and file   */
+static int      read_link( const char * dname, char * buf);
+                /* readlink() memoized in a run     */
 #endif
 #if COMPILER == GNUC
 static void     init_gcc_macro( void);
@@ -180,8 +194,31 @@ static int      search_dir( char * filename, int searchlocal, int next);
 static int      open_file( const char ** dirp, const char * src_dir
         , const char * filename, int local, int include_opt, int sys_frame);
                 /* Open a source file       */
+static void     load_file( FILEINFO * file, FILE * fp);
+                /* Read whole text of the file  */
 static const char *     set_fname( const char * filename);
                 /* Remember the source filename     */
+static struct fname_entry *     find_fname( const char * name, int add);
+                /* Look up the registry of names    */
+static struct fname_entry *     file_entry( const char * fullname);
+                /* The entry to record the file on  */
+static unsigned path_hash( const char * name, size_t len);
+                /* Hash value of a path-list        */
+static char *   cached_path( const char * dir, const char * fname);
+                /* norm_path() memoized             */
+static struct path_cache *  look_path( const char * name, int kind
+        , int add);
+                /* Look up the cache of path-lists  */
+static void     chk_dir( struct path_cache * dcp);
+                /* Check the directory once a run   */
+static int      indexed( char * key, size_t base_len);
+                /* The path-list may exist?         */
+static int      dir_has( struct path_cache * dcp, const char * name);
+                /* The directory may have the name? */
+static void     list_dir( struct path_cache * dcp);
+                /* Index the names in the directory */
+static void     unlist_dir( struct path_cache * dcp);
+                /* Remove the index of the directory    */
 #if SYSTEM == SYS_MAC
 #if COMPILER == GNUC
 static char *   search_header_map( const char * hmap_file
@@ -214,6 +251,8 @@ static void     do_once( const char * fullname);
                 /* Process #pragma once             */
 static int      included( const char * fullname);
                 /* The file has been once included? */
+static int      guarded( const char * fullname);
+                /* The guard of the file is defined?*/
 static void     push_or_pop( int direction);
                 /* Push or pop a macro definition   */
 static int      do_prestd_directive( void);
@@ -247,27 +286,112 @@ static const char **    incdir;         /* Include directories      */
 static const char **    incend;         /* -> active end of incdir  */
 static int          max_inc;            /* Number of incdir[]       */
 
-typedef struct inc_list {       /* List of directories or files     */
-    char *      name;           /* Filename or directory-name       */
-    size_t      len;                    /* Length of 'name'         */
-} INC_LIST;
-
 /*
- * fnamelist[] stores the souce file names opened by #include directive for
- * debugging information.
+ * fname_table[] is the hash table of the source file names opened by
+ * #include directive and their full-path-lists.  set_fname() registers a
+ * name and returns its copy, which is used as file->real_fname and
+ * file->full_fname.  The entry of a full-path-list records also #pragma
+ * once, the include guard detected by chk_guard() of directive.c and the
+ * output to the dependency line of the file.  A #pragma once file is not
+ * opened again, nor is a guarded file while the macro of its guard is
+ * defined, except in the macro notification mode.  With -H option a file
+ * may be reached by several path-lists through symbolic links, hence
+ * #pragma once and the guard are recorded on the entry keyed by the device
+ * and the i-node of the file, which is shared by all of its path-lists.
  */
-static INC_LIST *   fnamelist;          /* Source file names        */
-static INC_LIST *   fname_end;          /* -> active end of fnamelist   */
-static int          max_fnamelist;      /* Number of fnamelist[]    */
+typedef struct fname_entry {    /* Registered file name             */
+    struct fname_entry *    next;   /* Next entry of the hash chain */
+    const char *    name;       /* Filename or full-path-list       */
+    size_t          len;                    /* Length of 'name'         */
+    unsigned        hash;       /* Hash value of 'name'             */
+    int             once;       /* #pragma once has been seen       */
+    int             depend;     /* Recorded in the dependency line  */
+    ATOM *          guard;      /* Macro of the include guard       */
+    struct fname_entry *    same;   /* Entry of the file with -H    */
+} FNAME_ENTRY;
+static FNAME_ENTRY **   fname_table;    /* Hash table of file names */
+static int          fname_tsize;        /* Number of fname_table[]  */
+static int          fname_num;          /* Number of the entries    */
+static long         guard_num;      /* Number of guarded files      */
+static long         once_skipped;   /* Opens avoided by #pragma once    */
+static long         guard_skipped;  /* Opens avoided by include guards  */
 
-/* once_list[] stores the #pragma once file names.  */
-static INC_LIST *   once_list;          /* Once opened file         */
-static INC_LIST *   once_end;           /* -> active end of once_list   */
-static int          max_once;           /* Number of once_list[]    */
+/*
+ * path_table[] is the hash table memoizing the results of norm_path() on
+ * the path-lists probed by open_file(), that is, the include directory (or
+ * the current directory) and the spelled file name possibly preceded by the
+ * source directory of the includer.  As the path-list is determined by the
+ * header name, "header" or <header>, the includer's directory and the start
+ * of #include_next search, an #include resolves without stat() nor
+ * readlink() once the same path-list has been probed, whether the file has
+ * been found or not.
+ * The table is kept over the calls of mcpp_lib_main().  An entry is valid
+ * while the directory of the file has not changed: the modified time (in
+ * nanoseconds where available), the status changed time, the inode and the
+ * device of the directory are checked once in a run of the preprocessing.
+ * As a change in the same second as the check may leave the times as they
+ * were, a directory modified in the second of the check is regarded as
+ * changed in the next run, as git does on "racily clean" entries.  A
+ * path-list resolved via a symbolic link is valid only in the run, since
+ * the link may be changed without a change of the directory.
+ * With -B option, the names in a directory are also registered by readdir()
+ * when the directory is looked into at first (or after it has changed), so
+ * that the path-list of a non-existent header is rejected without stat().
+ * The names of the former listing are removed then.  A directory which
+ * cannot be listed is left to norm_path().
+ * The results of readlink() on the directory parts of path-lists are also
+ * memoized while a run, so that only the last component of a path-list
+ * requires readlink() in norm_path().
+ */
+typedef struct path_cache {     /* Probed path-list or directory    */
+    struct path_cache *     next;   /* Next entry of the hash chain */
+    char *          name;   /* Absolute path-list (not normalized)  */
+    size_t          len;                    /* Length of 'name'         */
+    unsigned        hash;       /* Hash value of 'name'             */
+    int             kind;       /* PATH_PROBED, PATH_DIR, ...       */
+    struct path_cache *     dir;    /* Entry of the directory of file   */
+    struct path_cache *     list;   /* Names listed in the directory,   */
+                                    /*   or next name of the directory  */
+    char *          norm;   /* Result of norm_path(), maybe NULL    */
+    int             errnum;     /* errno left by norm_path()        */
+    int             no_syml;    /* Probed with -H option            */
+    int             syml;       /* Resolved via a symbolic link     */
+    long            gen;    /* Generation of dir, or of the result  */
+    long            checked;    /* Run of the last check or probe   */
+    time_t          mtime;      /* Modified time of the directory   */
+    long            mtime_ns;   /*   and its nanoseconds            */
+    time_t          ctime;      /* Status changed time of directory */
+    unsigned long   ino;        /* Inode of the directory           */
+    unsigned long   dev;        /* Device of the directory          */
+    int             racy;       /* Changed in the second of check   */
+    int             exists;     /* The directory exists             */
+    long            list_gen;   /* Generation of dir when listed    */
+    int             listable;   /* The directory could be listed    */
+} PATH_CACHE;
+static PATH_CACHE **    path_table;     /* Hash table of path-lists */
+static int          path_tsize;         /* Number of path_table[]   */
+static int          path_num;           /* Number of the entries    */
+static long         path_run = 1L;      /* Runs counted from 1      */
+static long         path_hits;          /* Resolved by the cache    */
+static long         path_misses;        /* Resolved by norm_path()  */
+static long         path_rejected;      /* Rejected by the index    */
+static int          dir_index = FALSE;  /* Flag of -B option        */
+static int          no_syml = FALSE;    /* Flag of -H option        */
+static int          syml_found;         /* readlink() found a link  */
+static long         num_stat;           /* Calls of stat()          */
+static long         num_readlink;       /* Calls of readlink()      */
+static long         num_fopen;          /* Calls of fopen() of headers  */
+static long         num_fopen_failed;   /* Failures of the fopen()  */
+static long         num_opendir;        /* Calls of opendir()       */
+
+#define PATH_PROBED     0       /* Path-list probed by norm_path()  */
+#define PATH_DIR        1       /* Directory with PATH_DELIM        */
+#define PATH_LISTED     2       /* Path-list found by readdir()     */
+#define PATH_LINK       3       /* Directory probed by readlink()   */
 
 #define INIT_NUM_INCLUDE    32          /* Initial number of incdir[]   */
-#define INIT_NUM_FNAMELIST  256         /* Initial number of fnamelist[]    */
-#define INIT_NUM_ONCE       64          /* Initial number of once_list[]    */
+#define INIT_NUM_FNAME      256         /* Initial number of fname_table[]  */
+#define INIT_NUM_PATH       1024        /* Initial number of path_table[]   */
 
 /*
  * 'search_rule' holds searching rule of #include "header.h" to search first
@@ -374,9 +498,15 @@ void    init_system( void)
         free( sharp_filename);
     sharp_filename = NULL;
     incend = incdir = NULL;
-    fnamelist = once_list = NULL;
+    fname_table = NULL;
+    fname_tsize = fname_num = 0;
+    guard_num = once_skipped = guard_skipped = 0L;
+    path_run++;                         /* path_table[] is kept     */
+    path_hits = path_misses = path_rejected = 0L;
+    num_stat = num_readlink = num_fopen = num_fopen_failed = num_opendir
+            = 0L;
     search_rule = SEARCH_INIT;
-    mb_changed = nflag = ansi = compat_mode = FALSE;
+    mb_changed = nflag = ansi = compat_mode = dir_index = no_syml = FALSE;
     mkdep_fp = NULL;
     mkdep_target = mkdep_mf = mkdep_md = mkdep_mq = mkdep_mt = NULL;
     std_val = -1L;
@@ -408,7 +538,7 @@ void    init_system( void)
 
 #endif
 
-#define OPTLISTLEN  80
+#define OPTLISTLEN  96
 
 void    do_options(
     int         argc,
@@ -600,6 +730,16 @@ plus:
             break;                  /*   mation in C source style.  */
 #endif
 
+        case 'B':                   /* Index the include directories    */
+            dir_index = TRUE;
+            break;
+
+#if COMPILER != GNUC
+        case 'H':               /* Don't dereference symbolic links */
+            no_syml = TRUE;
+            break;
+#endif
+
         case 'C':                           /* Keep comments        */
             option_flags.c = TRUE;
             break;
@@ -674,6 +814,8 @@ plus:
                 option_flags.dollar_in_name = FALSE;
             } else if (str_eq( mcpp_optarg, "no-show-column")) {
                 ;                           /* Ignore this option   */
+            } else if (str_eq( mcpp_optarg, "no-canonical-system-headers")) {
+                no_syml = TRUE;     /* Don't dereference symbolic links */
             } else if (! integrated_cpp) {
                 usage( opt);
             }
@@ -871,6 +1013,23 @@ plus:
             break;
 #endif  /* COMPILER == GNUC */
 
+        case 'L':
+#if MCPP_LIB
+            if (mcpp_fputc != mcpp_lib_fputc || mcpp_fputs != mcpp_lib_fputs
+                    || mcpp_fprintf != mcpp_lib_fprintf)
+                /* The output lines are counted by these    */
+                cfatal( "Can't use -L with mcpp_set_out_func()"  /* _F_  */
+                        , NULL, 0L, NULL);
+#endif
+            open_src_map( mcpp_optarg);
+            /*
+             * Record the source locations and the macro calls of the
+             * output lines into the binary file.
+             */
+            option_flags.k = TRUE;
+            /* Keep white spaces to locate the tokens in source as -K   */
+            break;
+
         case 'M':           /* Output source file dependency line   */
             if (str_eq( mcpp_optarg, "M")) {                /* -MM  */
                 ;
@@ -1261,6 +1420,32 @@ Version:
             break;
 #endif
 
+        case 'Y':
+#if MCPP_LIB
+            if (mcpp_fputc != mcpp_lib_fputc || mcpp_fputs != mcpp_lib_fputs
+                    || mcpp_fprintf != mcpp_lib_fprintf)
+                /* The offsets in the output are counted by these   */
+                cfatal( "Can't use -Y with mcpp_set_out_func()"  /* _F_  */
+                        , NULL, 0L, NULL);
+#endif
+            open_mac_map( mcpp_optarg);
+            /*
+             * Record macro calls into the binary file, instead of -K
+             * option's annotations embedded in the output.
+             */
+            option_flags.k = TRUE;
+            /* Keep white spaces to locate the calls in source as -K    */
+            break;
+
+        case 'y':
+            open_profile( mcpp_optarg);
+            mcpp_debug |= PROFILE;
+            /*
+             * Profile the macro expansions and write the report into the
+             * file as '#pragma MCPP debug profile' does to stdout.
+             */
+            break;
+
         case 'z':
             option_flags.z = TRUE;  /* No output of included file   */
             break;
@@ -1434,6 +1619,9 @@ static void usage(
 "-arch <arch>        Change the target to <arch> (i386, x86_64, ppc, ppc64).\n",
 #endif
 
+"-B          Index the contents of the include directories to reject absent\n",
+"            headers without system calls.\n",
+
 #if ! STD_LINE_PREFIX
 "-b          Output #line lines in C source style.\n",
 #endif
@@ -1450,6 +1638,9 @@ static void usage(
 #if COMPILER == GNUC
 "-finput-charset=<encoding>      Same as -e <encoding>.\n",
 "            (Don't insert spaces around '=').\n",
+"-fno-canonical-system-headers   Don't dereference the symbolic links in\n",
+"            the path-lists of any include files, which are named in the\n",
+"            output as they are found.\n",
 #endif
 #if COMPILER == MSC
 "-Fl <file>  Include the <file> prior to the main input file.\n",
@@ -1535,6 +1726,10 @@ static void usage(
 "-digraphs   Enable digraphs.\n",
 #endif
 
+#if COMPILER != GNUC
+"-H          Don't dereference the symbolic links in the path-lists of the\n",
+"            include files, which are named in the output as they are found.\n",
+#endif
 "-h <n>      Re-define the pre-defined macro __STDC_HOSTED__ as <n>.\n",
 
 #if COMPILER == GNUC
@@ -1572,6 +1767,11 @@ static void usage(
 "-3          Enable trigraphs.\n",
 #endif
 "-K          Output macro annotations embedding in comments.\n",
+"-Y <file>   Record macro calls into the binary <file> instead of -K, with -k.\n",
+"-L <file>   Record the source map of the output into the binary <file>, with\n",
+"            -k.\n",
+"-y <file>   Profile the macro expansions into <file>, in JSON if it is named\n",
+"            *.json, otherwise in CSV.\n",
 #if COMPILER == GNUC
 "-trigraphs  Enable trigraphs.\n",
 #endif
@@ -1635,6 +1835,9 @@ static void set_opt_list(
 #if COMPILER != GNUC && COMPILER != MSC
     "a",
 #endif
+#if COMPILER != GNUC
+    "H",                /* GCC's -H is to print the names of headers    */
+#endif
 #if SYSTEM == SYS_MAC
     "F:-:",
 #endif
@@ -1644,7 +1847,7 @@ static void set_opt_list(
 
     const char * const *    lp = & list[ 0];
 
-    strcpy( optlist, "23+@:e:h:jkn:o:vzCD:I:KM:NPQS:U:V:W:");
+    strcpy( optlist, "23+@:e:h:jkn:o:vy:zBCD:I:KL:M:NPQS:U:V:W:Y:");
                                                 /* Default options  */
     while (*lp)
         strcat( optlist, *lp++);
@@ -1787,7 +1990,8 @@ static void     chk_opts(
         else
             option_flags.trig = FALSE;
     }
-    if (mcpp_mode != STD && (mcpp_debug & MACRO_CALL))
+    if (mcpp_mode != STD && ((mcpp_debug & (MACRO_CALL | PROFILE))
+                || fp_mac_map || fp_src_map))
         incompat = TRUE;
     if ((mcpp_debug & MACRO_CALL)
                 && (option_flags.lang_asm || option_flags.c)) {
@@ -2476,6 +2680,7 @@ static char *   norm_path(
     }
     if (fname)
         strcat( slbuf1, fname);
+    num_stat++;
     if (stat( slbuf1, & st_buf) != 0        /* Non-existent         */
             || (! fname && ! S_ISDIR( st_buf.st_mode))
                 /* Not a directory though 'fname' is not specified  */
@@ -2500,18 +2705,24 @@ static char *   norm_path(
     }
 #if SYS_FAMILY == SYS_UNIX
     /* Dereference symbolic linked directory or file, if any    */
-    slbuf1[ len] = EOS;     /* Truncate PATH_DELIM and 'fname' part, if any */
     slbuf2[ 0] = EOS;
-    if (*dir && ! fname) {      /* Registering include directory    */
+    if (no_syml) {              /* -H: The path-list is canonical   */
+        if (*dir || fname)
+            errno = EINVAL;
+            /* Leave errno as the skipped readlink() of a non-link  */
+    } else if (*dir && ! fname) {   /* Registering include directory    */
         /* Symbolic link check of directories are required  */
         deref_syml( slbuf1, slbuf2, slbuf1);
     } else if (fname) {                             /* Regular file */
+        slbuf1[ len] = EOS;         /* Truncate 'fname' part        */
         len = strlen( slbuf1);
         strcat( slbuf1, fname);
         deref_syml( slbuf1, slbuf2, slbuf1 + len);
                                 /* Symbolic link check of directory */
+        num_readlink++;
         if ((len = readlink( slbuf1, slbuf2, PATHMAX)) > 0) {
             /* Dereference symbolic linked file (not directory) */
+            syml_found = TRUE;
             *(slbuf2 + len) = EOS;
             cp1 = slbuf1;
             if (slbuf2[ 0] != PATH_DELIM) {     /* Relative path    */
@@ -2671,6 +2882,333 @@ static char *   norm_path(
     return  norm_name;
 }
 
+static char *   cached_path(
+    const char *    dir,        /* Include directory (maybe "", never NULL) */
+    const char *    fname                   /* Filename             */
+)
+/*
+ * norm_path( dir, fname, TRUE, FALSE) memoized in path_table[].
+ * This routine is only called from open_file().
+ */
+{
+    char    key[ PATHMAX * 3 + 1];  /* Absolute path-list to look up   */
+    char *  cp;
+    char *  norm;
+    PATH_CACHE *    pcp;
+    PATH_CACHE *    dcp;
+    size_t  base_len = 0;           /* Length of the directory part */
+    int     c;
+
+    if (strlen( dir) + strlen( fname) >= PATHMAX)
+        return  norm_path( dir, fname, TRUE, FALSE);
+    cp = key;
+    if (! is_full_path( *dir ? dir : fname))
+        cp = stpcpy( cp, cur_work_dir);     /* Relative path        */
+    cp = stpcpy( cp, dir);
+    if (*dir && *(cp - 1) != PATH_DELIM)
+        *cp++ = PATH_DELIM;
+    if (cp > key && ! is_full_path( fname))
+        base_len = cp - key;
+    strcpy( cp, fname);
+
+    pcp = look_path( key, PATH_PROBED, TRUE);
+    if ((dcp = pcp->dir) == NULL) {         /* New entry            */
+        cp = strrchr( key, PATH_DELIM) + 1;
+        c = *cp;
+        *cp = EOS;                  /* Directory part with PATH_DELIM   */
+        dcp = pcp->dir = look_path( key, PATH_DIR, TRUE);
+        *cp = c;
+    }
+    chk_dir( dcp);
+
+    if (pcp->gen == dcp->gen && pcp->no_syml == no_syml
+            && (! pcp->syml || pcp->checked == path_run)) {
+                                        /* Memoized in this state   */
+        path_hits++;
+        errno = pcp->errnum;        /* errno may be the exit status */
+        if (pcp->norm == NULL)
+            return  NULL;
+        return  strcpy( xmalloc( strlen( pcp->norm) + 1), pcp->norm);
+    }
+    syml_found = FALSE;
+    if (dir_index && base_len && ! indexed( key, base_len)) {
+        path_rejected++;
+        norm = NULL;
+        errno = ENOENT;             /* As stat() would have set     */
+    } else {
+        path_misses++;
+        norm = norm_path( dir, fname, TRUE, FALSE);
+    }
+    pcp->errnum = errno;
+    free( pcp->norm);
+    pcp->norm = norm ? strcpy( xmalloc( strlen( norm) + 1), norm) : NULL;
+    pcp->gen = dcp->gen;
+    pcp->no_syml = no_syml;
+    pcp->syml = syml_found;
+    pcp->checked = path_run;
+    return  norm;
+}
+
+static void     chk_dir(
+    PATH_CACHE *    dcp                 /* Entry of a directory     */
+)
+/*
+ * Check the times, the inode and the device of the directory on the first
+ * look in this run, and renew the generation of the directory if it has
+ * changed or it was changed in the second of the last check.
+ */
+{
+    char    dname[ PATHMAX * 3 + 1];
+#if HOST_COMPILER == MSC
+    struct _stat    st_buf;
+#else
+    struct stat     st_buf;
+#endif
+    time_t  now;
+
+    if (dcp->checked == path_run)
+        return;
+    strcpy( dname, dcp->name);
+    if (dcp->len > 1 && dname[ dcp->len - 2] != ':')
+        dname[ dcp->len - 1] = EOS;     /* stat() may dislike trailing '/'  */
+    num_stat++;
+    if (stat( dname, & st_buf) == 0) {
+        if (! dcp->exists || dcp->racy || dcp->mtime != st_buf.st_mtime
+                || dcp->mtime_ns != mtime_nsec( st_buf)
+                || dcp->ctime != st_buf.st_ctime
+                || dcp->ino != (unsigned long) st_buf.st_ino
+                || dcp->dev != (unsigned long) st_buf.st_dev)
+            dcp->gen++;                 /* Directory has changed    */
+        dcp->exists = TRUE;
+        dcp->mtime = st_buf.st_mtime;
+        dcp->mtime_ns = mtime_nsec( st_buf);
+        dcp->ctime = st_buf.st_ctime;
+        dcp->ino = (unsigned long) st_buf.st_ino;
+        dcp->dev = (unsigned long) st_buf.st_dev;
+        now = time( NULL);
+        /* A change later in this second may leave the times unchanged  */
+        dcp->racy = st_buf.st_mtime >= now || st_buf.st_ctime >= now;
+    } else {
+        if (dcp->exists || dcp->checked == 0L)
+            dcp->gen++;
+        dcp->exists = FALSE;
+        dcp->racy = FALSE;
+    }
+    dcp->checked = path_run;
+}
+
+static int      indexed(
+    char *      key,                    /* Absolute path-list       */
+    size_t      base_len                /* Length of the directory  */
+)
+/*
+ * Check the components of the path-list after 'base_len' one by one with
+ * the index of the directories.  Return FALSE if the path-list surely does
+ * not exist, otherwise TRUE.  "." and ".." are left to norm_path().
+ * 'key' and errno are restored on return.
+ */
+{
+    PATH_CACHE *    dcp;
+    char *  name = key + base_len;
+    char *  cp;
+    int     c;
+    int     found = TRUE;
+    int     errnum = errno;             /* errno may be the exit status */
+
+    c = *name;
+    *name = EOS;
+    dcp = look_path( key, PATH_DIR, TRUE);
+    *name = c;
+    while ((cp = strchr( name, PATH_DELIM)) != NULL) {
+        *cp = EOS;
+        if (*name == EOS || str_eq( name, ".") || str_eq( name, "..")
+                || ! (found = dir_has( dcp, name))) {
+            *cp = PATH_DELIM;
+            break;
+        }
+        *cp++ = PATH_DELIM;
+        c = *cp;
+        *cp = EOS;                  /* Subdirectory with PATH_DELIM */
+        dcp = look_path( key, PATH_DIR, TRUE);
+        *cp = c;
+        name = cp;
+    }
+    if (cp == NULL)                     /* The last component       */
+        found = dir_has( dcp, name);
+    errno = errnum;
+    return  found;
+}
+
+static int      dir_has(
+    PATH_CACHE *    dcp,                /* Entry of a directory     */
+    const char *    name                /* Name in the directory    */
+)
+/*
+ * Return FALSE if the directory surely has not the name, otherwise TRUE.
+ */
+{
+    char    path[ PATHMAX * 3 + 1];
+    PATH_CACHE *    ep;
+
+    chk_dir( dcp);
+    if (dcp->list_gen != dcp->gen)      /* Not listed in this state */
+        list_dir( dcp);
+    if (! dcp->listable)
+        return  TRUE;
+    if (dcp->len + strlen( name) >= sizeof path)
+        return  TRUE;
+    strcpy( stpcpy( path, dcp->name), name);
+    ep = look_path( path, PATH_LISTED, FALSE);
+    return  ep != NULL && ep->gen == dcp->gen;
+}
+
+static void     list_dir(
+    PATH_CACHE *    dcp                 /* Entry of a directory     */
+)
+/*
+ * Register the names in the directory into path_table[] with the current
+ * generation of the directory, removing the names registered in the older
+ * generation.  A directory which does not exist or cannot be opened is not
+ * listable, nor is a directory of case-insensitive file system unless the
+ * path-lists are compared ignoring the case.
+ */
+{
+#if HOST_SYS_FAMILY == SYS_UNIX
+    char    path[ PATHMAX * 3 + 1];
+    DIR *   dirp;
+    struct dirent *     dp;
+    PATH_CACHE *    ep;
+    int     listable = TRUE;
+#endif
+
+    dcp->list_gen = dcp->gen;
+    dcp->listable = FALSE;
+    unlist_dir( dcp);
+#if HOST_SYS_FAMILY == SYS_UNIX
+    if (! dcp->exists)
+        return;                         /* Left to norm_path()      */
+    strcpy( path, dcp->name);
+#if ! FNAME_FOLD && defined( _PC_CASE_SENSITIVE)
+    if (pathconf( path, _PC_CASE_SENSITIVE) == 0)
+        return;     /* A name of another case would be missed in index  */
+#endif
+    num_opendir++;
+    if ((dirp = opendir( path)) == NULL)
+        return;
+    while ((dp = readdir( dirp)) != NULL) {
+        if (str_eq( dp->d_name, ".") || str_eq( dp->d_name, ".."))
+            continue;
+        if (dcp->len + strlen( dp->d_name) >= sizeof path) {
+            listable = FALSE;           /* Cannot be registered     */
+            continue;
+        }
+        strcpy( path + dcp->len, dp->d_name);
+        ep = look_path( path, PATH_LISTED, TRUE);
+        if (ep->gen != dcp->gen) {      /* Not a name folded to one */
+            ep->gen = dcp->gen;
+            ep->list = dcp->list;
+            dcp->list = ep;
+        }
+    }
+    closedir( dirp);
+    dcp->listable = listable;
+#endif
+}
+
+static void     unlist_dir(
+    PATH_CACHE *    dcp                 /* Entry of a directory     */
+)
+/*
+ * Remove the names listed in the directory from path_table[] and free them.
+ */
+{
+    PATH_CACHE *    ep;
+    PATH_CACHE **   epp;
+
+    while ((ep = dcp->list) != NULL) {
+        dcp->list = ep->list;
+        epp = &path_table[ ep->hash & (path_tsize - 1)];
+        while (*epp != ep)
+            epp = &(*epp)->next;
+        *epp = ep->next;
+        free( ep);
+        path_num--;
+    }
+}
+
+static PATH_CACHE *     look_path(
+    const char *    name,               /* Absolute path-list       */
+    int     kind,                       /* PATH_PROBED, PATH_DIR, ...   */
+    int     add                         /* Append if not found      */
+)
+/*
+ * Search path_table[] for the name of the kind, and append a new entry if
+ * not found and 'add' is TRUE.
+ */
+{
+    PATH_CACHE *    pcp;
+    PATH_CACHE **   old_table;
+    size_t      len = strlen( name);
+    unsigned    hash = path_hash( name, len);
+    int         i;
+
+    if (path_table != NULL) {
+        for (pcp = path_table[ hash & (path_tsize - 1)]; pcp != NULL;
+                pcp = pcp->next) {
+            if (pcp->hash == hash && pcp->len == len
+                    && pcp->kind == kind && str_case_eq( pcp->name, name))
+                return  pcp;
+        }
+    }
+    if (! add)
+        return  NULL;
+
+    if (path_table == NULL) {           /* Should be initialized    */
+        path_tsize = INIT_NUM_PATH;
+        path_table = (PATH_CACHE **) xmalloc( sizeof (PATH_CACHE *)
+                * path_tsize);
+        memset( path_table, 0, sizeof (PATH_CACHE *) * path_tsize);
+    } else if (path_num >= path_tsize) {
+                            /* Table full: double the hash chains   */
+        old_table = path_table;
+        path_table = (PATH_CACHE **) xmalloc( sizeof (PATH_CACHE *)
+                * path_tsize * 2);
+        memset( path_table, 0, sizeof (PATH_CACHE *) * path_tsize * 2);
+        for (i = 0; i < path_tsize; i++) {
+            while ((pcp = old_table[ i]) != NULL) {
+                old_table[ i] = pcp->next;
+                pcp->next = path_table[ pcp->hash & (path_tsize * 2 - 1)];
+                path_table[ pcp->hash & (path_tsize * 2 - 1)] = pcp;
+            }
+        }
+        free( old_table);
+        path_tsize *= 2;
+    }
+
+    pcp = (PATH_CACHE *) xmalloc( sizeof (PATH_CACHE) + len + 1);
+    pcp->name = memcpy( pcp + 1, name, len + 1);
+    pcp->len = len;
+    pcp->hash = hash;
+    pcp->kind = kind;
+    pcp->dir = pcp->list = NULL;
+    pcp->norm = NULL;
+    pcp->errnum = 0;
+    pcp->no_syml = pcp->syml = FALSE;
+    pcp->gen = kind == PATH_DIR ? 0L : -1L; /* Not valid yet        */
+    pcp->checked = 0L;
+    pcp->mtime = pcp->ctime = 0;
+    pcp->mtime_ns = 0L;
+    pcp->ino = pcp->dev = 0L;
+    pcp->racy = pcp->exists = FALSE;
+    pcp->list_gen = -1L;
+    pcp->listable = FALSE;
+    pcp->next = path_table[ hash & (path_tsize - 1)];
+    path_table[ hash & (path_tsize - 1)] = pcp;
+    path_num++;
+
+    return  pcp;
+}
+
 #if SYS_FAMILY == SYS_UNIX
 
 static void     deref_syml(
@@ -2685,7 +3223,7 @@ static void     deref_syml(
 
     while ((chk_start = strchr( chk_start, PATH_DELIM)) != NULL) {
         *chk_start = EOS;
-        if ((len = readlink( slbuf1, slbuf2, PATHMAX)) > 0) {
+        if ((len = read_link( slbuf1, slbuf2)) > 0) {
             /* Dereference symbolic linked directory    */
             cp2 = strrchr( slbuf1, PATH_DELIM); /* Previous delimiter       */
             *chk_start = PATH_DELIM;
@@ -2706,6 +3244,41 @@ static void     deref_syml(
         }
     }
 }
+
+static int      read_link(
+    const char *    dname,              /* Directory part of a path */
+    char *          buf                 /* Buffer of PATHMAX + 1    */
+)
+/*
+ * readlink( dname, buf, PATHMAX) memoized in path_table[] while a run.
+ * errno is restored as readlink() would have left it.
+ */
+{
+    PATH_CACHE *    pcp = look_path( dname, PATH_LINK, TRUE);
+    int     len;
+
+    if (pcp->checked == path_run) {     /* Memoized in this run     */
+        if (pcp->norm == NULL) {
+            errno = pcp->errnum;
+            return  -1;
+        }
+        syml_found = TRUE;
+        return  (int) (stpcpy( buf, pcp->norm) - buf);
+    }
+    num_readlink++;
+    len = readlink( dname, buf, PATHMAX);
+    free( pcp->norm);
+    if (len > 0) {                      /* A symbolic link          */
+        syml_found = TRUE;
+        buf[ len] = EOS;
+        pcp->norm = strcpy( xmalloc( len + 1), buf);
+    } else {
+        pcp->norm = NULL;
+        pcp->errnum = errno;
+    }
+    pcp->checked = path_run;
+    return  len;
+}
 #endif
 
 #if COMPILER == GNUC
@@ -2889,6 +3462,7 @@ void    put_depend(
     static size_t   llen;       /* Length of current physical output line   */
     size_t *        pos_p;                  /* Index into pos[]     */
     size_t          fnamlen;                /* Length of filename   */
+    FNAME_ENTRY *   fnamep;                 /* Registered filename  */
 
     if (fp == NULL) {   /* Main source file.  Have to initialize.   */
 #if MCPP_LIB
@@ -2952,12 +3526,11 @@ void    put_depend(
         return;
     }
 
-    fnamlen = strlen( filename);
-    /* Check the recorded filename  */
-    for (pos_p = pos; pos_p < &pos[ pos_num]; pos_p++) {
-        if (memcmp( output + *pos_p, filename, fnamlen) == 0)
-            return;                 /* Already recorded filename    */
-    }
+    fnamep = find_fname( filename, TRUE);
+    if (fnamep->depend)
+        return;                     /* Already recorded filename    */
+    fnamep->depend = TRUE;
+    fnamlen = fnamep->len;
     /* Any new header.  Append its name to output.  */
     if (llen + fnamlen > MAX_OUT_LEN) {         /* Line is long     */
         out_p = stpcpy( out_p, " \\\n ");       /* Fold it          */
@@ -3177,8 +3750,7 @@ found_name:
     }
 #endif
     if (open_include( filename, (delim == '"'), next)) {
-        /* 'fname' should not be free()ed, it is used as file->         */
-        /*      real_fname and has been registered into fnamelist[]     */
+        free( fname);   /* file->real_fname is the copy in fname_table[]   */
         return  TRUE;
     }
 
@@ -3394,12 +3966,6 @@ static int  open_file(
  */
 {
     char        dir_fname[ PATHMAX] = { EOS, };
-#if HOST_COMPILER == BORLANDC
-    /* Borland's fopen() does not set errno.    */
-    static int  max_open = FOPEN_MAX - 5;
-#else
-    static int  max_open;
-#endif
     int         len;
     FILEINFO *  file = infile;
     FILE *      fp;
@@ -3433,48 +3999,30 @@ static int  open_file(
         fname = filename;
     }
 search:
-    fullname = norm_path( *dirp, fname, TRUE, FALSE);
+    fullname = cached_path( *dirp, fname);
                                     /* Convert to absolute path     */
     if (! fullname)                 /* Non-existent or directory    */
         return  FALSE;
-    if (standard && included( fullname))        /* Once included    */
+    if (standard && (included( fullname) || guarded( fullname))) {
+        free( fullname);                /* Need not to open again   */
         goto  true;
+    }
         
-    if ((max_open != 0 && max_open <= include_nest)
-                            /* Exceed the known limit of open files */
-            || ((fp = fopen( fullname, "r")) == NULL && errno == EMFILE)) {
-                            /* Reached the limit for the first time */
-        if (mcpp_debug & PATH) {
-#if HOST_COMPILER == BORLANDC
-            if (include_nest == FOPEN_MAX - 5)
-#else
-            if (max_open == 0)
-#endif
-                mcpp_fprintf( DBG,
-    "#include nest reached at the maximum of system: %d, returned errno: %d\n"
-                    , include_nest, errno);
-        }
-        /*
-         * Table of open files is full.
-         * Remember the file position and close the includer.
-         * The state will be restored by get_line() on end of the included.
-         */
-        file->pos = ftell( file->fp);
-        fclose( file->fp);
-        /* In case of failure, re-open the includer */
-        if ((fp = fopen( fullname, "r")) == NULL) {
-            file->fp = fopen( cur_fullname, "r");
-            fseek( file->fp, file->pos, SEEK_SET);
-            goto  false;
-        }
-        if (max_open == 0)      /* Remember the limit of the system */
-            max_open = include_nest;
-    } else if (fp == NULL)                  /* No read permission   */ 
+    /*
+     * add_file() reads the whole file into memory and closes it at once,
+     * hence the includers are never kept open and the nesting of #include
+     * never exhausts the table of open files.
+     */
+    num_fopen++;
+    if ((fp = fopen( fullname, "r")) == NULL) { /* No read permission   */
+        num_fopen_failed++;
         goto  false;
+    }
     /* Truncate buffer of the includer to save memory   */
     len = (int) (file->bptr - file->buffer);
     if (len) {
         file->buffer = xrealloc( file->buffer, len + 1);
+        file->bufsize = len + 1;
         file->bptr = file->buffer + len;
     }
 
@@ -3482,6 +4030,7 @@ search:
         sharp( NULL, 0);    /* Print includer's line num and fname  */
     add_file( fp, src_dir, filename, fullname, include_opt);
     /* Add file-info to the linked list.  'infile' has been just renewed    */
+    free( fullname);                /* add_file() has registered a copy */
     /*
      * Remember the directory for #include_next.
      * Note: inc_dirp is restored to the parent includer's directory
@@ -3501,12 +4050,12 @@ search:
     else
         infile->sys_header = FALSE;
 #endif
-    cur_fullname = fullname;
+    cur_fullname = (char *) infile->full_fname;
 
     if (option_flags.z) {
         no_output++;        /* Don't output the included file       */
         if (include_nest == 2)
-            mcpp_fprintf( OUT, "#include \"%s\"\n", fullname);
+            mcpp_fprintf( OUT, "#include \"%s\"\n", cur_fullname);
             /* Output #include line instead, if it is in main source file   */
     } else if (! include_opt) {     /* Do not sharp() on -include   */
         src_line = 1;                   /* Working on line 1 now    */
@@ -3515,7 +4064,7 @@ search:
     src_line = 0;                       /* To read the first line   */
 
     if (mkdep && ((mkdep & MD_SYSHEADER) || ! infile->sys_header))
-        put_depend( fullname);          /* Output dependency line   */
+        put_depend( cur_fullname);      /* Output dependency line   */
 
 true:
     return  TRUE;
@@ -3542,11 +4091,11 @@ void    add_file(
     const char *    too_many_include_nest =
             "More than %.0s%ld nesting of #include";    /* _F_ _W4_ */
 
-    filename = set_fname( filename);    /* Search or append to fnamelist[]  */
-    fullname = set_fname( fullname);    /* Search or append to fnamelist[]  */
+    filename = set_fname( filename);    /* Search or append to fname_table[]*/
+    fullname = set_fname( fullname);    /* Search or append to fname_table[]*/
     file = get_file( filename, src_dir, fullname, (size_t) NBUFF, include_opt);
                                         /* file == infile           */
-    file->fp = fp;                      /* Better remember FILE *   */
+    load_file( file, fp);               /* Read the text and close  */
     cur_fname = filename;
 
     if (include_nest >= INCLUDE_NEST)   /* Probably recursive #include      */
@@ -3557,44 +4106,209 @@ void    add_file(
     include_nest++;
 }
 
+static void     load_file(
+    FILEINFO *  file,
+    FILE *      fp                          /* Open file pointer    */
+)
+/*
+ * Read the whole text of the source file into memory at once and close the
+ * file.  get_line() gets the physical lines from the text by mcpp_fgets()
+ * using the index made by index_lines().
+ * A regular file is mapped to memory on UNIX-like systems, otherwise it is
+ * read into a malloc()ed buffer.
+ * file->src is never NULL even for an empty file, since it is the flag of
+ * source file.
+ */
+{
+    char *      text;
+    size_t      size;
+    size_t      len = 0;
+    size_t      n;
+#if HOST_SYS_FAMILY == SYS_UNIX
+    struct stat     st;
+
+    if (fstat( fileno( fp), & st) == 0 && S_ISREG( st.st_mode)
+            && st.st_size > 0) {
+        text = (char *) mmap( NULL, (size_t) st.st_size, PROT_READ
+                , MAP_PRIVATE, fileno( fp), (off_t) 0);
+        if (text != (char *) MAP_FAILED) {
+            file->src_mapped = TRUE;
+            len = (size_t) st.st_size;
+            goto  loaded;
+        }
+    }
+#endif
+
+    /* stdin, pipe or any file not mapped   */
+    text = xmalloc( size = NBUFF);
+    while ((n = fread( text + len, 1, size - len, fp)) > 0) {
+        len += n;
+        if (len == size)
+            text = xrealloc( text, size *= 2);
+    }
+    if (ferror( fp))
+        cfatal( "File read error", NULL, 0L, NULL);         /* _F_  */
+
+#if HOST_SYS_FAMILY == SYS_UNIX
+loaded:
+#endif
+    if (fp != stdin)
+        fclose( fp);
+    file->src = file->src_ptr = text;
+    file->src_end = text + len;
+    index_lines( file);                 /* Find the lines at once   */
+}
+
+void    unload_file(
+    FILEINFO *  file
+)
+/*
+ * Free the text of the source file read by load_file().
+ */
+{
+    if (file->src == NULL)
+        return;
+#if HOST_SYS_FAMILY == SYS_UNIX
+    if (file->src_mapped)
+        munmap( file->src, (size_t) (file->src_end - file->src));
+    else
+#endif
+        free( file->src);
+    free( file->lines);
+    file->src = file->src_ptr = file->src_end = NULL;
+    file->lines = file->lptr = NULL;
+}
+
 static const char *     set_fname(
     const char *    filename
 )
 /*
- * Register the source filename to fnamelist[].
- * Search fnamelist[] for filename or append filename to fnamelist[].
- * Returns the pointer.
- * file->real_fname and file->full_fname points into fnamelist[].
+ * Register the source filename to fname_table[], unless registered.
+ * Returns the registered copy, which file->real_fname and file->full_fname
+ * point to.
  */
 {
-    INC_LIST *  fnamep;
-    size_t      fnamelen;
-
-    if (fnamelist == NULL) {            /* Should be initialized    */
-        max_fnamelist = INIT_NUM_FNAMELIST;
-        fnamelist = (INC_LIST *) xmalloc( sizeof (INC_LIST) * max_fnamelist);
-        fname_end = &fnamelist[ 0];
-    } else if (fname_end - fnamelist >= max_fnamelist) {
-                                /* Buffer full: double the elements */
-        fnamelist = (INC_LIST *) xrealloc( (void *) fnamelist
-                , sizeof (INC_LIST) * max_fnamelist * 2);
-        fname_end = &fnamelist[ max_fnamelist];
-        max_fnamelist *= 2;
-    }
-
-    /* Register the filename in fnamelist[] */
-    fnamelen = strlen( filename);
-    for (fnamep = fnamelist; fnamep < fname_end; fnamep++) {
-        if (fnamep->len == fnamelen && str_case_eq( fnamep->name, filename))
-            return  filename;           /* Already registered       */
-    }
-    fname_end->name = xmalloc( fnamelen + 1);
-    filename = strcpy( fname_end->name, filename);
-                                /* Global pointer for get_file()    */
-    fname_end->len = fnamelen;
-    fname_end++;
+    return  find_fname( filename, TRUE)->name;
+}
 
-    return  filename;
+static FNAME_ENTRY *    find_fname(
+    const char *    name,                   /* File name to look up */
+    int     add                     /* Register the name if not found   */
+)
+/*
+ * Search fname_table[] for the name, and append the name to the table if
+ * not found and 'add' is TRUE.  Returns the entry, or NULL if not found.
+ * The names are compared and hashed case-insensitively on the systems
+ * folding the case of file names.
+ */
+{
+    FNAME_ENTRY *   fnamep;
+    FNAME_ENTRY **  old_table;
+    size_t      len = strlen( name);
+    unsigned    hash = path_hash( name, len);
+    int         i;
+
+    if (fname_table != NULL) {
+        for (fnamep = fname_table[ hash & (fname_tsize - 1)]; fnamep != NULL;
+                fnamep = fnamep->next) {
+            if (fnamep->hash == hash && fnamep->len == len
+                    && str_case_eq( fnamep->name, name))
+                return  fnamep;         /* Already registered       */
+        }
+    }
+    if (! add)
+        return  NULL;
+
+    if (fname_table == NULL) {          /* Should be initialized    */
+        fname_tsize = INIT_NUM_FNAME;
+        fname_table = (FNAME_ENTRY **) xmalloc( sizeof (FNAME_ENTRY *)
+                * fname_tsize);
+        memset( fname_table, 0, sizeof (FNAME_ENTRY *) * fname_tsize);
+    } else if (fname_num >= fname_tsize) {
+                            /* Table full: double the hash chains   */
+        old_table = fname_table;
+        fname_table = (FNAME_ENTRY **) xmalloc( sizeof (FNAME_ENTRY *)
+                * fname_tsize * 2);
+        memset( fname_table, 0, sizeof (FNAME_ENTRY *) * fname_tsize * 2);
+        for (i = 0; i < fname_tsize; i++) {
+            while ((fnamep = old_table[ i]) != NULL) {
+                old_table[ i] = fnamep->next;
+                fnamep->next = fname_table[ fnamep->hash
+                        & (fname_tsize * 2 - 1)];
+                fname_table[ fnamep->hash & (fname_tsize * 2 - 1)] = fnamep;
+            }
+        }
+        free( old_table);
+        fname_tsize *= 2;
+    }
+
+    /* The entry and the copy of the name are allocated at once */
+    fnamep = (FNAME_ENTRY *) xmalloc( sizeof (FNAME_ENTRY) + len + 1);
+    fnamep->name = memcpy( fnamep + 1, name, len + 1);
+    fnamep->len = len;
+    fnamep->hash = hash;
+    fnamep->once = fnamep->depend = FALSE;
+    fnamep->guard = NULL;
+    fnamep->same = NULL;
+    fnamep->next = fname_table[ hash & (fname_tsize - 1)];
+    fname_table[ hash & (fname_tsize - 1)] = fnamep;
+    fname_num++;
+
+    return  fnamep;
+}
+
+static FNAME_ENTRY *    file_entry(
+    const char *    fullname        /* Full-path-list of the file   */
+)
+/*
+ * Returns the entry of fname_table[] to record #pragma once and the
+ * include guard of the file on, registering the name if not registered.
+ * With -H option, the entry is the one named by the device and the i-node
+ * of the file, a name never taken by a path-list.  The stat() is done only
+ * once for a path-list in a run.
+ */
+{
+    FNAME_ENTRY *   fnamep = find_fname( fullname, TRUE);
+#if SYS_FAMILY == SYS_UNIX
+    struct stat     st_buf;
+    char    id[ 48];
+
+    if (! no_syml)
+        return  fnamep;
+    if (fnamep->same == NULL) {
+        num_stat++;
+        if (stat( fullname, & st_buf) != 0) {
+            fnamep->same = fnamep;      /* Record on the path-list  */
+        } else {
+            sprintf( id, "\t%lx:%lx", (unsigned long) st_buf.st_dev
+                    , (unsigned long) st_buf.st_ino);
+            fnamep->same = find_fname( id, TRUE);
+        }
+    }
+    return  fnamep->same;
+#else
+    return  fnamep;
+#endif
+}
+
+static unsigned path_hash(
+    const char *    name,
+    size_t          len
+)
+/*
+ * Hash value of the path-list, which is case-insensitive on the systems
+ * folding the case of file names.
+ */
+{
+    unsigned    hash = 0;
+
+    while (len--)
+#if     FNAME_FOLD
+        hash = (hash << 5) + hash + tolower( *name++ & UCHARMAX);
+#else
+        hash = (hash << 5) + hash + (*name++ & UCHARMAX);
+#endif
+    return  hash;
 }
 
 #if SYSTEM == SYS_MAC
@@ -3754,7 +4468,7 @@ static int      search_framework(
         const char *    dot;
         size_t  len;
 
-        if (! file->fp)
+        if (! file->src)
             continue;
         dot = strstr( file->real_fname, dot_frame);
         if (! dot)
@@ -3883,7 +4597,7 @@ void    sharp(
     file = sharp_file ? sharp_file : infile;
     if (! file)
         return;
-    while (! file->fp)
+    while (! file->src)
         file = file->parent;
     line = sharp_file ? sharp_file->line : src_line;
     if (no_output || option_flags.p || file == NULL
@@ -4097,7 +4811,7 @@ void    do_pragma( void)
     } else if (str_eq( identifier, "once")) {   /* #pragma once     */
        if (! is_junk()) {
             file = infile;
-            while (file->fp == NULL)
+            while (file->src == NULL)
                 file = file->parent;
             do_once( file->full_fname);
             goto  skip_nl;
@@ -4237,20 +4951,7 @@ static void do_once(
  * This directive has been imported from GCC V.1.* / cpp as an extension.
  */
 {
-    if (once_list == NULL) {                /* Should initialize    */
-        max_once = INIT_NUM_ONCE;
-        once_list = (INC_LIST *) xmalloc( sizeof (INC_LIST) * max_once);
-        once_end = &once_list[ 0];
-    } else if (once_end - once_list >= max_once) {
-                                            /* Double the elements  */
-        once_list = (INC_LIST *) xrealloc( (void *) once_list
-                , sizeof (INC_LIST) * max_once * 2);
-        once_end = &once_list[ max_once];
-        max_once *= 2;
-    }
-    once_end->name = fullname;
-    once_end->len = strlen( fullname);
-    once_end++;
+    file_entry( fullname)->once = TRUE;
 }
 
 static int  included(
@@ -4261,21 +4962,61 @@ static int  included(
  * This routine is only called from open_file().
  */
 {
-    INC_LIST *  inc;
-    size_t      fnamelen;
+    FNAME_ENTRY *   fnamep = file_entry( fullname);
 
-    if (once_list == NULL)              /* No once file registered  */
-        return  FALSE;
-    fnamelen = strlen( fullname);
-    for (inc = once_list; inc < once_end; inc++) {
-        if (inc->len == fnamelen && str_case_eq( inc->name, fullname)) {
-            /* Already included */
-            if (mcpp_debug & PATH)
-                mcpp_fprintf( DBG, "Once included \"%s\"\n", fullname);
-            return  TRUE;
-        }
-    }
-    return  FALSE;                          /* Not yet included     */
+    if (! fnamep->once)
+        return  FALSE;                      /* Not yet included     */
+    /* Already included */
+    if (mcpp_debug & PATH)
+        mcpp_fprintf( DBG, "Once included \"%s\"\n", fullname);
+    once_skipped++;
+    return  TRUE;
+}
+
+void    add_guard(
+    const FILEINFO *    file        /* Source file just finished    */
+)
+/*
+ * Register the include guard of the file detected by chk_guard(), if its
+ * macro is defined at the end of the file.  The entry of the file is
+ * renewed, if the file has been read again after the macro was undefined.
+ */
+{
+    const DEFBUF *  defp = file->guard->defs;
+    FNAME_ENTRY *   fnamep;
+
+    if (! standard || defp == NULL || defp->push)
+        return;                 /* The macro is not defined in the file */
+    if (option_flags.c)
+        return;         /* Comments out of the guard are to be output   */
+    fnamep = file_entry( file->full_fname);
+    if (fnamep->guard == NULL)
+        guard_num++;
+    fnamep->guard = file->guard;
+}
+
+static int  guarded(
+    const char *    fullname
+)
+/*
+ * Is the file guarded by an include guard whose macro is defined now ?
+ * This routine is only called from open_file().
+ */
+{
+    FNAME_ENTRY *   fnamep = file_entry( fullname);
+    const DEFBUF *  defp;
+
+    if (fnamep->guard == NULL)
+        return  FALSE;                  /* No guard registered      */
+    if (mcpp_debug & MACRO_CALL)
+        return  FALSE;  /* Line markers and notifications are to be output */
+    if ((defp = fnamep->guard->defs) == NULL || defp->push)
+        return  FALSE;                  /* The macro is undefined   */
+    if (mcpp_debug & PATH)
+        mcpp_fprintf( DBG, "Guarded by %s \"%s\"\n"
+                , fnamep->guard->name, fullname);
+    guard_skipped++;
+    return  TRUE;
 }
 
 static void push_or_pop(
@@ -4310,6 +5051,7 @@ static void push_or_pop(
         prevp = look_prev( identifier, &cmp);
         if (cmp == 0) { /* Current definition or pushed definition exists   */
             defp = *prevp;
+            macro_gen++;        /* Invalidate the cached expansions */
             if (direction == PUSH) {/* #pragma push_macro( "MACRO") */
                 if (defp->push) {           /* No current definition*/
                     if (warn_level & 1)
@@ -4322,7 +5064,7 @@ static void push_or_pop(
                         + strlen( defp->repl) + strlen( defp->fname);
                 if (mcpp_mode == STD)
                     s_def += strlen( defp->parmnames);
-                dp = (DEFBUF *) xmalloc( s_def);
+                dp = alloc_def( s_def);
                 memcpy( dp, defp, s_def);   /* Copy the definition  */
                 dp->link = *prevp;          /* Insert to linked-list*/
                 *prevp = dp;                /*      the pushed def  */
@@ -4338,7 +5080,7 @@ static void push_or_pop(
                     } else {
                         *prevp = defp->link;
                                 /* Link the previous and the next   */
-                        free( defp);
+                        free_def( defp);
                             /* Delete the definition to enable popped def   */
                     }
                 }   /* Else no current definition exists    */
@@ -4591,7 +5333,7 @@ static void do_preprocessed( void)
     lbuf = file->bptr = file->buffer;           /* Reset file->bptr */
 
     /* Copy the input to output until a comment line appears.       */
-    while (fgets( lbuf, NBUFF, file->fp) != NULL
+    while (mcpp_fgets( lbuf, NBUFF, file) != NULL
             && memcmp( lbuf, "/*", 2) != 0) {
 #if STD_LINE_PREFIX == FALSE
         if (memcmp( lbuf, "#line ", 6) == 0) {
@@ -4608,7 +5350,7 @@ static void do_preprocessed( void)
                 , NULL, 0L, NULL);
 
     /* Define macros according to the #define lines.    */
-    while (fgets( lbuf, NWORK, file->fp) != NULL) {
+    while (mcpp_fgets( lbuf, NWORK, file) != NULL) {
         if (memcmp( lbuf, "/*", 2) == 0) {
                                     /* Standard predefined macro    */
             continue;
@@ -4639,7 +5381,7 @@ static void do_preprocessed( void)
                 break;
             }
         }
-        /* Register the filename to fnamelist[] */
+        /* Register the filename to fname_table[]   */
         /* inc_dirp may be NULL, and cur_fname may be "(predefined)"    */
         cur_fname = set_fname( dir + strlen( *inc_dirp));
         strcpy( comment - 2, "\n");         /* Remove the comment   */
@@ -4673,6 +5415,7 @@ static int  do_debug(
         { "expression", EXPRESSION  },
         { "getc",   GETC    },
         { "memory", MEMORY  },
+        { "profile",    PROFILE },          /* Implemented only in STD mode */
         { NULL,     0       },
     };
     struct Debug_arg    *argp;
@@ -4718,7 +5461,8 @@ static int  do_debug(
         }
         c = skip_ws();
     }
-    if ((mcpp_mode != STD && (mcpp_debug & MACRO_CALL)) || c != '\n') {
+    if ((mcpp_mode != STD && (mcpp_debug & (MACRO_CALL | PROFILE)))
+            || c != '\n') {
         if (warn_level & 1) {
             if (c != '\n') {
                 cwarn( not_ident, work_buf, 0L, NULL);
@@ -4878,6 +5622,20 @@ char *  stpcpy(
 
 void    print_heap( void)
 {
+    dump_sym_memory();
+    dump_exp_cache();
+    dump_file_pool();
+    mcpp_fprintf( DBG, "Include guards: %ld files guarded, %ld opens avoided"
+            " by the guards, %ld by #pragma once\n"
+            , guard_num
+            , guard_skipped, once_skipped);
+    mcpp_fprintf( DBG, "Include path cache: %ld hits, %ld misses, %ld rejected"
+            " by the index, %d entries\n"
+            , path_hits, path_misses, path_rejected, path_num);
+    mcpp_fprintf( DBG, "File system calls: stat %ld, readlink %ld, fopen %ld"
+            " (%ld failed), opendir %ld\n"
+            , num_stat, num_readlink, num_fopen, num_fopen_failed
+            , num_opendir);
 #if     KMMALLOC
     list_heap( 1);
 #elif   BSD_MALLOC
@@ -4905,16 +5663,19 @@ void    clear_filelist( void)
  */
 {
     const char **   incp;
-    INC_LIST *  namep;
+    FNAME_ENTRY *   fnamep;
+    int     i;
 
     for (incp = incdir; incp < incend; incp++)
         free( (void *) *incp);
     free( (void *) incdir);
-    for (namep = fnamelist; namep < fname_end; namep++)
-        free( (void *) namep->name);
-    free( (void *) fnamelist);
-    if (standard)
-        free( (void *) once_list);
+    for (i = 0; i < fname_tsize; i++) {
+        while ((fnamep = fname_table[ i]) != NULL) {
+            fname_table[ i] = fnamep->next;
+            free( fnamep);
+        }
+    }
+    free( (void *) fname_table);
 }
 #endif
 
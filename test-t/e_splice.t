@@ -0,0 +1,41 @@
+/* e_splice.t:  Quotation spliced across the lines in pre-Standard modes.  */
+
+/*
+ * In pre-Standard modes <backslash><newline> in a quotation is deleted
+ * while the quotation is scanned, and the quotation continues on the next
+ * line.  The diagnostic reports the whole quotation and echoes the last
+ * line as it is.
+ */
+
+/* 1:   Unterminated character constant continued on the next lines.   */
+/*  With -@kr:
+    e_splice.t:19: error: Unterminated character constant 'ab cd ef, skipped the line
+        cd ef
+    With -@old (no diagnostic):
+    'ab
+    cd ef   */
+'ab\
+
+cd ef
+
+/* 2:   Unterminated string literal continued on the next line.    */
+/*  With -@kr:
+    e_splice.t:28: error: Unterminated string literal, skipped the line
+        "gh ij kl
+    With -@old:
+    "gh ij kl  */
+"gh \
+ij kl
+
+/* 3:   The same in a skipped group.  The lines are not skipped at a time
+        while the quotation is continued.   */
+/*  With -@kr:
+    e_splice.t:39: error: Unterminated string literal, skipped the line
+        mn
+    and the #endif closes the group.    */
+#if 0
+"gh \
+
+mn
+op
+#endif
@@ -0,0 +1,33 @@
+/* guard.t:     include guards.  */
+/*
+ * A header whose text is wholly enclosed in "#ifndef GUARD" and "#endif" is
+ * not read again while GUARD is defined, as if it had "#pragma once", but it
+ * should be processed in the same way as it were read.
+ * In the macro notification mode (-K option or '#pragma MCPP debug
+ * macro_call') the header is read every time to put out its line markers
+ * and its notifications of the directives.
+ */
+
+/* 1:   A guarded header included twice.    */
+/*  guard1; guard1_end;  */
+#include    "guard1.h"
+/*  Nothing.    */
+#include    "guard1.h"
+
+/* 2:   The guard macro is undefined, then the header is read again.    */
+/*  guard1; guard1_end;  */
+#undef  GUARD1_H
+#include    "guard1.h"
+/*  Nothing.    */
+#include    "guard1.h"
+
+/* 3:   The tokens after #endif are not guarded.    */
+/*  guard2; guard2_trailer;  */
+#include    "guard2.h"
+/*  guard2_trailer;  */
+#include    "guard2.h"
+
+/* 4:   The macro notification mode is turned on, then the header is read.  */
+#pragma MCPP debug macro_call
+/*  Only the line markers and the notifications of #ifndef and #endif.   */
+#include    "guard1.h"
@@ -0,0 +1,9 @@
+/* guard1.h:    a header with an include guard.  */
+
+#ifndef GUARD1_H
+#define GUARD1_H
+    guard1;
+#ifdef  GUARD1_H
+    guard1_end;
+#endif
+#endif  /* GUARD1_H */
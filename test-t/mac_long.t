@@ -0,0 +1,5017 @@
+/* mac_long.t:  macro call across 5000 lines.  */
+/*
+ * The arguments of the call are longer than 128 KiB, which is the half of
+ * the initial work buffers of the macro expansion (NMACWORK of system.H).
+ * The expansion is done over again with larger buffers, reading the lines
+ * of the call again.
+ */
+
+#define FIRST( a, ...)  a
+#define ENTRY( n, s)    { n, s }
+
+/*  { 1, "name_00001" };    */
+FIRST(
+    ENTRY( 1, "name_00001"),
+    ENTRY( 2, "name_00002"),
+    ENTRY( 3, "name_00003"),
+    ENTRY( 4, "name_00004"),
+    ENTRY( 5, "name_00005"),
+    ENTRY( 6, "name_00006"),
+    ENTRY( 7, "name_00007"),
+    ENTRY( 8, "name_00008"),
+    ENTRY( 9, "name_00009"),
+    ENTRY( 10, "name_00010"),
+    ENTRY( 11, "name_00011"),
+    ENTRY( 12, "name_00012"),
+    ENTRY( 13, "name_00013"),
+    ENTRY( 14, "name_00014"),
+    ENTRY( 15, "name_00015"),
+    ENTRY( 16, "name_00016"),
+    ENTRY( 17, "name_00017"),
+    ENTRY( 18, "name_00018"),
+    ENTRY( 19, "name_00019"),
+    ENTRY( 20, "name_00020"),
+    ENTRY( 21, "name_00021"),
+    ENTRY( 22, "name_00022"),
+    ENTRY( 23, "name_00023"),
+    ENTRY( 24, "name_00024"),
+    ENTRY( 25, "name_00025"),
+    ENTRY( 26, "name_00026"),
+    ENTRY( 27, "name_00027"),
+    ENTRY( 28, "name_00028"),
+    ENTRY( 29, "name_00029"),
+    ENTRY( 30, "name_00030"),
+    ENTRY( 31, "name_00031"),
+    ENTRY( 32, "name_00032"),
+    ENTRY( 33, "name_00033"),
+    ENTRY( 34, "name_00034"),
+    ENTRY( 35, "name_00035"),
+    ENTRY( 36, "name_00036"),
+    ENTRY( 37, "name_00037"),
+    ENTRY( 38, "name_00038"),
+    ENTRY( 39, "name_00039"),
+    ENTRY( 40, "name_00040"),
+    ENTRY( 41, "name_00041"),
+    ENTRY( 42, "name_00042"),
+    ENTRY( 43, "name_00043"),
+    ENTRY( 44, "name_00044"),
+    ENTRY( 45, "name_00045"),
+    ENTRY( 46, "name_00046"),
+    ENTRY( 47, "name_00047"),
+    ENTRY( 48, "name_00048"),
+    ENTRY( 49, "name_00049"),
+    ENTRY( 50, "name_00050"),
+    ENTRY( 51, "name_00051"),
+    ENTRY( 52, "name_00052"),
+    ENTRY( 53, "name_00053"),
+    ENTRY( 54, "name_00054"),
+    ENTRY( 55, "name_00055"),
+    ENTRY( 56, "name_00056"),
+    ENTRY( 57, "name_00057"),
+    ENTRY( 58, "name_00058"),
+    ENTRY( 59, "name_00059"),
+    ENTRY( 60, "name_00060"),
+    ENTRY( 61, "name_00061"),
+    ENTRY( 62, "name_00062"),
+    ENTRY( 63, "name_00063"),
+    ENTRY( 64, "name_00064"),
+    ENTRY( 65, "name_00065"),
+    ENTRY( 66, "name_00066"),
+    ENTRY( 67, "name_00067"),
+    ENTRY( 68, "name_00068"),
+    ENTRY( 69, "name_00069"),
+    ENTRY( 70, "name_00070"),
+    ENTRY( 71, "name_00071"),
+    ENTRY( 72, "name_00072"),
+    ENTRY( 73, "name_00073"),
+    ENTRY( 74, "name_00074"),
+    ENTRY( 75, "name_00075"),
+    ENTRY( 76, "name_00076"),
+    ENTRY( 77, "name_00077"),
+    ENTRY( 78, "name_00078"),
+    ENTRY( 79, "name_00079"),
+    ENTRY( 80, "name_00080"),
+    ENTRY( 81, "name_00081"),
+    ENTRY( 82, "name_00082"),
+    ENTRY( 83, "name_00083"),
+    ENTRY( 84, "name_00084"),
+    ENTRY( 85, "name_00085"),
+    ENTRY( 86, "name_00086"),
+    ENTRY( 87, "name_00087"),
+    ENTRY( 88, "name_00088"),
+    ENTRY( 89, "name_00089"),
+    ENTRY( 90, "name_00090"),
+    ENTRY( 91, "name_00091"),
+    ENTRY( 92, "name_00092"),
+    ENTRY( 93, "name_00093"),
+    ENTRY( 94, "name_00094"),
+    ENTRY( 95, "name_00095"),
+    ENTRY( 96, "name_00096"),
+    ENTRY( 97, "name_00097"),
+    ENTRY( 98, "name_00098"),
+    ENTRY( 99, "name_00099"),
+    ENTRY( 100, "name_00100"),
+    ENTRY( 101, "name_00101"),
+    ENTRY( 102, "name_00102"),
+    ENTRY( 103, "name_00103"),
+    ENTRY( 104, "name_00104"),
+    ENTRY( 105, "name_00105"),
+    ENTRY( 106, "name_00106"),
+    ENTRY( 107, "name_00107"),
+    ENTRY( 108, "name_00108"),
+    ENTRY( 109, "name_00109"),
+    ENTRY( 110, "name_00110"),
+    ENTRY( 111, "name_00111"),
+    ENTRY( 112, "name_00112"),
+    ENTRY( 113, "name_00113"),
+    ENTRY( 114, "name_00114"),
+    ENTRY( 115, "name_00115"),
+    ENTRY( 116, "name_00116"),
+    ENTRY( 117, "name_00117"),
+    ENTRY( 118, "name_00118"),
+    ENTRY( 119, "name_00119"),
+    ENTRY( 120, "name_00120"),
+    ENTRY( 121, "name_00121"),
+    ENTRY( 122, "name_00122"),
+    ENTRY( 123, "name_00123"),
+    ENTRY( 124, "name_00124"),
+    ENTRY( 125, "name_00125"),
+    ENTRY( 126, "name_00126"),
+    ENTRY( 127, "name_00127"),
+    ENTRY( 128, "name_00128"),
+    ENTRY( 129, "name_00129"),
+    ENTRY( 130, "name_00130"),
+    ENTRY( 131, "name_00131"),
+    ENTRY( 132, "name_00132"),
+    ENTRY( 133, "name_00133"),
+    ENTRY( 134, "name_00134"),
+    ENTRY( 135, "name_00135"),
+    ENTRY( 136, "name_00136"),
+    ENTRY( 137, "name_00137"),
+    ENTRY( 138, "name_00138"),
+    ENTRY( 139, "name_00139"),
+    ENTRY( 140, "name_00140"),
+    ENTRY( 141, "name_00141"),
+    ENTRY( 142, "name_00142"),
+    ENTRY( 143, "name_00143"),
+    ENTRY( 144, "name_00144"),
+    ENTRY( 145, "name_00145"),
+    ENTRY( 146, "name_00146"),
+    ENTRY( 147, "name_00147"),
+    ENTRY( 148, "name_00148"),
+    ENTRY( 149, "name_00149"),
+    ENTRY( 150, "name_00150"),
+    ENTRY( 151, "name_00151"),
+    ENTRY( 152, "name_00152"),
+    ENTRY( 153, "name_00153"),
+    ENTRY( 154, "name_00154"),
+    ENTRY( 155, "name_00155"),
+    ENTRY( 156, "name_00156"),
+    ENTRY( 157, "name_00157"),
+    ENTRY( 158, "name_00158"),
+    ENTRY( 159, "name_00159"),
+    ENTRY( 160, "name_00160"),
+    ENTRY( 161, "name_00161"),
+    ENTRY( 162, "name_00162"),
+    ENTRY( 163, "name_00163"),
+    ENTRY( 164, "name_00164"),
+    ENTRY( 165, "name_00165"),
+    ENTRY( 166, "name_00166"),
+    ENTRY( 167, "name_00167"),
+    ENTRY( 168, "name_00168"),
+    ENTRY( 169, "name_00169"),
+    ENTRY( 170, "name_00170"),
+    ENTRY( 171, "name_00171"),
+    ENTRY( 172, "name_00172"),
+    ENTRY( 173, "name_00173"),
+    ENTRY( 174, "name_00174"),
+    ENTRY( 175, "name_00175"),
+    ENTRY( 176, "name_00176"),
+    ENTRY( 177, "name_00177"),
+    ENTRY( 178, "name_00178"),
+    ENTRY( 179, "name_00179"),
+    ENTRY( 180, "name_00180"),
+    ENTRY( 181, "name_00181"),
+    ENTRY( 182, "name_00182"),
+    ENTRY( 183, "name_00183"),
+    ENTRY( 184, "name_00184"),
+    ENTRY( 185, "name_00185"),
+    ENTRY( 186, "name_00186"),
+    ENTRY( 187, "name_00187"),
+    ENTRY( 188, "name_00188"),
+    ENTRY( 189, "name_00189"),
+    ENTRY( 190, "name_00190"),
+    ENTRY( 191, "name_00191"),
+    ENTRY( 192, "name_00192"),
+    ENTRY( 193, "name_00193"),
+    ENTRY( 194, "name_00194"),
+    ENTRY( 195, "name_00195"),
+    ENTRY( 196, "name_00196"),
+    ENTRY( 197, "name_00197"),
+    ENTRY( 198, "name_00198"),
+    ENTRY( 199, "name_00199"),
+    ENTRY( 200, "name_00200"),
+    ENTRY( 201, "name_00201"),
+    ENTRY( 202, "name_00202"),
+    ENTRY( 203, "name_00203"),
+    ENTRY( 204, "name_00204"),
+    ENTRY( 205, "name_00205"),
+    ENTRY( 206, "name_00206"),
+    ENTRY( 207, "name_00207"),
+    ENTRY( 208, "name_00208"),
+    ENTRY( 209, "name_00209"),
+    ENTRY( 210, "name_00210"),
+    ENTRY( 211, "name_00211"),
+    ENTRY( 212, "name_00212"),
+    ENTRY( 213, "name_00213"),
+    ENTRY( 214, "name_00214"),
+    ENTRY( 215, "name_00215"),
+    ENTRY( 216, "name_00216"),
+    ENTRY( 217, "name_00217"),
+    ENTRY( 218, "name_00218"),
+    ENTRY( 219, "name_00219"),
+    ENTRY( 220, "name_00220"),
+    ENTRY( 221, "name_00221"),
+    ENTRY( 222, "name_00222"),
+    ENTRY( 223, "name_00223"),
+    ENTRY( 224, "name_00224"),
+    ENTRY( 225, "name_00225"),
+    ENTRY( 226, "name_00226"),
+    ENTRY( 227, "name_00227"),
+    ENTRY( 228, "name_00228"),
+    ENTRY( 229, "name_00229"),
+    ENTRY( 230, "name_00230"),
+    ENTRY( 231, "name_00231"),
+    ENTRY( 232, "name_00232"),
+    ENTRY( 233, "name_00233"),
+    ENTRY( 234, "name_00234"),
+    ENTRY( 235, "name_00235"),
+    ENTRY( 236, "name_00236"),
+    ENTRY( 237, "name_00237"),
+    ENTRY( 238, "name_00238"),
+    ENTRY( 239, "name_00239"),
+    ENTRY( 240, "name_00240"),
+    ENTRY( 241, "name_00241"),
+    ENTRY( 242, "name_00242"),
+    ENTRY( 243, "name_00243"),
+    ENTRY( 244, "name_00244"),
+    ENTRY( 245, "name_00245"),
+    ENTRY( 246, "name_00246"),
+    ENTRY( 247, "name_00247"),
+    ENTRY( 248, "name_00248"),
+    ENTRY( 249, "name_00249"),
+    ENTRY( 250, "name_00250"),
+    ENTRY( 251, "name_00251"),
+    ENTRY( 252, "name_00252"),
+    ENTRY( 253, "name_00253"),
+    ENTRY( 254, "name_00254"),
+    ENTRY( 255, "name_00255"),
+    ENTRY( 256, "name_00256"),
+    ENTRY( 257, "name_00257"),
+    ENTRY( 258, "name_00258"),
+    ENTRY( 259, "name_00259"),
+    ENTRY( 260, "name_00260"),
+    ENTRY( 261, "name_00261"),
+    ENTRY( 262, "name_00262"),
+    ENTRY( 263, "name_00263"),
+    ENTRY( 264, "name_00264"),
+    ENTRY( 265, "name_00265"),
+    ENTRY( 266, "name_00266"),
+    ENTRY( 267, "name_00267"),
+    ENTRY( 268, "name_00268"),
+    ENTRY( 269, "name_00269"),
+    ENTRY( 270, "name_00270"),
+    ENTRY( 271, "name_00271"),
+    ENTRY( 272, "name_00272"),
+    ENTRY( 273, "name_00273"),
+    ENTRY( 274, "name_00274"),
+    ENTRY( 275, "name_00275"),
+    ENTRY( 276, "name_00276"),
+    ENTRY( 277, "name_00277"),
+    ENTRY( 278, "name_00278"),
+    ENTRY( 279, "name_00279"),
+    ENTRY( 280, "name_00280"),
+    ENTRY( 281, "name_00281"),
+    ENTRY( 282, "name_00282"),
+    ENTRY( 283, "name_00283"),
+    ENTRY( 284, "name_00284"),
+    ENTRY( 285, "name_00285"),
+    ENTRY( 286, "name_00286"),
+    ENTRY( 287, "name_00287"),
+    ENTRY( 288, "name_00288"),
+    ENTRY( 289, "name_00289"),
+    ENTRY( 290, "name_00290"),
+    ENTRY( 291, "name_00291"),
+    ENTRY( 292, "name_00292"),
+    ENTRY( 293, "name_00293"),
+    ENTRY( 294, "name_00294"),
+    ENTRY( 295, "name_00295"),
+    ENTRY( 296, "name_00296"),
+    ENTRY( 297, "name_00297"),
+    ENTRY( 298, "name_00298"),
+    ENTRY( 299, "name_00299"),
+    ENTRY( 300, "name_00300"),
+    ENTRY( 301, "name_00301"),
+    ENTRY( 302, "name_00302"),
+    ENTRY( 303, "name_00303"),
+    ENTRY( 304, "name_00304"),
+    ENTRY( 305, "name_00305"),
+    ENTRY( 306, "name_00306"),
+    ENTRY( 307, "name_00307"),
+    ENTRY( 308, "name_00308"),
+    ENTRY( 309, "name_00309"),
+    ENTRY( 310, "name_00310"),
+    ENTRY( 311, "name_00311"),
+    ENTRY( 312, "name_00312"),
+    ENTRY( 313, "name_00313"),
+    ENTRY( 314, "name_00314"),
+    ENTRY( 315, "name_00315"),
+    ENTRY( 316, "name_00316"),
+    ENTRY( 317, "name_00317"),
+    ENTRY( 318, "name_00318"),
+    ENTRY( 319, "name_00319"),
+    ENTRY( 320, "name_00320"),
+    ENTRY( 321, "name_00321"),
+    ENTRY( 322, "name_00322"),
+    ENTRY( 323, "name_00323"),
+    ENTRY( 324, "name_00324"),
+    ENTRY( 325, "name_00325"),
+    ENTRY( 326, "name_00326"),
+    ENTRY( 327, "name_00327"),
+    ENTRY( 328, "name_00328"),
+    ENTRY( 329, "name_00329"),
+    ENTRY( 330, "name_00330"),
+    ENTRY( 331, "name_00331"),
+    ENTRY( 332, "name_00332"),
+    ENTRY( 333, "name_00333"),
+    ENTRY( 334, "name_00334"),
+    ENTRY( 335, "name_00335"),
+    ENTRY( 336, "name_00336"),
+    ENTRY( 337, "name_00337"),
+    ENTRY( 338, "name_00338"),
+    ENTRY( 339, "name_00339"),
+    ENTRY( 340, "name_00340"),
+    ENTRY( 341, "name_00341"),
+    ENTRY( 342, "name_00342"),
+    ENTRY( 343, "name_00343"),
+    ENTRY( 344, "name_00344"),
+    ENTRY( 345, "name_00345"),
+    ENTRY( 346, "name_00346"),
+    ENTRY( 347, "name_00347"),
+    ENTRY( 348, "name_00348"),
+    ENTRY( 349, "name_00349"),
+    ENTRY( 350, "name_00350"),
+    ENTRY( 351, "name_00351"),
+    ENTRY( 352, "name_00352"),
+    ENTRY( 353, "name_00353"),
+    ENTRY( 354, "name_00354"),
+    ENTRY( 355, "name_00355"),
+    ENTRY( 356, "name_00356"),
+    ENTRY( 357, "name_00357"),
+    ENTRY( 358, "name_00358"),
+    ENTRY( 359, "name_00359"),
+    ENTRY( 360, "name_00360"),
+    ENTRY( 361, "name_00361"),
+    ENTRY( 362, "name_00362"),
+    ENTRY( 363, "name_00363"),
+    ENTRY( 364, "name_00364"),
+    ENTRY( 365, "name_00365"),
+    ENTRY( 366, "name_00366"),
+    ENTRY( 367, "name_00367"),
+    ENTRY( 368, "name_00368"),
+    ENTRY( 369, "name_00369"),
+    ENTRY( 370, "name_00370"),
+    ENTRY( 371, "name_00371"),
+    ENTRY( 372, "name_00372"),
+    ENTRY( 373, "name_00373"),
+    ENTRY( 374, "name_00374"),
+    ENTRY( 375, "name_00375"),
+    ENTRY( 376, "name_00376"),
+    ENTRY( 377, "name_00377"),
+    ENTRY( 378, "name_00378"),
+    ENTRY( 379, "name_00379"),
+    ENTRY( 380, "name_00380"),
+    ENTRY( 381, "name_00381"),
+    ENTRY( 382, "name_00382"),
+    ENTRY( 383, "name_00383"),
+    ENTRY( 384, "name_00384"),
+    ENTRY( 385, "name_00385"),
+    ENTRY( 386, "name_00386"),
+    ENTRY( 387, "name_00387"),
+    ENTRY( 388, "name_00388"),
+    ENTRY( 389, "name_00389"),
+    ENTRY( 390, "name_00390"),
+    ENTRY( 391, "name_00391"),
+    ENTRY( 392, "name_00392"),
+    ENTRY( 393, "name_00393"),
+    ENTRY( 394, "name_00394"),
+    ENTRY( 395, "name_00395"),
+    ENTRY( 396, "name_00396"),
+    ENTRY( 397, "name_00397"),
+    ENTRY( 398, "name_00398"),
+    ENTRY( 399, "name_00399"),
+    ENTRY( 400, "name_00400"),
+    ENTRY( 401, "name_00401"),
+    ENTRY( 402, "name_00402"),
+    ENTRY( 403, "name_00403"),
+    ENTRY( 404, "name_00404"),
+    ENTRY( 405, "name_00405"),
+    ENTRY( 406, "name_00406"),
+    ENTRY( 407, "name_00407"),
+    ENTRY( 408, "name_00408"),
+    ENTRY( 409, "name_00409"),
+    ENTRY( 410, "name_00410"),
+    ENTRY( 411, "name_00411"),
+    ENTRY( 412, "name_00412"),
+    ENTRY( 413, "name_00413"),
+    ENTRY( 414, "name_00414"),
+    ENTRY( 415, "name_00415"),
+    ENTRY( 416, "name_00416"),
+    ENTRY( 417, "name_00417"),
+    ENTRY( 418, "name_00418"),
+    ENTRY( 419, "name_00419"),
+    ENTRY( 420, "name_00420"),
+    ENTRY( 421, "name_00421"),
+    ENTRY( 422, "name_00422"),
+    ENTRY( 423, "name_00423"),
+    ENTRY( 424, "name_00424"),
+    ENTRY( 425, "name_00425"),
+    ENTRY( 426, "name_00426"),
+    ENTRY( 427, "name_00427"),
+    ENTRY( 428, "name_00428"),
+    ENTRY( 429, "name_00429"),
+    ENTRY( 430, "name_00430"),
+    ENTRY( 431, "name_00431"),
+    ENTRY( 432, "name_00432"),
+    ENTRY( 433, "name_00433"),
+    ENTRY( 434, "name_00434"),
+    ENTRY( 435, "name_00435"),
+    ENTRY( 436, "name_00436"),
+    ENTRY( 437, "name_00437"),
+    ENTRY( 438, "name_00438"),
+    ENTRY( 439, "name_00439"),
+    ENTRY( 440, "name_00440"),
+    ENTRY( 441, "name_00441"),
+    ENTRY( 442, "name_00442"),
+    ENTRY( 443, "name_00443"),
+    ENTRY( 444, "name_00444"),
+    ENTRY( 445, "name_00445"),
+    ENTRY( 446, "name_00446"),
+    ENTRY( 447, "name_00447"),
+    ENTRY( 448, "name_00448"),
+    ENTRY( 449, "name_00449"),
+    ENTRY( 450, "name_00450"),
+    ENTRY( 451, "name_00451"),
+    ENTRY( 452, "name_00452"),
+    ENTRY( 453, "name_00453"),
+    ENTRY( 454, "name_00454"),
+    ENTRY( 455, "name_00455"),
+    ENTRY( 456, "name_00456"),
+    ENTRY( 457, "name_00457"),
+    ENTRY( 458, "name_00458"),
+    ENTRY( 459, "name_00459"),
+    ENTRY( 460, "name_00460"),
+    ENTRY( 461, "name_00461"),
+    ENTRY( 462, "name_00462"),
+    ENTRY( 463, "name_00463"),
+    ENTRY( 464, "name_00464"),
+    ENTRY( 465, "name_00465"),
+    ENTRY( 466, "name_00466"),
+    ENTRY( 467, "name_00467"),
+    ENTRY( 468, "name_00468"),
+    ENTRY( 469, "name_00469"),
+    ENTRY( 470, "name_00470"),
+    ENTRY( 471, "name_00471"),
+    ENTRY( 472, "name_00472"),
+    ENTRY( 473, "name_00473"),
+    ENTRY( 474, "name_00474"),
+    ENTRY( 475, "name_00475"),
+    ENTRY( 476, "name_00476"),
+    ENTRY( 477, "name_00477"),
+    ENTRY( 478, "name_00478"),
+    ENTRY( 479, "name_00479"),
+    ENTRY( 480, "name_00480"),
+    ENTRY( 481, "name_00481"),
+    ENTRY( 482, "name_00482"),
+    ENTRY( 483, "name_00483"),
+    ENTRY( 484, "name_00484"),
+    ENTRY( 485, "name_00485"),
+    ENTRY( 486, "name_00486"),
+    ENTRY( 487, "name_00487"),
+    ENTRY( 488, "name_00488"),
+    ENTRY( 489, "name_00489"),
+    ENTRY( 490, "name_00490"),
+    ENTRY( 491, "name_00491"),
+    ENTRY( 492, "name_00492"),
+    ENTRY( 493, "name_00493"),
+    ENTRY( 494, "name_00494"),
+    ENTRY( 495, "name_00495"),
+    ENTRY( 496, "name_00496"),
+    ENTRY( 497, "name_00497"),
+    ENTRY( 498, "name_00498"),
+    ENTRY( 499, "name_00499"),
+    ENTRY( 500, "name_00500"),
+    ENTRY( 501, "name_00501"),
+    ENTRY( 502, "name_00502"),
+    ENTRY( 503, "name_00503"),
+    ENTRY( 504, "name_00504"),
+    ENTRY( 505, "name_00505"),
+    ENTRY( 506, "name_00506"),
+    ENTRY( 507, "name_00507"),
+    ENTRY( 508, "name_00508"),
+    ENTRY( 509, "name_00509"),
+    ENTRY( 510, "name_00510"),
+    ENTRY( 511, "name_00511"),
+    ENTRY( 512, "name_00512"),
+    ENTRY( 513, "name_00513"),
+    ENTRY( 514, "name_00514"),
+    ENTRY( 515, "name_00515"),
+    ENTRY( 516, "name_00516"),
+    ENTRY( 517, "name_00517"),
+    ENTRY( 518, "name_00518"),
+    ENTRY( 519, "name_00519"),
+    ENTRY( 520, "name_00520"),
+    ENTRY( 521, "name_00521"),
+    ENTRY( 522, "name_00522"),
+    ENTRY( 523, "name_00523"),
+    ENTRY( 524, "name_00524"),
+    ENTRY( 525, "name_00525"),
+    ENTRY( 526, "name_00526"),
+    ENTRY( 527, "name_00527"),
+    ENTRY( 528, "name_00528"),
+    ENTRY( 529, "name_00529"),
+    ENTRY( 530, "name_00530"),
+    ENTRY( 531, "name_00531"),
+    ENTRY( 532, "name_00532"),
+    ENTRY( 533, "name_00533"),
+    ENTRY( 534, "name_00534"),
+    ENTRY( 535, "name_00535"),
+    ENTRY( 536, "name_00536"),
+    ENTRY( 537, "name_00537"),
+    ENTRY( 538, "name_00538"),
+    ENTRY( 539, "name_00539"),
+    ENTRY( 540, "name_00540"),
+    ENTRY( 541, "name_00541"),
+    ENTRY( 542, "name_00542"),
+    ENTRY( 543, "name_00543"),
+    ENTRY( 544, "name_00544"),
+    ENTRY( 545, "name_00545"),
+    ENTRY( 546, "name_00546"),
+    ENTRY( 547, "name_00547"),
+    ENTRY( 548, "name_00548"),
+    ENTRY( 549, "name_00549"),
+    ENTRY( 550, "name_00550"),
+    ENTRY( 551, "name_00551"),
+    ENTRY( 552, "name_00552"),
+    ENTRY( 553, "name_00553"),
+    ENTRY( 554, "name_00554"),
+    ENTRY( 555, "name_00555"),
+    ENTRY( 556, "name_00556"),
+    ENTRY( 557, "name_00557"),
+    ENTRY( 558, "name_00558"),
+    ENTRY( 559, "name_00559"),
+    ENTRY( 560, "name_00560"),
+    ENTRY( 561, "name_00561"),
+    ENTRY( 562, "name_00562"),
+    ENTRY( 563, "name_00563"),
+    ENTRY( 564, "name_00564"),
+    ENTRY( 565, "name_00565"),
+    ENTRY( 566, "name_00566"),
+    ENTRY( 567, "name_00567"),
+    ENTRY( 568, "name_00568"),
+    ENTRY( 569, "name_00569"),
+    ENTRY( 570, "name_00570"),
+    ENTRY( 571, "name_00571"),
+    ENTRY( 572, "name_00572"),
+    ENTRY( 573, "name_00573"),
+    ENTRY( 574, "name_00574"),
+    ENTRY( 575, "name_00575"),
+    ENTRY( 576, "name_00576"),
+    ENTRY( 577, "name_00577"),
+    ENTRY( 578, "name_00578"),
+    ENTRY( 579, "name_00579"),
+    ENTRY( 580, "name_00580"),
+    ENTRY( 581, "name_00581"),
+    ENTRY( 582, "name_00582"),
+    ENTRY( 583, "name_00583"),
+    ENTRY( 584, "name_00584"),
+    ENTRY( 585, "name_00585"),
+    ENTRY( 586, "name_00586"),
+    ENTRY( 587, "name_00587"),
+    ENTRY( 588, "name_00588"),
+    ENTRY( 589, "name_00589"),
+    ENTRY( 590, "name_00590"),
+    ENTRY( 591, "name_00591"),
+    ENTRY( 592, "name_00592"),
+    ENTRY( 593, "name_00593"),
+    ENTRY( 594, "name_00594"),
+    ENTRY( 595, "name_00595"),
+    ENTRY( 596, "name_00596"),
+    ENTRY( 597, "name_00597"),
+    ENTRY( 598, "name_00598"),
+    ENTRY( 599, "name_00599"),
+    ENTRY( 600, "name_00600"),
+    ENTRY( 601, "name_00601"),
+    ENTRY( 602, "name_00602"),
+    ENTRY( 603, "name_00603"),
+    ENTRY( 604, "name_00604"),
+    ENTRY( 605, "name_00605"),
+    ENTRY( 606, "name_00606"),
+    ENTRY( 607, "name_00607"),
+    ENTRY( 608, "name_00608"),
+    ENTRY( 609, "name_00609"),
+    ENTRY( 610, "name_00610"),
+    ENTRY( 611, "name_00611"),
+    ENTRY( 612, "name_00612"),
+    ENTRY( 613, "name_00613"),
+    ENTRY( 614, "name_00614"),
+    ENTRY( 615, "name_00615"),
+    ENTRY( 616, "name_00616"),
+    ENTRY( 617, "name_00617"),
+    ENTRY( 618, "name_00618"),
+    ENTRY( 619, "name_00619"),
+    ENTRY( 620, "name_00620"),
+    ENTRY( 621, "name_00621"),
+    ENTRY( 622, "name_00622"),
+    ENTRY( 623, "name_00623"),
+    ENTRY( 624, "name_00624"),
+    ENTRY( 625, "name_00625"),
+    ENTRY( 626, "name_00626"),
+    ENTRY( 627, "name_00627"),
+    ENTRY( 628, "name_00628"),
+    ENTRY( 629, "name_00629"),
+    ENTRY( 630, "name_00630"),
+    ENTRY( 631, "name_00631"),
+    ENTRY( 632, "name_00632"),
+    ENTRY( 633, "name_00633"),
+    ENTRY( 634, "name_00634"),
+    ENTRY( 635, "name_00635"),
+    ENTRY( 636, "name_00636"),
+    ENTRY( 637, "name_00637"),
+    ENTRY( 638, "name_00638"),
+    ENTRY( 639, "name_00639"),
+    ENTRY( 640, "name_00640"),
+    ENTRY( 641, "name_00641"),
+    ENTRY( 642, "name_00642"),
+    ENTRY( 643, "name_00643"),
+    ENTRY( 644, "name_00644"),
+    ENTRY( 645, "name_00645"),
+    ENTRY( 646, "name_00646"),
+    ENTRY( 647, "name_00647"),
+    ENTRY( 648, "name_00648"),
+    ENTRY( 649, "name_00649"),
+    ENTRY( 650, "name_00650"),
+    ENTRY( 651, "name_00651"),
+    ENTRY( 652, "name_00652"),
+    ENTRY( 653, "name_00653"),
+    ENTRY( 654, "name_00654"),
+    ENTRY( 655, "name_00655"),
+    ENTRY( 656, "name_00656"),
+    ENTRY( 657, "name_00657"),
+    ENTRY( 658, "name_00658"),
+    ENTRY( 659, "name_00659"),
+    ENTRY( 660, "name_00660"),
+    ENTRY( 661, "name_00661"),
+    ENTRY( 662, "name_00662"),
+    ENTRY( 663, "name_00663"),
+    ENTRY( 664, "name_00664"),
+    ENTRY( 665, "name_00665"),
+    ENTRY( 666, "name_00666"),
+    ENTRY( 667, "name_00667"),
+    ENTRY( 668, "name_00668"),
+    ENTRY( 669, "name_00669"),
+    ENTRY( 670, "name_00670"),
+    ENTRY( 671, "name_00671"),
+    ENTRY( 672, "name_00672"),
+    ENTRY( 673, "name_00673"),
+    ENTRY( 674, "name_00674"),
+    ENTRY( 675, "name_00675"),
+    ENTRY( 676, "name_00676"),
+    ENTRY( 677, "name_00677"),
+    ENTRY( 678, "name_00678"),
+    ENTRY( 679, "name_00679"),
+    ENTRY( 680, "name_00680"),
+    ENTRY( 681, "name_00681"),
+    ENTRY( 682, "name_00682"),
+    ENTRY( 683, "name_00683"),
+    ENTRY( 684, "name_00684"),
+    ENTRY( 685, "name_00685"),
+    ENTRY( 686, "name_00686"),
+    ENTRY( 687, "name_00687"),
+    ENTRY( 688, "name_00688"),
+    ENTRY( 689, "name_00689"),
+    ENTRY( 690, "name_00690"),
+    ENTRY( 691, "name_00691"),
+    ENTRY( 692, "name_00692"),
+    ENTRY( 693, "name_00693"),
+    ENTRY( 694, "name_00694"),
+    ENTRY( 695, "name_00695"),
+    ENTRY( 696, "name_00696"),
+    ENTRY( 697, "name_00697"),
+    ENTRY( 698, "name_00698"),
+    ENTRY( 699, "name_00699"),
+    ENTRY( 700, "name_00700"),
+    ENTRY( 701, "name_00701"),
+    ENTRY( 702, "name_00702"),
+    ENTRY( 703, "name_00703"),
+    ENTRY( 704, "name_00704"),
+    ENTRY( 705, "name_00705"),
+    ENTRY( 706, "name_00706"),
+    ENTRY( 707, "name_00707"),
+    ENTRY( 708, "name_00708"),
+    ENTRY( 709, "name_00709"),
+    ENTRY( 710, "name_00710"),
+    ENTRY( 711, "name_00711"),
+    ENTRY( 712, "name_00712"),
+    ENTRY( 713, "name_00713"),
+    ENTRY( 714, "name_00714"),
+    ENTRY( 715, "name_00715"),
+    ENTRY( 716, "name_00716"),
+    ENTRY( 717, "name_00717"),
+    ENTRY( 718, "name_00718"),
+    ENTRY( 719, "name_00719"),
+    ENTRY( 720, "name_00720"),
+    ENTRY( 721, "name_00721"),
+    ENTRY( 722, "name_00722"),
+    ENTRY( 723, "name_00723"),
+    ENTRY( 724, "name_00724"),
+    ENTRY( 725, "name_00725"),
+    ENTRY( 726, "name_00726"),
+    ENTRY( 727, "name_00727"),
+    ENTRY( 728, "name_00728"),
+    ENTRY( 729, "name_00729"),
+    ENTRY( 730, "name_00730"),
+    ENTRY( 731, "name_00731"),
+    ENTRY( 732, "name_00732"),
+    ENTRY( 733, "name_00733"),
+    ENTRY( 734, "name_00734"),
+    ENTRY( 735, "name_00735"),
+    ENTRY( 736, "name_00736"),
+    ENTRY( 737, "name_00737"),
+    ENTRY( 738, "name_00738"),
+    ENTRY( 739, "name_00739"),
+    ENTRY( 740, "name_00740"),
+    ENTRY( 741, "name_00741"),
+    ENTRY( 742, "name_00742"),
+    ENTRY( 743, "name_00743"),
+    ENTRY( 744, "name_00744"),
+    ENTRY( 745, "name_00745"),
+    ENTRY( 746, "name_00746"),
+    ENTRY( 747, "name_00747"),
+    ENTRY( 748, "name_00748"),
+    ENTRY( 749, "name_00749"),
+    ENTRY( 750, "name_00750"),
+    ENTRY( 751, "name_00751"),
+    ENTRY( 752, "name_00752"),
+    ENTRY( 753, "name_00753"),
+    ENTRY( 754, "name_00754"),
+    ENTRY( 755, "name_00755"),
+    ENTRY( 756, "name_00756"),
+    ENTRY( 757, "name_00757"),
+    ENTRY( 758, "name_00758"),
+    ENTRY( 759, "name_00759"),
+    ENTRY( 760, "name_00760"),
+    ENTRY( 761, "name_00761"),
+    ENTRY( 762, "name_00762"),
+    ENTRY( 763, "name_00763"),
+    ENTRY( 764, "name_00764"),
+    ENTRY( 765, "name_00765"),
+    ENTRY( 766, "name_00766"),
+    ENTRY( 767, "name_00767"),
+    ENTRY( 768, "name_00768"),
+    ENTRY( 769, "name_00769"),
+    ENTRY( 770, "name_00770"),
+    ENTRY( 771, "name_00771"),
+    ENTRY( 772, "name_00772"),
+    ENTRY( 773, "name_00773"),
+    ENTRY( 774, "name_00774"),
+    ENTRY( 775, "name_00775"),
+    ENTRY( 776, "name_00776"),
+    ENTRY( 777, "name_00777"),
+    ENTRY( 778, "name_00778"),
+    ENTRY( 779, "name_00779"),
+    ENTRY( 780, "name_00780"),
+    ENTRY( 781, "name_00781"),
+    ENTRY( 782, "name_00782"),
+    ENTRY( 783, "name_00783"),
+    ENTRY( 784, "name_00784"),
+    ENTRY( 785, "name_00785"),
+    ENTRY( 786, "name_00786"),
+    ENTRY( 787, "name_00787"),
+    ENTRY( 788, "name_00788"),
+    ENTRY( 789, "name_00789"),
+    ENTRY( 790, "name_00790"),
+    ENTRY( 791, "name_00791"),
+    ENTRY( 792, "name_00792"),
+    ENTRY( 793, "name_00793"),
+    ENTRY( 794, "name_00794"),
+    ENTRY( 795, "name_00795"),
+    ENTRY( 796, "name_00796"),
+    ENTRY( 797, "name_00797"),
+    ENTRY( 798, "name_00798"),
+    ENTRY( 799, "name_00799"),
+    ENTRY( 800, "name_00800"),
+    ENTRY( 801, "name_00801"),
+    ENTRY( 802, "name_00802"),
+    ENTRY( 803, "name_00803"),
+    ENTRY( 804, "name_00804"),
+    ENTRY( 805, "name_00805"),
+    ENTRY( 806, "name_00806"),
+    ENTRY( 807, "name_00807"),
+    ENTRY( 808, "name_00808"),
+    ENTRY( 809, "name_00809"),
+    ENTRY( 810, "name_00810"),
+    ENTRY( 811, "name_00811"),
+    ENTRY( 812, "name_00812"),
+    ENTRY( 813, "name_00813"),
+    ENTRY( 814, "name_00814"),
+    ENTRY( 815, "name_00815"),
+    ENTRY( 816, "name_00816"),
+    ENTRY( 817, "name_00817"),
+    ENTRY( 818, "name_00818"),
+    ENTRY( 819, "name_00819"),
+    ENTRY( 820, "name_00820"),
+    ENTRY( 821, "name_00821"),
+    ENTRY( 822, "name_00822"),
+    ENTRY( 823, "name_00823"),
+    ENTRY( 824, "name_00824"),
+    ENTRY( 825, "name_00825"),
+    ENTRY( 826, "name_00826"),
+    ENTRY( 827, "name_00827"),
+    ENTRY( 828, "name_00828"),
+    ENTRY( 829, "name_00829"),
+    ENTRY( 830, "name_00830"),
+    ENTRY( 831, "name_00831"),
+    ENTRY( 832, "name_00832"),
+    ENTRY( 833, "name_00833"),
+    ENTRY( 834, "name_00834"),
+    ENTRY( 835, "name_00835"),
+    ENTRY( 836, "name_00836"),
+    ENTRY( 837, "name_00837"),
+    ENTRY( 838, "name_00838"),
+    ENTRY( 839, "name_00839"),
+    ENTRY( 840, "name_00840"),
+    ENTRY( 841, "name_00841"),
+    ENTRY( 842, "name_00842"),
+    ENTRY( 843, "name_00843"),
+    ENTRY( 844, "name_00844"),
+    ENTRY( 845, "name_00845"),
+    ENTRY( 846, "name_00846"),
+    ENTRY( 847, "name_00847"),
+    ENTRY( 848, "name_00848"),
+    ENTRY( 849, "name_00849"),
+    ENTRY( 850, "name_00850"),
+    ENTRY( 851, "name_00851"),
+    ENTRY( 852, "name_00852"),
+    ENTRY( 853, "name_00853"),
+    ENTRY( 854, "name_00854"),
+    ENTRY( 855, "name_00855"),
+    ENTRY( 856, "name_00856"),
+    ENTRY( 857, "name_00857"),
+    ENTRY( 858, "name_00858"),
+    ENTRY( 859, "name_00859"),
+    ENTRY( 860, "name_00860"),
+    ENTRY( 861, "name_00861"),
+    ENTRY( 862, "name_00862"),
+    ENTRY( 863, "name_00863"),
+    ENTRY( 864, "name_00864"),
+    ENTRY( 865, "name_00865"),
+    ENTRY( 866, "name_00866"),
+    ENTRY( 867, "name_00867"),
+    ENTRY( 868, "name_00868"),
+    ENTRY( 869, "name_00869"),
+    ENTRY( 870, "name_00870"),
+    ENTRY( 871, "name_00871"),
+    ENTRY( 872, "name_00872"),
+    ENTRY( 873, "name_00873"),
+    ENTRY( 874, "name_00874"),
+    ENTRY( 875, "name_00875"),
+    ENTRY( 876, "name_00876"),
+    ENTRY( 877, "name_00877"),
+    ENTRY( 878, "name_00878"),
+    ENTRY( 879, "name_00879"),
+    ENTRY( 880, "name_00880"),
+    ENTRY( 881, "name_00881"),
+    ENTRY( 882, "name_00882"),
+    ENTRY( 883, "name_00883"),
+    ENTRY( 884, "name_00884"),
+    ENTRY( 885, "name_00885"),
+    ENTRY( 886, "name_00886"),
+    ENTRY( 887, "name_00887"),
+    ENTRY( 888, "name_00888"),
+    ENTRY( 889, "name_00889"),
+    ENTRY( 890, "name_00890"),
+    ENTRY( 891, "name_00891"),
+    ENTRY( 892, "name_00892"),
+    ENTRY( 893, "name_00893"),
+    ENTRY( 894, "name_00894"),
+    ENTRY( 895, "name_00895"),
+    ENTRY( 896, "name_00896"),
+    ENTRY( 897, "name_00897"),
+    ENTRY( 898, "name_00898"),
+    ENTRY( 899, "name_00899"),
+    ENTRY( 900, "name_00900"),
+    ENTRY( 901, "name_00901"),
+    ENTRY( 902, "name_00902"),
+    ENTRY( 903, "name_00903"),
+    ENTRY( 904, "name_00904"),
+    ENTRY( 905, "name_00905"),
+    ENTRY( 906, "name_00906"),
+    ENTRY( 907, "name_00907"),
+    ENTRY( 908, "name_00908"),
+    ENTRY( 909, "name_00909"),
+    ENTRY( 910, "name_00910"),
+    ENTRY( 911, "name_00911"),
+    ENTRY( 912, "name_00912"),
+    ENTRY( 913, "name_00913"),
+    ENTRY( 914, "name_00914"),
+    ENTRY( 915, "name_00915"),
+    ENTRY( 916, "name_00916"),
+    ENTRY( 917, "name_00917"),
+    ENTRY( 918, "name_00918"),
+    ENTRY( 919, "name_00919"),
+    ENTRY( 920, "name_00920"),
+    ENTRY( 921, "name_00921"),
+    ENTRY( 922, "name_00922"),
+    ENTRY( 923, "name_00923"),
+    ENTRY( 924, "name_00924"),
+    ENTRY( 925, "name_00925"),
+    ENTRY( 926, "name_00926"),
+    ENTRY( 927, "name_00927"),
+    ENTRY( 928, "name_00928"),
+    ENTRY( 929, "name_00929"),
+    ENTRY( 930, "name_00930"),
+    ENTRY( 931, "name_00931"),
+    ENTRY( 932, "name_00932"),
+    ENTRY( 933, "name_00933"),
+    ENTRY( 934, "name_00934"),
+    ENTRY( 935, "name_00935"),
+    ENTRY( 936, "name_00936"),
+    ENTRY( 937, "name_00937"),
+    ENTRY( 938, "name_00938"),
+    ENTRY( 939, "name_00939"),
+    ENTRY( 940, "name_00940"),
+    ENTRY( 941, "name_00941"),
+    ENTRY( 942, "name_00942"),
+    ENTRY( 943, "name_00943"),
+    ENTRY( 944, "name_00944"),
+    ENTRY( 945, "name_00945"),
+    ENTRY( 946, "name_00946"),
+    ENTRY( 947, "name_00947"),
+    ENTRY( 948, "name_00948"),
+    ENTRY( 949, "name_00949"),
+    ENTRY( 950, "name_00950"),
+    ENTRY( 951, "name_00951"),
+    ENTRY( 952, "name_00952"),
+    ENTRY( 953, "name_00953"),
+    ENTRY( 954, "name_00954"),
+    ENTRY( 955, "name_00955"),
+    ENTRY( 956, "name_00956"),
+    ENTRY( 957, "name_00957"),
+    ENTRY( 958, "name_00958"),
+    ENTRY( 959, "name_00959"),
+    ENTRY( 960, "name_00960"),
+    ENTRY( 961, "name_00961"),
+    ENTRY( 962, "name_00962"),
+    ENTRY( 963, "name_00963"),
+    ENTRY( 964, "name_00964"),
+    ENTRY( 965, "name_00965"),
+    ENTRY( 966, "name_00966"),
+    ENTRY( 967, "name_00967"),
+    ENTRY( 968, "name_00968"),
+    ENTRY( 969, "name_00969"),
+    ENTRY( 970, "name_00970"),
+    ENTRY( 971, "name_00971"),
+    ENTRY( 972, "name_00972"),
+    ENTRY( 973, "name_00973"),
+    ENTRY( 974, "name_00974"),
+    ENTRY( 975, "name_00975"),
+    ENTRY( 976, "name_00976"),
+    ENTRY( 977, "name_00977"),
+    ENTRY( 978, "name_00978"),
+    ENTRY( 979, "name_00979"),
+    ENTRY( 980, "name_00980"),
+    ENTRY( 981, "name_00981"),
+    ENTRY( 982, "name_00982"),
+    ENTRY( 983, "name_00983"),
+    ENTRY( 984, "name_00984"),
+    ENTRY( 985, "name_00985"),
+    ENTRY( 986, "name_00986"),
+    ENTRY( 987, "name_00987"),
+    ENTRY( 988, "name_00988"),
+    ENTRY( 989, "name_00989"),
+    ENTRY( 990, "name_00990"),
+    ENTRY( 991, "name_00991"),
+    ENTRY( 992, "name_00992"),
+    ENTRY( 993, "name_00993"),
+    ENTRY( 994, "name_00994"),
+    ENTRY( 995, "name_00995"),
+    ENTRY( 996, "name_00996"),
+    ENTRY( 997, "name_00997"),
+    ENTRY( 998, "name_00998"),
+    ENTRY( 999, "name_00999"),
+    ENTRY( 1000, "name_01000"),
+    ENTRY( 1001, "name_01001"),
+    ENTRY( 1002, "name_01002"),
+    ENTRY( 1003, "name_01003"),
+    ENTRY( 1004, "name_01004"),
+    ENTRY( 1005, "name_01005"),
+    ENTRY( 1006, "name_01006"),
+    ENTRY( 1007, "name_01007"),
+    ENTRY( 1008, "name_01008"),
+    ENTRY( 1009, "name_01009"),
+    ENTRY( 1010, "name_01010"),
+    ENTRY( 1011, "name_01011"),
+    ENTRY( 1012, "name_01012"),
+    ENTRY( 1013, "name_01013"),
+    ENTRY( 1014, "name_01014"),
+    ENTRY( 1015, "name_01015"),
+    ENTRY( 1016, "name_01016"),
+    ENTRY( 1017, "name_01017"),
+    ENTRY( 1018, "name_01018"),
+    ENTRY( 1019, "name_01019"),
+    ENTRY( 1020, "name_01020"),
+    ENTRY( 1021, "name_01021"),
+    ENTRY( 1022, "name_01022"),
+    ENTRY( 1023, "name_01023"),
+    ENTRY( 1024, "name_01024"),
+    ENTRY( 1025, "name_01025"),
+    ENTRY( 1026, "name_01026"),
+    ENTRY( 1027, "name_01027"),
+    ENTRY( 1028, "name_01028"),
+    ENTRY( 1029, "name_01029"),
+    ENTRY( 1030, "name_01030"),
+    ENTRY( 1031, "name_01031"),
+    ENTRY( 1032, "name_01032"),
+    ENTRY( 1033, "name_01033"),
+    ENTRY( 1034, "name_01034"),
+    ENTRY( 1035, "name_01035"),
+    ENTRY( 1036, "name_01036"),
+    ENTRY( 1037, "name_01037"),
+    ENTRY( 1038, "name_01038"),
+    ENTRY( 1039, "name_01039"),
+    ENTRY( 1040, "name_01040"),
+    ENTRY( 1041, "name_01041"),
+    ENTRY( 1042, "name_01042"),
+    ENTRY( 1043, "name_01043"),
+    ENTRY( 1044, "name_01044"),
+    ENTRY( 1045, "name_01045"),
+    ENTRY( 1046, "name_01046"),
+    ENTRY( 1047, "name_01047"),
+    ENTRY( 1048, "name_01048"),
+    ENTRY( 1049, "name_01049"),
+    ENTRY( 1050, "name_01050"),
+    ENTRY( 1051, "name_01051"),
+    ENTRY( 1052, "name_01052"),
+    ENTRY( 1053, "name_01053"),
+    ENTRY( 1054, "name_01054"),
+    ENTRY( 1055, "name_01055"),
+    ENTRY( 1056, "name_01056"),
+    ENTRY( 1057, "name_01057"),
+    ENTRY( 1058, "name_01058"),
+    ENTRY( 1059, "name_01059"),
+    ENTRY( 1060, "name_01060"),
+    ENTRY( 1061, "name_01061"),
+    ENTRY( 1062, "name_01062"),
+    ENTRY( 1063, "name_01063"),
+    ENTRY( 1064, "name_01064"),
+    ENTRY( 1065, "name_01065"),
+    ENTRY( 1066, "name_01066"),
+    ENTRY( 1067, "name_01067"),
+    ENTRY( 1068, "name_01068"),
+    ENTRY( 1069, "name_01069"),
+    ENTRY( 1070, "name_01070"),
+    ENTRY( 1071, "name_01071"),
+    ENTRY( 1072, "name_01072"),
+    ENTRY( 1073, "name_01073"),
+    ENTRY( 1074, "name_01074"),
+    ENTRY( 1075, "name_01075"),
+    ENTRY( 1076, "name_01076"),
+    ENTRY( 1077, "name_01077"),
+    ENTRY( 1078, "name_01078"),
+    ENTRY( 1079, "name_01079"),
+    ENTRY( 1080, "name_01080"),
+    ENTRY( 1081, "name_01081"),
+    ENTRY( 1082, "name_01082"),
+    ENTRY( 1083, "name_01083"),
+    ENTRY( 1084, "name_01084"),
+    ENTRY( 1085, "name_01085"),
+    ENTRY( 1086, "name_01086"),
+    ENTRY( 1087, "name_01087"),
+    ENTRY( 1088, "name_01088"),
+    ENTRY( 1089, "name_01089"),
+    ENTRY( 1090, "name_01090"),
+    ENTRY( 1091, "name_01091"),
+    ENTRY( 1092, "name_01092"),
+    ENTRY( 1093, "name_01093"),
+    ENTRY( 1094, "name_01094"),
+    ENTRY( 1095, "name_01095"),
+    ENTRY( 1096, "name_01096"),
+    ENTRY( 1097, "name_01097"),
+    ENTRY( 1098, "name_01098"),
+    ENTRY( 1099, "name_01099"),
+    ENTRY( 1100, "name_01100"),
+    ENTRY( 1101, "name_01101"),
+    ENTRY( 1102, "name_01102"),
+    ENTRY( 1103, "name_01103"),
+    ENTRY( 1104, "name_01104"),
+    ENTRY( 1105, "name_01105"),
+    ENTRY( 1106, "name_01106"),
+    ENTRY( 1107, "name_01107"),
+    ENTRY( 1108, "name_01108"),
+    ENTRY( 1109, "name_01109"),
+    ENTRY( 1110, "name_01110"),
+    ENTRY( 1111, "name_01111"),
+    ENTRY( 1112, "name_01112"),
+    ENTRY( 1113, "name_01113"),
+    ENTRY( 1114, "name_01114"),
+    ENTRY( 1115, "name_01115"),
+    ENTRY( 1116, "name_01116"),
+    ENTRY( 1117, "name_01117"),
+    ENTRY( 1118, "name_01118"),
+    ENTRY( 1119, "name_01119"),
+    ENTRY( 1120, "name_01120"),
+    ENTRY( 1121, "name_01121"),
+    ENTRY( 1122, "name_01122"),
+    ENTRY( 1123, "name_01123"),
+    ENTRY( 1124, "name_01124"),
+    ENTRY( 1125, "name_01125"),
+    ENTRY( 1126, "name_01126"),
+    ENTRY( 1127, "name_01127"),
+    ENTRY( 1128, "name_01128"),
+    ENTRY( 1129, "name_01129"),
+    ENTRY( 1130, "name_01130"),
+    ENTRY( 1131, "name_01131"),
+    ENTRY( 1132, "name_01132"),
+    ENTRY( 1133, "name_01133"),
+    ENTRY( 1134, "name_01134"),
+    ENTRY( 1135, "name_01135"),
+    ENTRY( 1136, "name_01136"),
+    ENTRY( 1137, "name_01137"),
+    ENTRY( 1138, "name_01138"),
+    ENTRY( 1139, "name_01139"),
+    ENTRY( 1140, "name_01140"),
+    ENTRY( 1141, "name_01141"),
+    ENTRY( 1142, "name_01142"),
+    ENTRY( 1143, "name_01143"),
+    ENTRY( 1144, "name_01144"),
+    ENTRY( 1145, "name_01145"),
+    ENTRY( 1146, "name_01146"),
+    ENTRY( 1147, "name_01147"),
+    ENTRY( 1148, "name_01148"),
+    ENTRY( 1149, "name_01149"),
+    ENTRY( 1150, "name_01150"),
+    ENTRY( 1151, "name_01151"),
+    ENTRY( 1152, "name_01152"),
+    ENTRY( 1153, "name_01153"),
+    ENTRY( 1154, "name_01154"),
+    ENTRY( 1155, "name_01155"),
+    ENTRY( 1156, "name_01156"),
+    ENTRY( 1157, "name_01157"),
+    ENTRY( 1158, "name_01158"),
+    ENTRY( 1159, "name_01159"),
+    ENTRY( 1160, "name_01160"),
+    ENTRY( 1161, "name_01161"),
+    ENTRY( 1162, "name_01162"),
+    ENTRY( 1163, "name_01163"),
+    ENTRY( 1164, "name_01164"),
+    ENTRY( 1165, "name_01165"),
+    ENTRY( 1166, "name_01166"),
+    ENTRY( 1167, "name_01167"),
+    ENTRY( 1168, "name_01168"),
+    ENTRY( 1169, "name_01169"),
+    ENTRY( 1170, "name_01170"),
+    ENTRY( 1171, "name_01171"),
+    ENTRY( 1172, "name_01172"),
+    ENTRY( 1173, "name_01173"),
+    ENTRY( 1174, "name_01174"),
+    ENTRY( 1175, "name_01175"),
+    ENTRY( 1176, "name_01176"),
+    ENTRY( 1177, "name_01177"),
+    ENTRY( 1178, "name_01178"),
+    ENTRY( 1179, "name_01179"),
+    ENTRY( 1180, "name_01180"),
+    ENTRY( 1181, "name_01181"),
+    ENTRY( 1182, "name_01182"),
+    ENTRY( 1183, "name_01183"),
+    ENTRY( 1184, "name_01184"),
+    ENTRY( 1185, "name_01185"),
+    ENTRY( 1186, "name_01186"),
+    ENTRY( 1187, "name_01187"),
+    ENTRY( 1188, "name_01188"),
+    ENTRY( 1189, "name_01189"),
+    ENTRY( 1190, "name_01190"),
+    ENTRY( 1191, "name_01191"),
+    ENTRY( 1192, "name_01192"),
+    ENTRY( 1193, "name_01193"),
+    ENTRY( 1194, "name_01194"),
+    ENTRY( 1195, "name_01195"),
+    ENTRY( 1196, "name_01196"),
+    ENTRY( 1197, "name_01197"),
+    ENTRY( 1198, "name_01198"),
+    ENTRY( 1199, "name_01199"),
+    ENTRY( 1200, "name_01200"),
+    ENTRY( 1201, "name_01201"),
+    ENTRY( 1202, "name_01202"),
+    ENTRY( 1203, "name_01203"),
+    ENTRY( 1204, "name_01204"),
+    ENTRY( 1205, "name_01205"),
+    ENTRY( 1206, "name_01206"),
+    ENTRY( 1207, "name_01207"),
+    ENTRY( 1208, "name_01208"),
+    ENTRY( 1209, "name_01209"),
+    ENTRY( 1210, "name_01210"),
+    ENTRY( 1211, "name_01211"),
+    ENTRY( 1212, "name_01212"),
+    ENTRY( 1213, "name_01213"),
+    ENTRY( 1214, "name_01214"),
+    ENTRY( 1215, "name_01215"),
+    ENTRY( 1216, "name_01216"),
+    ENTRY( 1217, "name_01217"),
+    ENTRY( 1218, "name_01218"),
+    ENTRY( 1219, "name_01219"),
+    ENTRY( 1220, "name_01220"),
+    ENTRY( 1221, "name_01221"),
+    ENTRY( 1222, "name_01222"),
+    ENTRY( 1223, "name_01223"),
+    ENTRY( 1224, "name_01224"),
+    ENTRY( 1225, "name_01225"),
+    ENTRY( 1226, "name_01226"),
+    ENTRY( 1227, "name_01227"),
+    ENTRY( 1228, "name_01228"),
+    ENTRY( 1229, "name_01229"),
+    ENTRY( 1230, "name_01230"),
+    ENTRY( 1231, "name_01231"),
+    ENTRY( 1232, "name_01232"),
+    ENTRY( 1233, "name_01233"),
+    ENTRY( 1234, "name_01234"),
+    ENTRY( 1235, "name_01235"),
+    ENTRY( 1236, "name_01236"),
+    ENTRY( 1237, "name_01237"),
+    ENTRY( 1238, "name_01238"),
+    ENTRY( 1239, "name_01239"),
+    ENTRY( 1240, "name_01240"),
+    ENTRY( 1241, "name_01241"),
+    ENTRY( 1242, "name_01242"),
+    ENTRY( 1243, "name_01243"),
+    ENTRY( 1244, "name_01244"),
+    ENTRY( 1245, "name_01245"),
+    ENTRY( 1246, "name_01246"),
+    ENTRY( 1247, "name_01247"),
+    ENTRY( 1248, "name_01248"),
+    ENTRY( 1249, "name_01249"),
+    ENTRY( 1250, "name_01250"),
+    ENTRY( 1251, "name_01251"),
+    ENTRY( 1252, "name_01252"),
+    ENTRY( 1253, "name_01253"),
+    ENTRY( 1254, "name_01254"),
+    ENTRY( 1255, "name_01255"),
+    ENTRY( 1256, "name_01256"),
+    ENTRY( 1257, "name_01257"),
+    ENTRY( 1258, "name_01258"),
+    ENTRY( 1259, "name_01259"),
+    ENTRY( 1260, "name_01260"),
+    ENTRY( 1261, "name_01261"),
+    ENTRY( 1262, "name_01262"),
+    ENTRY( 1263, "name_01263"),
+    ENTRY( 1264, "name_01264"),
+    ENTRY( 1265, "name_01265"),
+    ENTRY( 1266, "name_01266"),
+    ENTRY( 1267, "name_01267"),
+    ENTRY( 1268, "name_01268"),
+    ENTRY( 1269, "name_01269"),
+    ENTRY( 1270, "name_01270"),
+    ENTRY( 1271, "name_01271"),
+    ENTRY( 1272, "name_01272"),
+    ENTRY( 1273, "name_01273"),
+    ENTRY( 1274, "name_01274"),
+    ENTRY( 1275, "name_01275"),
+    ENTRY( 1276, "name_01276"),
+    ENTRY( 1277, "name_01277"),
+    ENTRY( 1278, "name_01278"),
+    ENTRY( 1279, "name_01279"),
+    ENTRY( 1280, "name_01280"),
+    ENTRY( 1281, "name_01281"),
+    ENTRY( 1282, "name_01282"),
+    ENTRY( 1283, "name_01283"),
+    ENTRY( 1284, "name_01284"),
+    ENTRY( 1285, "name_01285"),
+    ENTRY( 1286, "name_01286"),
+    ENTRY( 1287, "name_01287"),
+    ENTRY( 1288, "name_01288"),
+    ENTRY( 1289, "name_01289"),
+    ENTRY( 1290, "name_01290"),
+    ENTRY( 1291, "name_01291"),
+    ENTRY( 1292, "name_01292"),
+    ENTRY( 1293, "name_01293"),
+    ENTRY( 1294, "name_01294"),
+    ENTRY( 1295, "name_01295"),
+    ENTRY( 1296, "name_01296"),
+    ENTRY( 1297, "name_01297"),
+    ENTRY( 1298, "name_01298"),
+    ENTRY( 1299, "name_01299"),
+    ENTRY( 1300, "name_01300"),
+    ENTRY( 1301, "name_01301"),
+    ENTRY( 1302, "name_01302"),
+    ENTRY( 1303, "name_01303"),
+    ENTRY( 1304, "name_01304"),
+    ENTRY( 1305, "name_01305"),
+    ENTRY( 1306, "name_01306"),
+    ENTRY( 1307, "name_01307"),
+    ENTRY( 1308, "name_01308"),
+    ENTRY( 1309, "name_01309"),
+    ENTRY( 1310, "name_01310"),
+    ENTRY( 1311, "name_01311"),
+    ENTRY( 1312, "name_01312"),
+    ENTRY( 1313, "name_01313"),
+    ENTRY( 1314, "name_01314"),
+    ENTRY( 1315, "name_01315"),
+    ENTRY( 1316, "name_01316"),
+    ENTRY( 1317, "name_01317"),
+    ENTRY( 1318, "name_01318"),
+    ENTRY( 1319, "name_01319"),
+    ENTRY( 1320, "name_01320"),
+    ENTRY( 1321, "name_01321"),
+    ENTRY( 1322, "name_01322"),
+    ENTRY( 1323, "name_01323"),
+    ENTRY( 1324, "name_01324"),
+    ENTRY( 1325, "name_01325"),
+    ENTRY( 1326, "name_01326"),
+    ENTRY( 1327, "name_01327"),
+    ENTRY( 1328, "name_01328"),
+    ENTRY( 1329, "name_01329"),
+    ENTRY( 1330, "name_01330"),
+    ENTRY( 1331, "name_01331"),
+    ENTRY( 1332, "name_01332"),
+    ENTRY( 1333, "name_01333"),
+    ENTRY( 1334, "name_01334"),
+    ENTRY( 1335, "name_01335"),
+    ENTRY( 1336, "name_01336"),
+    ENTRY( 1337, "name_01337"),
+    ENTRY( 1338, "name_01338"),
+    ENTRY( 1339, "name_01339"),
+    ENTRY( 1340, "name_01340"),
+    ENTRY( 1341, "name_01341"),
+    ENTRY( 1342, "name_01342"),
+    ENTRY( 1343, "name_01343"),
+    ENTRY( 1344, "name_01344"),
+    ENTRY( 1345, "name_01345"),
+    ENTRY( 1346, "name_01346"),
+    ENTRY( 1347, "name_01347"),
+    ENTRY( 1348, "name_01348"),
+    ENTRY( 1349, "name_01349"),
+    ENTRY( 1350, "name_01350"),
+    ENTRY( 1351, "name_01351"),
+    ENTRY( 1352, "name_01352"),
+    ENTRY( 1353, "name_01353"),
+    ENTRY( 1354, "name_01354"),
+    ENTRY( 1355, "name_01355"),
+    ENTRY( 1356, "name_01356"),
+    ENTRY( 1357, "name_01357"),
+    ENTRY( 1358, "name_01358"),
+    ENTRY( 1359, "name_01359"),
+    ENTRY( 1360, "name_01360"),
+    ENTRY( 1361, "name_01361"),
+    ENTRY( 1362, "name_01362"),
+    ENTRY( 1363, "name_01363"),
+    ENTRY( 1364, "name_01364"),
+    ENTRY( 1365, "name_01365"),
+    ENTRY( 1366, "name_01366"),
+    ENTRY( 1367, "name_01367"),
+    ENTRY( 1368, "name_01368"),
+    ENTRY( 1369, "name_01369"),
+    ENTRY( 1370, "name_01370"),
+    ENTRY( 1371, "name_01371"),
+    ENTRY( 1372, "name_01372"),
+    ENTRY( 1373, "name_01373"),
+    ENTRY( 1374, "name_01374"),
+    ENTRY( 1375, "name_01375"),
+    ENTRY( 1376, "name_01376"),
+    ENTRY( 1377, "name_01377"),
+    ENTRY( 1378, "name_01378"),
+    ENTRY( 1379, "name_01379"),
+    ENTRY( 1380, "name_01380"),
+    ENTRY( 1381, "name_01381"),
+    ENTRY( 1382, "name_01382"),
+    ENTRY( 1383, "name_01383"),
+    ENTRY( 1384, "name_01384"),
+    ENTRY( 1385, "name_01385"),
+    ENTRY( 1386, "name_01386"),
+    ENTRY( 1387, "name_01387"),
+    ENTRY( 1388, "name_01388"),
+    ENTRY( 1389, "name_01389"),
+    ENTRY( 1390, "name_01390"),
+    ENTRY( 1391, "name_01391"),
+    ENTRY( 1392, "name_01392"),
+    ENTRY( 1393, "name_01393"),
+    ENTRY( 1394, "name_01394"),
+    ENTRY( 1395, "name_01395"),
+    ENTRY( 1396, "name_01396"),
+    ENTRY( 1397, "name_01397"),
+    ENTRY( 1398, "name_01398"),
+    ENTRY( 1399, "name_01399"),
+    ENTRY( 1400, "name_01400"),
+    ENTRY( 1401, "name_01401"),
+    ENTRY( 1402, "name_01402"),
+    ENTRY( 1403, "name_01403"),
+    ENTRY( 1404, "name_01404"),
+    ENTRY( 1405, "name_01405"),
+    ENTRY( 1406, "name_01406"),
+    ENTRY( 1407, "name_01407"),
+    ENTRY( 1408, "name_01408"),
+    ENTRY( 1409, "name_01409"),
+    ENTRY( 1410, "name_01410"),
+    ENTRY( 1411, "name_01411"),
+    ENTRY( 1412, "name_01412"),
+    ENTRY( 1413, "name_01413"),
+    ENTRY( 1414, "name_01414"),
+    ENTRY( 1415, "name_01415"),
+    ENTRY( 1416, "name_01416"),
+    ENTRY( 1417, "name_01417"),
+    ENTRY( 1418, "name_01418"),
+    ENTRY( 1419, "name_01419"),
+    ENTRY( 1420, "name_01420"),
+    ENTRY( 1421, "name_01421"),
+    ENTRY( 1422, "name_01422"),
+    ENTRY( 1423, "name_01423"),
+    ENTRY( 1424, "name_01424"),
+    ENTRY( 1425, "name_01425"),
+    ENTRY( 1426, "name_01426"),
+    ENTRY( 1427, "name_01427"),
+    ENTRY( 1428, "name_01428"),
+    ENTRY( 1429, "name_01429"),
+    ENTRY( 1430, "name_01430"),
+    ENTRY( 1431, "name_01431"),
+    ENTRY( 1432, "name_01432"),
+    ENTRY( 1433, "name_01433"),
+    ENTRY( 1434, "name_01434"),
+    ENTRY( 1435, "name_01435"),
+    ENTRY( 1436, "name_01436"),
+    ENTRY( 1437, "name_01437"),
+    ENTRY( 1438, "name_01438"),
+    ENTRY( 1439, "name_01439"),
+    ENTRY( 1440, "name_01440"),
+    ENTRY( 1441, "name_01441"),
+    ENTRY( 1442, "name_01442"),
+    ENTRY( 1443, "name_01443"),
+    ENTRY( 1444, "name_01444"),
+    ENTRY( 1445, "name_01445"),
+    ENTRY( 1446, "name_01446"),
+    ENTRY( 1447, "name_01447"),
+    ENTRY( 1448, "name_01448"),
+    ENTRY( 1449, "name_01449"),
+    ENTRY( 1450, "name_01450"),
+    ENTRY( 1451, "name_01451"),
+    ENTRY( 1452, "name_01452"),
+    ENTRY( 1453, "name_01453"),
+    ENTRY( 1454, "name_01454"),
+    ENTRY( 1455, "name_01455"),
+    ENTRY( 1456, "name_01456"),
+    ENTRY( 1457, "name_01457"),
+    ENTRY( 1458, "name_01458"),
+    ENTRY( 1459, "name_01459"),
+    ENTRY( 1460, "name_01460"),
+    ENTRY( 1461, "name_01461"),
+    ENTRY( 1462, "name_01462"),
+    ENTRY( 1463, "name_01463"),
+    ENTRY( 1464, "name_01464"),
+    ENTRY( 1465, "name_01465"),
+    ENTRY( 1466, "name_01466"),
+    ENTRY( 1467, "name_01467"),
+    ENTRY( 1468, "name_01468"),
+    ENTRY( 1469, "name_01469"),
+    ENTRY( 1470, "name_01470"),
+    ENTRY( 1471, "name_01471"),
+    ENTRY( 1472, "name_01472"),
+    ENTRY( 1473, "name_01473"),
+    ENTRY( 1474, "name_01474"),
+    ENTRY( 1475, "name_01475"),
+    ENTRY( 1476, "name_01476"),
+    ENTRY( 1477, "name_01477"),
+    ENTRY( 1478, "name_01478"),
+    ENTRY( 1479, "name_01479"),
+    ENTRY( 1480, "name_01480"),
+    ENTRY( 1481, "name_01481"),
+    ENTRY( 1482, "name_01482"),
+    ENTRY( 1483, "name_01483"),
+    ENTRY( 1484, "name_01484"),
+    ENTRY( 1485, "name_01485"),
+    ENTRY( 1486, "name_01486"),
+    ENTRY( 1487, "name_01487"),
+    ENTRY( 1488, "name_01488"),
+    ENTRY( 1489, "name_01489"),
+    ENTRY( 1490, "name_01490"),
+    ENTRY( 1491, "name_01491"),
+    ENTRY( 1492, "name_01492"),
+    ENTRY( 1493, "name_01493"),
+    ENTRY( 1494, "name_01494"),
+    ENTRY( 1495, "name_01495"),
+    ENTRY( 1496, "name_01496"),
+    ENTRY( 1497, "name_01497"),
+    ENTRY( 1498, "name_01498"),
+    ENTRY( 1499, "name_01499"),
+    ENTRY( 1500, "name_01500"),
+    ENTRY( 1501, "name_01501"),
+    ENTRY( 1502, "name_01502"),
+    ENTRY( 1503, "name_01503"),
+    ENTRY( 1504, "name_01504"),
+    ENTRY( 1505, "name_01505"),
+    ENTRY( 1506, "name_01506"),
+    ENTRY( 1507, "name_01507"),
+    ENTRY( 1508, "name_01508"),
+    ENTRY( 1509, "name_01509"),
+    ENTRY( 1510, "name_01510"),
+    ENTRY( 1511, "name_01511"),
+    ENTRY( 1512, "name_01512"),
+    ENTRY( 1513, "name_01513"),
+    ENTRY( 1514, "name_01514"),
+    ENTRY( 1515, "name_01515"),
+    ENTRY( 1516, "name_01516"),
+    ENTRY( 1517, "name_01517"),
+    ENTRY( 1518, "name_01518"),
+    ENTRY( 1519, "name_01519"),
+    ENTRY( 1520, "name_01520"),
+    ENTRY( 1521, "name_01521"),
+    ENTRY( 1522, "name_01522"),
+    ENTRY( 1523, "name_01523"),
+    ENTRY( 1524, "name_01524"),
+    ENTRY( 1525, "name_01525"),
+    ENTRY( 1526, "name_01526"),
+    ENTRY( 1527, "name_01527"),
+    ENTRY( 1528, "name_01528"),
+    ENTRY( 1529, "name_01529"),
+    ENTRY( 1530, "name_01530"),
+    ENTRY( 1531, "name_01531"),
+    ENTRY( 1532, "name_01532"),
+    ENTRY( 1533, "name_01533"),
+    ENTRY( 1534, "name_01534"),
+    ENTRY( 1535, "name_01535"),
+    ENTRY( 1536, "name_01536"),
+    ENTRY( 1537, "name_01537"),
+    ENTRY( 1538, "name_01538"),
+    ENTRY( 1539, "name_01539"),
+    ENTRY( 1540, "name_01540"),
+    ENTRY( 1541, "name_01541"),
+    ENTRY( 1542, "name_01542"),
+    ENTRY( 1543, "name_01543"),
+    ENTRY( 1544, "name_01544"),
+    ENTRY( 1545, "name_01545"),
+    ENTRY( 1546, "name_01546"),
+    ENTRY( 1547, "name_01547"),
+    ENTRY( 1548, "name_01548"),
+    ENTRY( 1549, "name_01549"),
+    ENTRY( 1550, "name_01550"),
+    ENTRY( 1551, "name_01551"),
+    ENTRY( 1552, "name_01552"),
+    ENTRY( 1553, "name_01553"),
+    ENTRY( 1554, "name_01554"),
+    ENTRY( 1555, "name_01555"),
+    ENTRY( 1556, "name_01556"),
+    ENTRY( 1557, "name_01557"),
+    ENTRY( 1558, "name_01558"),
+    ENTRY( 1559, "name_01559"),
+    ENTRY( 1560, "name_01560"),
+    ENTRY( 1561, "name_01561"),
+    ENTRY( 1562, "name_01562"),
+    ENTRY( 1563, "name_01563"),
+    ENTRY( 1564, "name_01564"),
+    ENTRY( 1565, "name_01565"),
+    ENTRY( 1566, "name_01566"),
+    ENTRY( 1567, "name_01567"),
+    ENTRY( 1568, "name_01568"),
+    ENTRY( 1569, "name_01569"),
+    ENTRY( 1570, "name_01570"),
+    ENTRY( 1571, "name_01571"),
+    ENTRY( 1572, "name_01572"),
+    ENTRY( 1573, "name_01573"),
+    ENTRY( 1574, "name_01574"),
+    ENTRY( 1575, "name_01575"),
+    ENTRY( 1576, "name_01576"),
+    ENTRY( 1577, "name_01577"),
+    ENTRY( 1578, "name_01578"),
+    ENTRY( 1579, "name_01579"),
+    ENTRY( 1580, "name_01580"),
+    ENTRY( 1581, "name_01581"),
+    ENTRY( 1582, "name_01582"),
+    ENTRY( 1583, "name_01583"),
+    ENTRY( 1584, "name_01584"),
+    ENTRY( 1585, "name_01585"),
+    ENTRY( 1586, "name_01586"),
+    ENTRY( 1587, "name_01587"),
+    ENTRY( 1588, "name_01588"),
+    ENTRY( 1589, "name_01589"),
+    ENTRY( 1590, "name_01590"),
+    ENTRY( 1591, "name_01591"),
+    ENTRY( 1592, "name_01592"),
+    ENTRY( 1593, "name_01593"),
+    ENTRY( 1594, "name_01594"),
+    ENTRY( 1595, "name_01595"),
+    ENTRY( 1596, "name_01596"),
+    ENTRY( 1597, "name_01597"),
+    ENTRY( 1598, "name_01598"),
+    ENTRY( 1599, "name_01599"),
+    ENTRY( 1600, "name_01600"),
+    ENTRY( 1601, "name_01601"),
+    ENTRY( 1602, "name_01602"),
+    ENTRY( 1603, "name_01603"),
+    ENTRY( 1604, "name_01604"),
+    ENTRY( 1605, "name_01605"),
+    ENTRY( 1606, "name_01606"),
+    ENTRY( 1607, "name_01607"),
+    ENTRY( 1608, "name_01608"),
+    ENTRY( 1609, "name_01609"),
+    ENTRY( 1610, "name_01610"),
+    ENTRY( 1611, "name_01611"),
+    ENTRY( 1612, "name_01612"),
+    ENTRY( 1613, "name_01613"),
+    ENTRY( 1614, "name_01614"),
+    ENTRY( 1615, "name_01615"),
+    ENTRY( 1616, "name_01616"),
+    ENTRY( 1617, "name_01617"),
+    ENTRY( 1618, "name_01618"),
+    ENTRY( 1619, "name_01619"),
+    ENTRY( 1620, "name_01620"),
+    ENTRY( 1621, "name_01621"),
+    ENTRY( 1622, "name_01622"),
+    ENTRY( 1623, "name_01623"),
+    ENTRY( 1624, "name_01624"),
+    ENTRY( 1625, "name_01625"),
+    ENTRY( 1626, "name_01626"),
+    ENTRY( 1627, "name_01627"),
+    ENTRY( 1628, "name_01628"),
+    ENTRY( 1629, "name_01629"),
+    ENTRY( 1630, "name_01630"),
+    ENTRY( 1631, "name_01631"),
+    ENTRY( 1632, "name_01632"),
+    ENTRY( 1633, "name_01633"),
+    ENTRY( 1634, "name_01634"),
+    ENTRY( 1635, "name_01635"),
+    ENTRY( 1636, "name_01636"),
+    ENTRY( 1637, "name_01637"),
+    ENTRY( 1638, "name_01638"),
+    ENTRY( 1639, "name_01639"),
+    ENTRY( 1640, "name_01640"),
+    ENTRY( 1641, "name_01641"),
+    ENTRY( 1642, "name_01642"),
+    ENTRY( 1643, "name_01643"),
+    ENTRY( 1644, "name_01644"),
+    ENTRY( 1645, "name_01645"),
+    ENTRY( 1646, "name_01646"),
+    ENTRY( 1647, "name_01647"),
+    ENTRY( 1648, "name_01648"),
+    ENTRY( 1649, "name_01649"),
+    ENTRY( 1650, "name_01650"),
+    ENTRY( 1651, "name_01651"),
+    ENTRY( 1652, "name_01652"),
+    ENTRY( 1653, "name_01653"),
+    ENTRY( 1654, "name_01654"),
+    ENTRY( 1655, "name_01655"),
+    ENTRY( 1656, "name_01656"),
+    ENTRY( 1657, "name_01657"),
+    ENTRY( 1658, "name_01658"),
+    ENTRY( 1659, "name_01659"),
+    ENTRY( 1660, "name_01660"),
+    ENTRY( 1661, "name_01661"),
+    ENTRY( 1662, "name_01662"),
+    ENTRY( 1663, "name_01663"),
+    ENTRY( 1664, "name_01664"),
+    ENTRY( 1665, "name_01665"),
+    ENTRY( 1666, "name_01666"),
+    ENTRY( 1667, "name_01667"),
+    ENTRY( 1668, "name_01668"),
+    ENTRY( 1669, "name_01669"),
+    ENTRY( 1670, "name_01670"),
+    ENTRY( 1671, "name_01671"),
+    ENTRY( 1672, "name_01672"),
+    ENTRY( 1673, "name_01673"),
+    ENTRY( 1674, "name_01674"),
+    ENTRY( 1675, "name_01675"),
+    ENTRY( 1676, "name_01676"),
+    ENTRY( 1677, "name_01677"),
+    ENTRY( 1678, "name_01678"),
+    ENTRY( 1679, "name_01679"),
+    ENTRY( 1680, "name_01680"),
+    ENTRY( 1681, "name_01681"),
+    ENTRY( 1682, "name_01682"),
+    ENTRY( 1683, "name_01683"),
+    ENTRY( 1684, "name_01684"),
+    ENTRY( 1685, "name_01685"),
+    ENTRY( 1686, "name_01686"),
+    ENTRY( 1687, "name_01687"),
+    ENTRY( 1688, "name_01688"),
+    ENTRY( 1689, "name_01689"),
+    ENTRY( 1690, "name_01690"),
+    ENTRY( 1691, "name_01691"),
+    ENTRY( 1692, "name_01692"),
+    ENTRY( 1693, "name_01693"),
+    ENTRY( 1694, "name_01694"),
+    ENTRY( 1695, "name_01695"),
+    ENTRY( 1696, "name_01696"),
+    ENTRY( 1697, "name_01697"),
+    ENTRY( 1698, "name_01698"),
+    ENTRY( 1699, "name_01699"),
+    ENTRY( 1700, "name_01700"),
+    ENTRY( 1701, "name_01701"),
+    ENTRY( 1702, "name_01702"),
+    ENTRY( 1703, "name_01703"),
+    ENTRY( 1704, "name_01704"),
+    ENTRY( 1705, "name_01705"),
+    ENTRY( 1706, "name_01706"),
+    ENTRY( 1707, "name_01707"),
+    ENTRY( 1708, "name_01708"),
+    ENTRY( 1709, "name_01709"),
+    ENTRY( 1710, "name_01710"),
+    ENTRY( 1711, "name_01711"),
+    ENTRY( 1712, "name_01712"),
+    ENTRY( 1713, "name_01713"),
+    ENTRY( 1714, "name_01714"),
+    ENTRY( 1715, "name_01715"),
+    ENTRY( 1716, "name_01716"),
+    ENTRY( 1717, "name_01717"),
+    ENTRY( 1718, "name_01718"),
+    ENTRY( 1719, "name_01719"),
+    ENTRY( 1720, "name_01720"),
+    ENTRY( 1721, "name_01721"),
+    ENTRY( 1722, "name_01722"),
+    ENTRY( 1723, "name_01723"),
+    ENTRY( 1724, "name_01724"),
+    ENTRY( 1725, "name_01725"),
+    ENTRY( 1726, "name_01726"),
+    ENTRY( 1727, "name_01727"),
+    ENTRY( 1728, "name_01728"),
+    ENTRY( 1729, "name_01729"),
+    ENTRY( 1730, "name_01730"),
+    ENTRY( 1731, "name_01731"),
+    ENTRY( 1732, "name_01732"),
+    ENTRY( 1733, "name_01733"),
+    ENTRY( 1734, "name_01734"),
+    ENTRY( 1735, "name_01735"),
+    ENTRY( 1736, "name_01736"),
+    ENTRY( 1737, "name_01737"),
+    ENTRY( 1738, "name_01738"),
+    ENTRY( 1739, "name_01739"),
+    ENTRY( 1740, "name_01740"),
+    ENTRY( 1741, "name_01741"),
+    ENTRY( 1742, "name_01742"),
+    ENTRY( 1743, "name_01743"),
+    ENTRY( 1744, "name_01744"),
+    ENTRY( 1745, "name_01745"),
+    ENTRY( 1746, "name_01746"),
+    ENTRY( 1747, "name_01747"),
+    ENTRY( 1748, "name_01748"),
+    ENTRY( 1749, "name_01749"),
+    ENTRY( 1750, "name_01750"),
+    ENTRY( 1751, "name_01751"),
+    ENTRY( 1752, "name_01752"),
+    ENTRY( 1753, "name_01753"),
+    ENTRY( 1754, "name_01754"),
+    ENTRY( 1755, "name_01755"),
+    ENTRY( 1756, "name_01756"),
+    ENTRY( 1757, "name_01757"),
+    ENTRY( 1758, "name_01758"),
+    ENTRY( 1759, "name_01759"),
+    ENTRY( 1760, "name_01760"),
+    ENTRY( 1761, "name_01761"),
+    ENTRY( 1762, "name_01762"),
+    ENTRY( 1763, "name_01763"),
+    ENTRY( 1764, "name_01764"),
+    ENTRY( 1765, "name_01765"),
+    ENTRY( 1766, "name_01766"),
+    ENTRY( 1767, "name_01767"),
+    ENTRY( 1768, "name_01768"),
+    ENTRY( 1769, "name_01769"),
+    ENTRY( 1770, "name_01770"),
+    ENTRY( 1771, "name_01771"),
+    ENTRY( 1772, "name_01772"),
+    ENTRY( 1773, "name_01773"),
+    ENTRY( 1774, "name_01774"),
+    ENTRY( 1775, "name_01775"),
+    ENTRY( 1776, "name_01776"),
+    ENTRY( 1777, "name_01777"),
+    ENTRY( 1778, "name_01778"),
+    ENTRY( 1779, "name_01779"),
+    ENTRY( 1780, "name_01780"),
+    ENTRY( 1781, "name_01781"),
+    ENTRY( 1782, "name_01782"),
+    ENTRY( 1783, "name_01783"),
+    ENTRY( 1784, "name_01784"),
+    ENTRY( 1785, "name_01785"),
+    ENTRY( 1786, "name_01786"),
+    ENTRY( 1787, "name_01787"),
+    ENTRY( 1788, "name_01788"),
+    ENTRY( 1789, "name_01789"),
+    ENTRY( 1790, "name_01790"),
+    ENTRY( 1791, "name_01791"),
+    ENTRY( 1792, "name_01792"),
+    ENTRY( 1793, "name_01793"),
+    ENTRY( 1794, "name_01794"),
+    ENTRY( 1795, "name_01795"),
+    ENTRY( 1796, "name_01796"),
+    ENTRY( 1797, "name_01797"),
+    ENTRY( 1798, "name_01798"),
+    ENTRY( 1799, "name_01799"),
+    ENTRY( 1800, "name_01800"),
+    ENTRY( 1801, "name_01801"),
+    ENTRY( 1802, "name_01802"),
+    ENTRY( 1803, "name_01803"),
+    ENTRY( 1804, "name_01804"),
+    ENTRY( 1805, "name_01805"),
+    ENTRY( 1806, "name_01806"),
+    ENTRY( 1807, "name_01807"),
+    ENTRY( 1808, "name_01808"),
+    ENTRY( 1809, "name_01809"),
+    ENTRY( 1810, "name_01810"),
+    ENTRY( 1811, "name_01811"),
+    ENTRY( 1812, "name_01812"),
+    ENTRY( 1813, "name_01813"),
+    ENTRY( 1814, "name_01814"),
+    ENTRY( 1815, "name_01815"),
+    ENTRY( 1816, "name_01816"),
+    ENTRY( 1817, "name_01817"),
+    ENTRY( 1818, "name_01818"),
+    ENTRY( 1819, "name_01819"),
+    ENTRY( 1820, "name_01820"),
+    ENTRY( 1821, "name_01821"),
+    ENTRY( 1822, "name_01822"),
+    ENTRY( 1823, "name_01823"),
+    ENTRY( 1824, "name_01824"),
+    ENTRY( 1825, "name_01825"),
+    ENTRY( 1826, "name_01826"),
+    ENTRY( 1827, "name_01827"),
+    ENTRY( 1828, "name_01828"),
+    ENTRY( 1829, "name_01829"),
+    ENTRY( 1830, "name_01830"),
+    ENTRY( 1831, "name_01831"),
+    ENTRY( 1832, "name_01832"),
+    ENTRY( 1833, "name_01833"),
+    ENTRY( 1834, "name_01834"),
+    ENTRY( 1835, "name_01835"),
+    ENTRY( 1836, "name_01836"),
+    ENTRY( 1837, "name_01837"),
+    ENTRY( 1838, "name_01838"),
+    ENTRY( 1839, "name_01839"),
+    ENTRY( 1840, "name_01840"),
+    ENTRY( 1841, "name_01841"),
+    ENTRY( 1842, "name_01842"),
+    ENTRY( 1843, "name_01843"),
+    ENTRY( 1844, "name_01844"),
+    ENTRY( 1845, "name_01845"),
+    ENTRY( 1846, "name_01846"),
+    ENTRY( 1847, "name_01847"),
+    ENTRY( 1848, "name_01848"),
+    ENTRY( 1849, "name_01849"),
+    ENTRY( 1850, "name_01850"),
+    ENTRY( 1851, "name_01851"),
+    ENTRY( 1852, "name_01852"),
+    ENTRY( 1853, "name_01853"),
+    ENTRY( 1854, "name_01854"),
+    ENTRY( 1855, "name_01855"),
+    ENTRY( 1856, "name_01856"),
+    ENTRY( 1857, "name_01857"),
+    ENTRY( 1858, "name_01858"),
+    ENTRY( 1859, "name_01859"),
+    ENTRY( 1860, "name_01860"),
+    ENTRY( 1861, "name_01861"),
+    ENTRY( 1862, "name_01862"),
+    ENTRY( 1863, "name_01863"),
+    ENTRY( 1864, "name_01864"),
+    ENTRY( 1865, "name_01865"),
+    ENTRY( 1866, "name_01866"),
+    ENTRY( 1867, "name_01867"),
+    ENTRY( 1868, "name_01868"),
+    ENTRY( 1869, "name_01869"),
+    ENTRY( 1870, "name_01870"),
+    ENTRY( 1871, "name_01871"),
+    ENTRY( 1872, "name_01872"),
+    ENTRY( 1873, "name_01873"),
+    ENTRY( 1874, "name_01874"),
+    ENTRY( 1875, "name_01875"),
+    ENTRY( 1876, "name_01876"),
+    ENTRY( 1877, "name_01877"),
+    ENTRY( 1878, "name_01878"),
+    ENTRY( 1879, "name_01879"),
+    ENTRY( 1880, "name_01880"),
+    ENTRY( 1881, "name_01881"),
+    ENTRY( 1882, "name_01882"),
+    ENTRY( 1883, "name_01883"),
+    ENTRY( 1884, "name_01884"),
+    ENTRY( 1885, "name_01885"),
+    ENTRY( 1886, "name_01886"),
+    ENTRY( 1887, "name_01887"),
+    ENTRY( 1888, "name_01888"),
+    ENTRY( 1889, "name_01889"),
+    ENTRY( 1890, "name_01890"),
+    ENTRY( 1891, "name_01891"),
+    ENTRY( 1892, "name_01892"),
+    ENTRY( 1893, "name_01893"),
+    ENTRY( 1894, "name_01894"),
+    ENTRY( 1895, "name_01895"),
+    ENTRY( 1896, "name_01896"),
+    ENTRY( 1897, "name_01897"),
+    ENTRY( 1898, "name_01898"),
+    ENTRY( 1899, "name_01899"),
+    ENTRY( 1900, "name_01900"),
+    ENTRY( 1901, "name_01901"),
+    ENTRY( 1902, "name_01902"),
+    ENTRY( 1903, "name_01903"),
+    ENTRY( 1904, "name_01904"),
+    ENTRY( 1905, "name_01905"),
+    ENTRY( 1906, "name_01906"),
+    ENTRY( 1907, "name_01907"),
+    ENTRY( 1908, "name_01908"),
+    ENTRY( 1909, "name_01909"),
+    ENTRY( 1910, "name_01910"),
+    ENTRY( 1911, "name_01911"),
+    ENTRY( 1912, "name_01912"),
+    ENTRY( 1913, "name_01913"),
+    ENTRY( 1914, "name_01914"),
+    ENTRY( 1915, "name_01915"),
+    ENTRY( 1916, "name_01916"),
+    ENTRY( 1917, "name_01917"),
+    ENTRY( 1918, "name_01918"),
+    ENTRY( 1919, "name_01919"),
+    ENTRY( 1920, "name_01920"),
+    ENTRY( 1921, "name_01921"),
+    ENTRY( 1922, "name_01922"),
+    ENTRY( 1923, "name_01923"),
+    ENTRY( 1924, "name_01924"),
+    ENTRY( 1925, "name_01925"),
+    ENTRY( 1926, "name_01926"),
+    ENTRY( 1927, "name_01927"),
+    ENTRY( 1928, "name_01928"),
+    ENTRY( 1929, "name_01929"),
+    ENTRY( 1930, "name_01930"),
+    ENTRY( 1931, "name_01931"),
+    ENTRY( 1932, "name_01932"),
+    ENTRY( 1933, "name_01933"),
+    ENTRY( 1934, "name_01934"),
+    ENTRY( 1935, "name_01935"),
+    ENTRY( 1936, "name_01936"),
+    ENTRY( 1937, "name_01937"),
+    ENTRY( 1938, "name_01938"),
+    ENTRY( 1939, "name_01939"),
+    ENTRY( 1940, "name_01940"),
+    ENTRY( 1941, "name_01941"),
+    ENTRY( 1942, "name_01942"),
+    ENTRY( 1943, "name_01943"),
+    ENTRY( 1944, "name_01944"),
+    ENTRY( 1945, "name_01945"),
+    ENTRY( 1946, "name_01946"),
+    ENTRY( 1947, "name_01947"),
+    ENTRY( 1948, "name_01948"),
+    ENTRY( 1949, "name_01949"),
+    ENTRY( 1950, "name_01950"),
+    ENTRY( 1951, "name_01951"),
+    ENTRY( 1952, "name_01952"),
+    ENTRY( 1953, "name_01953"),
+    ENTRY( 1954, "name_01954"),
+    ENTRY( 1955, "name_01955"),
+    ENTRY( 1956, "name_01956"),
+    ENTRY( 1957, "name_01957"),
+    ENTRY( 1958, "name_01958"),
+    ENTRY( 1959, "name_01959"),
+    ENTRY( 1960, "name_01960"),
+    ENTRY( 1961, "name_01961"),
+    ENTRY( 1962, "name_01962"),
+    ENTRY( 1963, "name_01963"),
+    ENTRY( 1964, "name_01964"),
+    ENTRY( 1965, "name_01965"),
+    ENTRY( 1966, "name_01966"),
+    ENTRY( 1967, "name_01967"),
+    ENTRY( 1968, "name_01968"),
+    ENTRY( 1969, "name_01969"),
+    ENTRY( 1970, "name_01970"),
+    ENTRY( 1971, "name_01971"),
+    ENTRY( 1972, "name_01972"),
+    ENTRY( 1973, "name_01973"),
+    ENTRY( 1974, "name_01974"),
+    ENTRY( 1975, "name_01975"),
+    ENTRY( 1976, "name_01976"),
+    ENTRY( 1977, "name_01977"),
+    ENTRY( 1978, "name_01978"),
+    ENTRY( 1979, "name_01979"),
+    ENTRY( 1980, "name_01980"),
+    ENTRY( 1981, "name_01981"),
+    ENTRY( 1982, "name_01982"),
+    ENTRY( 1983, "name_01983"),
+    ENTRY( 1984, "name_01984"),
+    ENTRY( 1985, "name_01985"),
+    ENTRY( 1986, "name_01986"),
+    ENTRY( 1987, "name_01987"),
+    ENTRY( 1988, "name_01988"),
+    ENTRY( 1989, "name_01989"),
+    ENTRY( 1990, "name_01990"),
+    ENTRY( 1991, "name_01991"),
+    ENTRY( 1992, "name_01992"),
+    ENTRY( 1993, "name_01993"),
+    ENTRY( 1994, "name_01994"),
+    ENTRY( 1995, "name_01995"),
+    ENTRY( 1996, "name_01996"),
+    ENTRY( 1997, "name_01997"),
+    ENTRY( 1998, "name_01998"),
+    ENTRY( 1999, "name_01999"),
+    ENTRY( 2000, "name_02000"),
+    ENTRY( 2001, "name_02001"),
+    ENTRY( 2002, "name_02002"),
+    ENTRY( 2003, "name_02003"),
+    ENTRY( 2004, "name_02004"),
+    ENTRY( 2005, "name_02005"),
+    ENTRY( 2006, "name_02006"),
+    ENTRY( 2007, "name_02007"),
+    ENTRY( 2008, "name_02008"),
+    ENTRY( 2009, "name_02009"),
+    ENTRY( 2010, "name_02010"),
+    ENTRY( 2011, "name_02011"),
+    ENTRY( 2012, "name_02012"),
+    ENTRY( 2013, "name_02013"),
+    ENTRY( 2014, "name_02014"),
+    ENTRY( 2015, "name_02015"),
+    ENTRY( 2016, "name_02016"),
+    ENTRY( 2017, "name_02017"),
+    ENTRY( 2018, "name_02018"),
+    ENTRY( 2019, "name_02019"),
+    ENTRY( 2020, "name_02020"),
+    ENTRY( 2021, "name_02021"),
+    ENTRY( 2022, "name_02022"),
+    ENTRY( 2023, "name_02023"),
+    ENTRY( 2024, "name_02024"),
+    ENTRY( 2025, "name_02025"),
+    ENTRY( 2026, "name_02026"),
+    ENTRY( 2027, "name_02027"),
+    ENTRY( 2028, "name_02028"),
+    ENTRY( 2029, "name_02029"),
+    ENTRY( 2030, "name_02030"),
+    ENTRY( 2031, "name_02031"),
+    ENTRY( 2032, "name_02032"),
+    ENTRY( 2033, "name_02033"),
+    ENTRY( 2034, "name_02034"),
+    ENTRY( 2035, "name_02035"),
+    ENTRY( 2036, "name_02036"),
+    ENTRY( 2037, "name_02037"),
+    ENTRY( 2038, "name_02038"),
+    ENTRY( 2039, "name_02039"),
+    ENTRY( 2040, "name_02040"),
+    ENTRY( 2041, "name_02041"),
+    ENTRY( 2042, "name_02042"),
+    ENTRY( 2043, "name_02043"),
+    ENTRY( 2044, "name_02044"),
+    ENTRY( 2045, "name_02045"),
+    ENTRY( 2046, "name_02046"),
+    ENTRY( 2047, "name_02047"),
+    ENTRY( 2048, "name_02048"),
+    ENTRY( 2049, "name_02049"),
+    ENTRY( 2050, "name_02050"),
+    ENTRY( 2051, "name_02051"),
+    ENTRY( 2052, "name_02052"),
+    ENTRY( 2053, "name_02053"),
+    ENTRY( 2054, "name_02054"),
+    ENTRY( 2055, "name_02055"),
+    ENTRY( 2056, "name_02056"),
+    ENTRY( 2057, "name_02057"),
+    ENTRY( 2058, "name_02058"),
+    ENTRY( 2059, "name_02059"),
+    ENTRY( 2060, "name_02060"),
+    ENTRY( 2061, "name_02061"),
+    ENTRY( 2062, "name_02062"),
+    ENTRY( 2063, "name_02063"),
+    ENTRY( 2064, "name_02064"),
+    ENTRY( 2065, "name_02065"),
+    ENTRY( 2066, "name_02066"),
+    ENTRY( 2067, "name_02067"),
+    ENTRY( 2068, "name_02068"),
+    ENTRY( 2069, "name_02069"),
+    ENTRY( 2070, "name_02070"),
+    ENTRY( 2071, "name_02071"),
+    ENTRY( 2072, "name_02072"),
+    ENTRY( 2073, "name_02073"),
+    ENTRY( 2074, "name_02074"),
+    ENTRY( 2075, "name_02075"),
+    ENTRY( 2076, "name_02076"),
+    ENTRY( 2077, "name_02077"),
+    ENTRY( 2078, "name_02078"),
+    ENTRY( 2079, "name_02079"),
+    ENTRY( 2080, "name_02080"),
+    ENTRY( 2081, "name_02081"),
+    ENTRY( 2082, "name_02082"),
+    ENTRY( 2083, "name_02083"),
+    ENTRY( 2084, "name_02084"),
+    ENTRY( 2085, "name_02085"),
+    ENTRY( 2086, "name_02086"),
+    ENTRY( 2087, "name_02087"),
+    ENTRY( 2088, "name_02088"),
+    ENTRY( 2089, "name_02089"),
+    ENTRY( 2090, "name_02090"),
+    ENTRY( 2091, "name_02091"),
+    ENTRY( 2092, "name_02092"),
+    ENTRY( 2093, "name_02093"),
+    ENTRY( 2094, "name_02094"),
+    ENTRY( 2095, "name_02095"),
+    ENTRY( 2096, "name_02096"),
+    ENTRY( 2097, "name_02097"),
+    ENTRY( 2098, "name_02098"),
+    ENTRY( 2099, "name_02099"),
+    ENTRY( 2100, "name_02100"),
+    ENTRY( 2101, "name_02101"),
+    ENTRY( 2102, "name_02102"),
+    ENTRY( 2103, "name_02103"),
+    ENTRY( 2104, "name_02104"),
+    ENTRY( 2105, "name_02105"),
+    ENTRY( 2106, "name_02106"),
+    ENTRY( 2107, "name_02107"),
+    ENTRY( 2108, "name_02108"),
+    ENTRY( 2109, "name_02109"),
+    ENTRY( 2110, "name_02110"),
+    ENTRY( 2111, "name_02111"),
+    ENTRY( 2112, "name_02112"),
+    ENTRY( 2113, "name_02113"),
+    ENTRY( 2114, "name_02114"),
+    ENTRY( 2115, "name_02115"),
+    ENTRY( 2116, "name_02116"),
+    ENTRY( 2117, "name_02117"),
+    ENTRY( 2118, "name_02118"),
+    ENTRY( 2119, "name_02119"),
+    ENTRY( 2120, "name_02120"),
+    ENTRY( 2121, "name_02121"),
+    ENTRY( 2122, "name_02122"),
+    ENTRY( 2123, "name_02123"),
+    ENTRY( 2124, "name_02124"),
+    ENTRY( 2125, "name_02125"),
+    ENTRY( 2126, "name_02126"),
+    ENTRY( 2127, "name_02127"),
+    ENTRY( 2128, "name_02128"),
+    ENTRY( 2129, "name_02129"),
+    ENTRY( 2130, "name_02130"),
+    ENTRY( 2131, "name_02131"),
+    ENTRY( 2132, "name_02132"),
+    ENTRY( 2133, "name_02133"),
+    ENTRY( 2134, "name_02134"),
+    ENTRY( 2135, "name_02135"),
+    ENTRY( 2136, "name_02136"),
+    ENTRY( 2137, "name_02137"),
+    ENTRY( 2138, "name_02138"),
+    ENTRY( 2139, "name_02139"),
+    ENTRY( 2140, "name_02140"),
+    ENTRY( 2141, "name_02141"),
+    ENTRY( 2142, "name_02142"),
+    ENTRY( 2143, "name_02143"),
+    ENTRY( 2144, "name_02144"),
+    ENTRY( 2145, "name_02145"),
+    ENTRY( 2146, "name_02146"),
+    ENTRY( 2147, "name_02147"),
+    ENTRY( 2148, "name_02148"),
+    ENTRY( 2149, "name_02149"),
+    ENTRY( 2150, "name_02150"),
+    ENTRY( 2151, "name_02151"),
+    ENTRY( 2152, "name_02152"),
+    ENTRY( 2153, "name_02153"),
+    ENTRY( 2154, "name_02154"),
+    ENTRY( 2155, "name_02155"),
+    ENTRY( 2156, "name_02156"),
+    ENTRY( 2157, "name_02157"),
+    ENTRY( 2158, "name_02158"),
+    ENTRY( 2159, "name_02159"),
+    ENTRY( 2160, "name_02160"),
+    ENTRY( 2161, "name_02161"),
+    ENTRY( 2162, "name_02162"),
+    ENTRY( 2163, "name_02163"),
+    ENTRY( 2164, "name_02164"),
+    ENTRY( 2165, "name_02165"),
+    ENTRY( 2166, "name_02166"),
+    ENTRY( 2167, "name_02167"),
+    ENTRY( 2168, "name_02168"),
+    ENTRY( 2169, "name_02169"),
+    ENTRY( 2170, "name_02170"),
+    ENTRY( 2171, "name_02171"),
+    ENTRY( 2172, "name_02172"),
+    ENTRY( 2173, "name_02173"),
+    ENTRY( 2174, "name_02174"),
+    ENTRY( 2175, "name_02175"),
+    ENTRY( 2176, "name_02176"),
+    ENTRY( 2177, "name_02177"),
+    ENTRY( 2178, "name_02178"),
+    ENTRY( 2179, "name_02179"),
+    ENTRY( 2180, "name_02180"),
+    ENTRY( 2181, "name_02181"),
+    ENTRY( 2182, "name_02182"),
+    ENTRY( 2183, "name_02183"),
+    ENTRY( 2184, "name_02184"),
+    ENTRY( 2185, "name_02185"),
+    ENTRY( 2186, "name_02186"),
+    ENTRY( 2187, "name_02187"),
+    ENTRY( 2188, "name_02188"),
+    ENTRY( 2189, "name_02189"),
+    ENTRY( 2190, "name_02190"),
+    ENTRY( 2191, "name_02191"),
+    ENTRY( 2192, "name_02192"),
+    ENTRY( 2193, "name_02193"),
+    ENTRY( 2194, "name_02194"),
+    ENTRY( 2195, "name_02195"),
+    ENTRY( 2196, "name_02196"),
+    ENTRY( 2197, "name_02197"),
+    ENTRY( 2198, "name_02198"),
+    ENTRY( 2199, "name_02199"),
+    ENTRY( 2200, "name_02200"),
+    ENTRY( 2201, "name_02201"),
+    ENTRY( 2202, "name_02202"),
+    ENTRY( 2203, "name_02203"),
+    ENTRY( 2204, "name_02204"),
+    ENTRY( 2205, "name_02205"),
+    ENTRY( 2206, "name_02206"),
+    ENTRY( 2207, "name_02207"),
+    ENTRY( 2208, "name_02208"),
+    ENTRY( 2209, "name_02209"),
+    ENTRY( 2210, "name_02210"),
+    ENTRY( 2211, "name_02211"),
+    ENTRY( 2212, "name_02212"),
+    ENTRY( 2213, "name_02213"),
+    ENTRY( 2214, "name_02214"),
+    ENTRY( 2215, "name_02215"),
+    ENTRY( 2216, "name_02216"),
+    ENTRY( 2217, "name_02217"),
+    ENTRY( 2218, "name_02218"),
+    ENTRY( 2219, "name_02219"),
+    ENTRY( 2220, "name_02220"),
+    ENTRY( 2221, "name_02221"),
+    ENTRY( 2222, "name_02222"),
+    ENTRY( 2223, "name_02223"),
+    ENTRY( 2224, "name_02224"),
+    ENTRY( 2225, "name_02225"),
+    ENTRY( 2226, "name_02226"),
+    ENTRY( 2227, "name_02227"),
+    ENTRY( 2228, "name_02228"),
+    ENTRY( 2229, "name_02229"),
+    ENTRY( 2230, "name_02230"),
+    ENTRY( 2231, "name_02231"),
+    ENTRY( 2232, "name_02232"),
+    ENTRY( 2233, "name_02233"),
+    ENTRY( 2234, "name_02234"),
+    ENTRY( 2235, "name_02235"),
+    ENTRY( 2236, "name_02236"),
+    ENTRY( 2237, "name_02237"),
+    ENTRY( 2238, "name_02238"),
+    ENTRY( 2239, "name_02239"),
+    ENTRY( 2240, "name_02240"),
+    ENTRY( 2241, "name_02241"),
+    ENTRY( 2242, "name_02242"),
+    ENTRY( 2243, "name_02243"),
+    ENTRY( 2244, "name_02244"),
+    ENTRY( 2245, "name_02245"),
+    ENTRY( 2246, "name_02246"),
+    ENTRY( 2247, "name_02247"),
+    ENTRY( 2248, "name_02248"),
+    ENTRY( 2249, "name_02249"),
+    ENTRY( 2250, "name_02250"),
+    ENTRY( 2251, "name_02251"),
+    ENTRY( 2252, "name_02252"),
+    ENTRY( 2253, "name_02253"),
+    ENTRY( 2254, "name_02254"),
+    ENTRY( 2255, "name_02255"),
+    ENTRY( 2256, "name_02256"),
+    ENTRY( 2257, "name_02257"),
+    ENTRY( 2258, "name_02258"),
+    ENTRY( 2259, "name_02259"),
+    ENTRY( 2260, "name_02260"),
+    ENTRY( 2261, "name_02261"),
+    ENTRY( 2262, "name_02262"),
+    ENTRY( 2263, "name_02263"),
+    ENTRY( 2264, "name_02264"),
+    ENTRY( 2265, "name_02265"),
+    ENTRY( 2266, "name_02266"),
+    ENTRY( 2267, "name_02267"),
+    ENTRY( 2268, "name_02268"),
+    ENTRY( 2269, "name_02269"),
+    ENTRY( 2270, "name_02270"),
+    ENTRY( 2271, "name_02271"),
+    ENTRY( 2272, "name_02272"),
+    ENTRY( 2273, "name_02273"),
+    ENTRY( 2274, "name_02274"),
+    ENTRY( 2275, "name_02275"),
+    ENTRY( 2276, "name_02276"),
+    ENTRY( 2277, "name_02277"),
+    ENTRY( 2278, "name_02278"),
+    ENTRY( 2279, "name_02279"),
+    ENTRY( 2280, "name_02280"),
+    ENTRY( 2281, "name_02281"),
+    ENTRY( 2282, "name_02282"),
+    ENTRY( 2283, "name_02283"),
+    ENTRY( 2284, "name_02284"),
+    ENTRY( 2285, "name_02285"),
+    ENTRY( 2286, "name_02286"),
+    ENTRY( 2287, "name_02287"),
+    ENTRY( 2288, "name_02288"),
+    ENTRY( 2289, "name_02289"),
+    ENTRY( 2290, "name_02290"),
+    ENTRY( 2291, "name_02291"),
+    ENTRY( 2292, "name_02292"),
+    ENTRY( 2293, "name_02293"),
+    ENTRY( 2294, "name_02294"),
+    ENTRY( 2295, "name_02295"),
+    ENTRY( 2296, "name_02296"),
+    ENTRY( 2297, "name_02297"),
+    ENTRY( 2298, "name_02298"),
+    ENTRY( 2299, "name_02299"),
+    ENTRY( 2300, "name_02300"),
+    ENTRY( 2301, "name_02301"),
+    ENTRY( 2302, "name_02302"),
+    ENTRY( 2303, "name_02303"),
+    ENTRY( 2304, "name_02304"),
+    ENTRY( 2305, "name_02305"),
+    ENTRY( 2306, "name_02306"),
+    ENTRY( 2307, "name_02307"),
+    ENTRY( 2308, "name_02308"),
+    ENTRY( 2309, "name_02309"),
+    ENTRY( 2310, "name_02310"),
+    ENTRY( 2311, "name_02311"),
+    ENTRY( 2312, "name_02312"),
+    ENTRY( 2313, "name_02313"),
+    ENTRY( 2314, "name_02314"),
+    ENTRY( 2315, "name_02315"),
+    ENTRY( 2316, "name_02316"),
+    ENTRY( 2317, "name_02317"),
+    ENTRY( 2318, "name_02318"),
+    ENTRY( 2319, "name_02319"),
+    ENTRY( 2320, "name_02320"),
+    ENTRY( 2321, "name_02321"),
+    ENTRY( 2322, "name_02322"),
+    ENTRY( 2323, "name_02323"),
+    ENTRY( 2324, "name_02324"),
+    ENTRY( 2325, "name_02325"),
+    ENTRY( 2326, "name_02326"),
+    ENTRY( 2327, "name_02327"),
+    ENTRY( 2328, "name_02328"),
+    ENTRY( 2329, "name_02329"),
+    ENTRY( 2330, "name_02330"),
+    ENTRY( 2331, "name_02331"),
+    ENTRY( 2332, "name_02332"),
+    ENTRY( 2333, "name_02333"),
+    ENTRY( 2334, "name_02334"),
+    ENTRY( 2335, "name_02335"),
+    ENTRY( 2336, "name_02336"),
+    ENTRY( 2337, "name_02337"),
+    ENTRY( 2338, "name_02338"),
+    ENTRY( 2339, "name_02339"),
+    ENTRY( 2340, "name_02340"),
+    ENTRY( 2341, "name_02341"),
+    ENTRY( 2342, "name_02342"),
+    ENTRY( 2343, "name_02343"),
+    ENTRY( 2344, "name_02344"),
+    ENTRY( 2345, "name_02345"),
+    ENTRY( 2346, "name_02346"),
+    ENTRY( 2347, "name_02347"),
+    ENTRY( 2348, "name_02348"),
+    ENTRY( 2349, "name_02349"),
+    ENTRY( 2350, "name_02350"),
+    ENTRY( 2351, "name_02351"),
+    ENTRY( 2352, "name_02352"),
+    ENTRY( 2353, "name_02353"),
+    ENTRY( 2354, "name_02354"),
+    ENTRY( 2355, "name_02355"),
+    ENTRY( 2356, "name_02356"),
+    ENTRY( 2357, "name_02357"),
+    ENTRY( 2358, "name_02358"),
+    ENTRY( 2359, "name_02359"),
+    ENTRY( 2360, "name_02360"),
+    ENTRY( 2361, "name_02361"),
+    ENTRY( 2362, "name_02362"),
+    ENTRY( 2363, "name_02363"),
+    ENTRY( 2364, "name_02364"),
+    ENTRY( 2365, "name_02365"),
+    ENTRY( 2366, "name_02366"),
+    ENTRY( 2367, "name_02367"),
+    ENTRY( 2368, "name_02368"),
+    ENTRY( 2369, "name_02369"),
+    ENTRY( 2370, "name_02370"),
+    ENTRY( 2371, "name_02371"),
+    ENTRY( 2372, "name_02372"),
+    ENTRY( 2373, "name_02373"),
+    ENTRY( 2374, "name_02374"),
+    ENTRY( 2375, "name_02375"),
+    ENTRY( 2376, "name_02376"),
+    ENTRY( 2377, "name_02377"),
+    ENTRY( 2378, "name_02378"),
+    ENTRY( 2379, "name_02379"),
+    ENTRY( 2380, "name_02380"),
+    ENTRY( 2381, "name_02381"),
+    ENTRY( 2382, "name_02382"),
+    ENTRY( 2383, "name_02383"),
+    ENTRY( 2384, "name_02384"),
+    ENTRY( 2385, "name_02385"),
+    ENTRY( 2386, "name_02386"),
+    ENTRY( 2387, "name_02387"),
+    ENTRY( 2388, "name_02388"),
+    ENTRY( 2389, "name_02389"),
+    ENTRY( 2390, "name_02390"),
+    ENTRY( 2391, "name_02391"),
+    ENTRY( 2392, "name_02392"),
+    ENTRY( 2393, "name_02393"),
+    ENTRY( 2394, "name_02394"),
+    ENTRY( 2395, "name_02395"),
+    ENTRY( 2396, "name_02396"),
+    ENTRY( 2397, "name_02397"),
+    ENTRY( 2398, "name_02398"),
+    ENTRY( 2399, "name_02399"),
+    ENTRY( 2400, "name_02400"),
+    ENTRY( 2401, "name_02401"),
+    ENTRY( 2402, "name_02402"),
+    ENTRY( 2403, "name_02403"),
+    ENTRY( 2404, "name_02404"),
+    ENTRY( 2405, "name_02405"),
+    ENTRY( 2406, "name_02406"),
+    ENTRY( 2407, "name_02407"),
+    ENTRY( 2408, "name_02408"),
+    ENTRY( 2409, "name_02409"),
+    ENTRY( 2410, "name_02410"),
+    ENTRY( 2411, "name_02411"),
+    ENTRY( 2412, "name_02412"),
+    ENTRY( 2413, "name_02413"),
+    ENTRY( 2414, "name_02414"),
+    ENTRY( 2415, "name_02415"),
+    ENTRY( 2416, "name_02416"),
+    ENTRY( 2417, "name_02417"),
+    ENTRY( 2418, "name_02418"),
+    ENTRY( 2419, "name_02419"),
+    ENTRY( 2420, "name_02420"),
+    ENTRY( 2421, "name_02421"),
+    ENTRY( 2422, "name_02422"),
+    ENTRY( 2423, "name_02423"),
+    ENTRY( 2424, "name_02424"),
+    ENTRY( 2425, "name_02425"),
+    ENTRY( 2426, "name_02426"),
+    ENTRY( 2427, "name_02427"),
+    ENTRY( 2428, "name_02428"),
+    ENTRY( 2429, "name_02429"),
+    ENTRY( 2430, "name_02430"),
+    ENTRY( 2431, "name_02431"),
+    ENTRY( 2432, "name_02432"),
+    ENTRY( 2433, "name_02433"),
+    ENTRY( 2434, "name_02434"),
+    ENTRY( 2435, "name_02435"),
+    ENTRY( 2436, "name_02436"),
+    ENTRY( 2437, "name_02437"),
+    ENTRY( 2438, "name_02438"),
+    ENTRY( 2439, "name_02439"),
+    ENTRY( 2440, "name_02440"),
+    ENTRY( 2441, "name_02441"),
+    ENTRY( 2442, "name_02442"),
+    ENTRY( 2443, "name_02443"),
+    ENTRY( 2444, "name_02444"),
+    ENTRY( 2445, "name_02445"),
+    ENTRY( 2446, "name_02446"),
+    ENTRY( 2447, "name_02447"),
+    ENTRY( 2448, "name_02448"),
+    ENTRY( 2449, "name_02449"),
+    ENTRY( 2450, "name_02450"),
+    ENTRY( 2451, "name_02451"),
+    ENTRY( 2452, "name_02452"),
+    ENTRY( 2453, "name_02453"),
+    ENTRY( 2454, "name_02454"),
+    ENTRY( 2455, "name_02455"),
+    ENTRY( 2456, "name_02456"),
+    ENTRY( 2457, "name_02457"),
+    ENTRY( 2458, "name_02458"),
+    ENTRY( 2459, "name_02459"),
+    ENTRY( 2460, "name_02460"),
+    ENTRY( 2461, "name_02461"),
+    ENTRY( 2462, "name_02462"),
+    ENTRY( 2463, "name_02463"),
+    ENTRY( 2464, "name_02464"),
+    ENTRY( 2465, "name_02465"),
+    ENTRY( 2466, "name_02466"),
+    ENTRY( 2467, "name_02467"),
+    ENTRY( 2468, "name_02468"),
+    ENTRY( 2469, "name_02469"),
+    ENTRY( 2470, "name_02470"),
+    ENTRY( 2471, "name_02471"),
+    ENTRY( 2472, "name_02472"),
+    ENTRY( 2473, "name_02473"),
+    ENTRY( 2474, "name_02474"),
+    ENTRY( 2475, "name_02475"),
+    ENTRY( 2476, "name_02476"),
+    ENTRY( 2477, "name_02477"),
+    ENTRY( 2478, "name_02478"),
+    ENTRY( 2479, "name_02479"),
+    ENTRY( 2480, "name_02480"),
+    ENTRY( 2481, "name_02481"),
+    ENTRY( 2482, "name_02482"),
+    ENTRY( 2483, "name_02483"),
+    ENTRY( 2484, "name_02484"),
+    ENTRY( 2485, "name_02485"),
+    ENTRY( 2486, "name_02486"),
+    ENTRY( 2487, "name_02487"),
+    ENTRY( 2488, "name_02488"),
+    ENTRY( 2489, "name_02489"),
+    ENTRY( 2490, "name_02490"),
+    ENTRY( 2491, "name_02491"),
+    ENTRY( 2492, "name_02492"),
+    ENTRY( 2493, "name_02493"),
+    ENTRY( 2494, "name_02494"),
+    ENTRY( 2495, "name_02495"),
+    ENTRY( 2496, "name_02496"),
+    ENTRY( 2497, "name_02497"),
+    ENTRY( 2498, "name_02498"),
+    ENTRY( 2499, "name_02499"),
+    ENTRY( 2500, "name_02500"),
+    ENTRY( 2501, "name_02501"),
+    ENTRY( 2502, "name_02502"),
+    ENTRY( 2503, "name_02503"),
+    ENTRY( 2504, "name_02504"),
+    ENTRY( 2505, "name_02505"),
+    ENTRY( 2506, "name_02506"),
+    ENTRY( 2507, "name_02507"),
+    ENTRY( 2508, "name_02508"),
+    ENTRY( 2509, "name_02509"),
+    ENTRY( 2510, "name_02510"),
+    ENTRY( 2511, "name_02511"),
+    ENTRY( 2512, "name_02512"),
+    ENTRY( 2513, "name_02513"),
+    ENTRY( 2514, "name_02514"),
+    ENTRY( 2515, "name_02515"),
+    ENTRY( 2516, "name_02516"),
+    ENTRY( 2517, "name_02517"),
+    ENTRY( 2518, "name_02518"),
+    ENTRY( 2519, "name_02519"),
+    ENTRY( 2520, "name_02520"),
+    ENTRY( 2521, "name_02521"),
+    ENTRY( 2522, "name_02522"),
+    ENTRY( 2523, "name_02523"),
+    ENTRY( 2524, "name_02524"),
+    ENTRY( 2525, "name_02525"),
+    ENTRY( 2526, "name_02526"),
+    ENTRY( 2527, "name_02527"),
+    ENTRY( 2528, "name_02528"),
+    ENTRY( 2529, "name_02529"),
+    ENTRY( 2530, "name_02530"),
+    ENTRY( 2531, "name_02531"),
+    ENTRY( 2532, "name_02532"),
+    ENTRY( 2533, "name_02533"),
+    ENTRY( 2534, "name_02534"),
+    ENTRY( 2535, "name_02535"),
+    ENTRY( 2536, "name_02536"),
+    ENTRY( 2537, "name_02537"),
+    ENTRY( 2538, "name_02538"),
+    ENTRY( 2539, "name_02539"),
+    ENTRY( 2540, "name_02540"),
+    ENTRY( 2541, "name_02541"),
+    ENTRY( 2542, "name_02542"),
+    ENTRY( 2543, "name_02543"),
+    ENTRY( 2544, "name_02544"),
+    ENTRY( 2545, "name_02545"),
+    ENTRY( 2546, "name_02546"),
+    ENTRY( 2547, "name_02547"),
+    ENTRY( 2548, "name_02548"),
+    ENTRY( 2549, "name_02549"),
+    ENTRY( 2550, "name_02550"),
+    ENTRY( 2551, "name_02551"),
+    ENTRY( 2552, "name_02552"),
+    ENTRY( 2553, "name_02553"),
+    ENTRY( 2554, "name_02554"),
+    ENTRY( 2555, "name_02555"),
+    ENTRY( 2556, "name_02556"),
+    ENTRY( 2557, "name_02557"),
+    ENTRY( 2558, "name_02558"),
+    ENTRY( 2559, "name_02559"),
+    ENTRY( 2560, "name_02560"),
+    ENTRY( 2561, "name_02561"),
+    ENTRY( 2562, "name_02562"),
+    ENTRY( 2563, "name_02563"),
+    ENTRY( 2564, "name_02564"),
+    ENTRY( 2565, "name_02565"),
+    ENTRY( 2566, "name_02566"),
+    ENTRY( 2567, "name_02567"),
+    ENTRY( 2568, "name_02568"),
+    ENTRY( 2569, "name_02569"),
+    ENTRY( 2570, "name_02570"),
+    ENTRY( 2571, "name_02571"),
+    ENTRY( 2572, "name_02572"),
+    ENTRY( 2573, "name_02573"),
+    ENTRY( 2574, "name_02574"),
+    ENTRY( 2575, "name_02575"),
+    ENTRY( 2576, "name_02576"),
+    ENTRY( 2577, "name_02577"),
+    ENTRY( 2578, "name_02578"),
+    ENTRY( 2579, "name_02579"),
+    ENTRY( 2580, "name_02580"),
+    ENTRY( 2581, "name_02581"),
+    ENTRY( 2582, "name_02582"),
+    ENTRY( 2583, "name_02583"),
+    ENTRY( 2584, "name_02584"),
+    ENTRY( 2585, "name_02585"),
+    ENTRY( 2586, "name_02586"),
+    ENTRY( 2587, "name_02587"),
+    ENTRY( 2588, "name_02588"),
+    ENTRY( 2589, "name_02589"),
+    ENTRY( 2590, "name_02590"),
+    ENTRY( 2591, "name_02591"),
+    ENTRY( 2592, "name_02592"),
+    ENTRY( 2593, "name_02593"),
+    ENTRY( 2594, "name_02594"),
+    ENTRY( 2595, "name_02595"),
+    ENTRY( 2596, "name_02596"),
+    ENTRY( 2597, "name_02597"),
+    ENTRY( 2598, "name_02598"),
+    ENTRY( 2599, "name_02599"),
+    ENTRY( 2600, "name_02600"),
+    ENTRY( 2601, "name_02601"),
+    ENTRY( 2602, "name_02602"),
+    ENTRY( 2603, "name_02603"),
+    ENTRY( 2604, "name_02604"),
+    ENTRY( 2605, "name_02605"),
+    ENTRY( 2606, "name_02606"),
+    ENTRY( 2607, "name_02607"),
+    ENTRY( 2608, "name_02608"),
+    ENTRY( 2609, "name_02609"),
+    ENTRY( 2610, "name_02610"),
+    ENTRY( 2611, "name_02611"),
+    ENTRY( 2612, "name_02612"),
+    ENTRY( 2613, "name_02613"),
+    ENTRY( 2614, "name_02614"),
+    ENTRY( 2615, "name_02615"),
+    ENTRY( 2616, "name_02616"),
+    ENTRY( 2617, "name_02617"),
+    ENTRY( 2618, "name_02618"),
+    ENTRY( 2619, "name_02619"),
+    ENTRY( 2620, "name_02620"),
+    ENTRY( 2621, "name_02621"),
+    ENTRY( 2622, "name_02622"),
+    ENTRY( 2623, "name_02623"),
+    ENTRY( 2624, "name_02624"),
+    ENTRY( 2625, "name_02625"),
+    ENTRY( 2626, "name_02626"),
+    ENTRY( 2627, "name_02627"),
+    ENTRY( 2628, "name_02628"),
+    ENTRY( 2629, "name_02629"),
+    ENTRY( 2630, "name_02630"),
+    ENTRY( 2631, "name_02631"),
+    ENTRY( 2632, "name_02632"),
+    ENTRY( 2633, "name_02633"),
+    ENTRY( 2634, "name_02634"),
+    ENTRY( 2635, "name_02635"),
+    ENTRY( 2636, "name_02636"),
+    ENTRY( 2637, "name_02637"),
+    ENTRY( 2638, "name_02638"),
+    ENTRY( 2639, "name_02639"),
+    ENTRY( 2640, "name_02640"),
+    ENTRY( 2641, "name_02641"),
+    ENTRY( 2642, "name_02642"),
+    ENTRY( 2643, "name_02643"),
+    ENTRY( 2644, "name_02644"),
+    ENTRY( 2645, "name_02645"),
+    ENTRY( 2646, "name_02646"),
+    ENTRY( 2647, "name_02647"),
+    ENTRY( 2648, "name_02648"),
+    ENTRY( 2649, "name_02649"),
+    ENTRY( 2650, "name_02650"),
+    ENTRY( 2651, "name_02651"),
+    ENTRY( 2652, "name_02652"),
+    ENTRY( 2653, "name_02653"),
+    ENTRY( 2654, "name_02654"),
+    ENTRY( 2655, "name_02655"),
+    ENTRY( 2656, "name_02656"),
+    ENTRY( 2657, "name_02657"),
+    ENTRY( 2658, "name_02658"),
+    ENTRY( 2659, "name_02659"),
+    ENTRY( 2660, "name_02660"),
+    ENTRY( 2661, "name_02661"),
+    ENTRY( 2662, "name_02662"),
+    ENTRY( 2663, "name_02663"),
+    ENTRY( 2664, "name_02664"),
+    ENTRY( 2665, "name_02665"),
+    ENTRY( 2666, "name_02666"),
+    ENTRY( 2667, "name_02667"),
+    ENTRY( 2668, "name_02668"),
+    ENTRY( 2669, "name_02669"),
+    ENTRY( 2670, "name_02670"),
+    ENTRY( 2671, "name_02671"),
+    ENTRY( 2672, "name_02672"),
+    ENTRY( 2673, "name_02673"),
+    ENTRY( 2674, "name_02674"),
+    ENTRY( 2675, "name_02675"),
+    ENTRY( 2676, "name_02676"),
+    ENTRY( 2677, "name_02677"),
+    ENTRY( 2678, "name_02678"),
+    ENTRY( 2679, "name_02679"),
+    ENTRY( 2680, "name_02680"),
+    ENTRY( 2681, "name_02681"),
+    ENTRY( 2682, "name_02682"),
+    ENTRY( 2683, "name_02683"),
+    ENTRY( 2684, "name_02684"),
+    ENTRY( 2685, "name_02685"),
+    ENTRY( 2686, "name_02686"),
+    ENTRY( 2687, "name_02687"),
+    ENTRY( 2688, "name_02688"),
+    ENTRY( 2689, "name_02689"),
+    ENTRY( 2690, "name_02690"),
+    ENTRY( 2691, "name_02691"),
+    ENTRY( 2692, "name_02692"),
+    ENTRY( 2693, "name_02693"),
+    ENTRY( 2694, "name_02694"),
+    ENTRY( 2695, "name_02695"),
+    ENTRY( 2696, "name_02696"),
+    ENTRY( 2697, "name_02697"),
+    ENTRY( 2698, "name_02698"),
+    ENTRY( 2699, "name_02699"),
+    ENTRY( 2700, "name_02700"),
+    ENTRY( 2701, "name_02701"),
+    ENTRY( 2702, "name_02702"),
+    ENTRY( 2703, "name_02703"),
+    ENTRY( 2704, "name_02704"),
+    ENTRY( 2705, "name_02705"),
+    ENTRY( 2706, "name_02706"),
+    ENTRY( 2707, "name_02707"),
+    ENTRY( 2708, "name_02708"),
+    ENTRY( 2709, "name_02709"),
+    ENTRY( 2710, "name_02710"),
+    ENTRY( 2711, "name_02711"),
+    ENTRY( 2712, "name_02712"),
+    ENTRY( 2713, "name_02713"),
+    ENTRY( 2714, "name_02714"),
+    ENTRY( 2715, "name_02715"),
+    ENTRY( 2716, "name_02716"),
+    ENTRY( 2717, "name_02717"),
+    ENTRY( 2718, "name_02718"),
+    ENTRY( 2719, "name_02719"),
+    ENTRY( 2720, "name_02720"),
+    ENTRY( 2721, "name_02721"),
+    ENTRY( 2722, "name_02722"),
+    ENTRY( 2723, "name_02723"),
+    ENTRY( 2724, "name_02724"),
+    ENTRY( 2725, "name_02725"),
+    ENTRY( 2726, "name_02726"),
+    ENTRY( 2727, "name_02727"),
+    ENTRY( 2728, "name_02728"),
+    ENTRY( 2729, "name_02729"),
+    ENTRY( 2730, "name_02730"),
+    ENTRY( 2731, "name_02731"),
+    ENTRY( 2732, "name_02732"),
+    ENTRY( 2733, "name_02733"),
+    ENTRY( 2734, "name_02734"),
+    ENTRY( 2735, "name_02735"),
+    ENTRY( 2736, "name_02736"),
+    ENTRY( 2737, "name_02737"),
+    ENTRY( 2738, "name_02738"),
+    ENTRY( 2739, "name_02739"),
+    ENTRY( 2740, "name_02740"),
+    ENTRY( 2741, "name_02741"),
+    ENTRY( 2742, "name_02742"),
+    ENTRY( 2743, "name_02743"),
+    ENTRY( 2744, "name_02744"),
+    ENTRY( 2745, "name_02745"),
+    ENTRY( 2746, "name_02746"),
+    ENTRY( 2747, "name_02747"),
+    ENTRY( 2748, "name_02748"),
+    ENTRY( 2749, "name_02749"),
+    ENTRY( 2750, "name_02750"),
+    ENTRY( 2751, "name_02751"),
+    ENTRY( 2752, "name_02752"),
+    ENTRY( 2753, "name_02753"),
+    ENTRY( 2754, "name_02754"),
+    ENTRY( 2755, "name_02755"),
+    ENTRY( 2756, "name_02756"),
+    ENTRY( 2757, "name_02757"),
+    ENTRY( 2758, "name_02758"),
+    ENTRY( 2759, "name_02759"),
+    ENTRY( 2760, "name_02760"),
+    ENTRY( 2761, "name_02761"),
+    ENTRY( 2762, "name_02762"),
+    ENTRY( 2763, "name_02763"),
+    ENTRY( 2764, "name_02764"),
+    ENTRY( 2765, "name_02765"),
+    ENTRY( 2766, "name_02766"),
+    ENTRY( 2767, "name_02767"),
+    ENTRY( 2768, "name_02768"),
+    ENTRY( 2769, "name_02769"),
+    ENTRY( 2770, "name_02770"),
+    ENTRY( 2771, "name_02771"),
+    ENTRY( 2772, "name_02772"),
+    ENTRY( 2773, "name_02773"),
+    ENTRY( 2774, "name_02774"),
+    ENTRY( 2775, "name_02775"),
+    ENTRY( 2776, "name_02776"),
+    ENTRY( 2777, "name_02777"),
+    ENTRY( 2778, "name_02778"),
+    ENTRY( 2779, "name_02779"),
+    ENTRY( 2780, "name_02780"),
+    ENTRY( 2781, "name_02781"),
+    ENTRY( 2782, "name_02782"),
+    ENTRY( 2783, "name_02783"),
+    ENTRY( 2784, "name_02784"),
+    ENTRY( 2785, "name_02785"),
+    ENTRY( 2786, "name_02786"),
+    ENTRY( 2787, "name_02787"),
+    ENTRY( 2788, "name_02788"),
+    ENTRY( 2789, "name_02789"),
+    ENTRY( 2790, "name_02790"),
+    ENTRY( 2791, "name_02791"),
+    ENTRY( 2792, "name_02792"),
+    ENTRY( 2793, "name_02793"),
+    ENTRY( 2794, "name_02794"),
+    ENTRY( 2795, "name_02795"),
+    ENTRY( 2796, "name_02796"),
+    ENTRY( 2797, "name_02797"),
+    ENTRY( 2798, "name_02798"),
+    ENTRY( 2799, "name_02799"),
+    ENTRY( 2800, "name_02800"),
+    ENTRY( 2801, "name_02801"),
+    ENTRY( 2802, "name_02802"),
+    ENTRY( 2803, "name_02803"),
+    ENTRY( 2804, "name_02804"),
+    ENTRY( 2805, "name_02805"),
+    ENTRY( 2806, "name_02806"),
+    ENTRY( 2807, "name_02807"),
+    ENTRY( 2808, "name_02808"),
+    ENTRY( 2809, "name_02809"),
+    ENTRY( 2810, "name_02810"),
+    ENTRY( 2811, "name_02811"),
+    ENTRY( 2812, "name_02812"),
+    ENTRY( 2813, "name_02813"),
+    ENTRY( 2814, "name_02814"),
+    ENTRY( 2815, "name_02815"),
+    ENTRY( 2816, "name_02816"),
+    ENTRY( 2817, "name_02817"),
+    ENTRY( 2818, "name_02818"),
+    ENTRY( 2819, "name_02819"),
+    ENTRY( 2820, "name_02820"),
+    ENTRY( 2821, "name_02821"),
+    ENTRY( 2822, "name_02822"),
+    ENTRY( 2823, "name_02823"),
+    ENTRY( 2824, "name_02824"),
+    ENTRY( 2825, "name_02825"),
+    ENTRY( 2826, "name_02826"),
+    ENTRY( 2827, "name_02827"),
+    ENTRY( 2828, "name_02828"),
+    ENTRY( 2829, "name_02829"),
+    ENTRY( 2830, "name_02830"),
+    ENTRY( 2831, "name_02831"),
+    ENTRY( 2832, "name_02832"),
+    ENTRY( 2833, "name_02833"),
+    ENTRY( 2834, "name_02834"),
+    ENTRY( 2835, "name_02835"),
+    ENTRY( 2836, "name_02836"),
+    ENTRY( 2837, "name_02837"),
+    ENTRY( 2838, "name_02838"),
+    ENTRY( 2839, "name_02839"),
+    ENTRY( 2840, "name_02840"),
+    ENTRY( 2841, "name_02841"),
+    ENTRY( 2842, "name_02842"),
+    ENTRY( 2843, "name_02843"),
+    ENTRY( 2844, "name_02844"),
+    ENTRY( 2845, "name_02845"),
+    ENTRY( 2846, "name_02846"),
+    ENTRY( 2847, "name_02847"),
+    ENTRY( 2848, "name_02848"),
+    ENTRY( 2849, "name_02849"),
+    ENTRY( 2850, "name_02850"),
+    ENTRY( 2851, "name_02851"),
+    ENTRY( 2852, "name_02852"),
+    ENTRY( 2853, "name_02853"),
+    ENTRY( 2854, "name_02854"),
+    ENTRY( 2855, "name_02855"),
+    ENTRY( 2856, "name_02856"),
+    ENTRY( 2857, "name_02857"),
+    ENTRY( 2858, "name_02858"),
+    ENTRY( 2859, "name_02859"),
+    ENTRY( 2860, "name_02860"),
+    ENTRY( 2861, "name_02861"),
+    ENTRY( 2862, "name_02862"),
+    ENTRY( 2863, "name_02863"),
+    ENTRY( 2864, "name_02864"),
+    ENTRY( 2865, "name_02865"),
+    ENTRY( 2866, "name_02866"),
+    ENTRY( 2867, "name_02867"),
+    ENTRY( 2868, "name_02868"),
+    ENTRY( 2869, "name_02869"),
+    ENTRY( 2870, "name_02870"),
+    ENTRY( 2871, "name_02871"),
+    ENTRY( 2872, "name_02872"),
+    ENTRY( 2873, "name_02873"),
+    ENTRY( 2874, "name_02874"),
+    ENTRY( 2875, "name_02875"),
+    ENTRY( 2876, "name_02876"),
+    ENTRY( 2877, "name_02877"),
+    ENTRY( 2878, "name_02878"),
+    ENTRY( 2879, "name_02879"),
+    ENTRY( 2880, "name_02880"),
+    ENTRY( 2881, "name_02881"),
+    ENTRY( 2882, "name_02882"),
+    ENTRY( 2883, "name_02883"),
+    ENTRY( 2884, "name_02884"),
+    ENTRY( 2885, "name_02885"),
+    ENTRY( 2886, "name_02886"),
+    ENTRY( 2887, "name_02887"),
+    ENTRY( 2888, "name_02888"),
+    ENTRY( 2889, "name_02889"),
+    ENTRY( 2890, "name_02890"),
+    ENTRY( 2891, "name_02891"),
+    ENTRY( 2892, "name_02892"),
+    ENTRY( 2893, "name_02893"),
+    ENTRY( 2894, "name_02894"),
+    ENTRY( 2895, "name_02895"),
+    ENTRY( 2896, "name_02896"),
+    ENTRY( 2897, "name_02897"),
+    ENTRY( 2898, "name_02898"),
+    ENTRY( 2899, "name_02899"),
+    ENTRY( 2900, "name_02900"),
+    ENTRY( 2901, "name_02901"),
+    ENTRY( 2902, "name_02902"),
+    ENTRY( 2903, "name_02903"),
+    ENTRY( 2904, "name_02904"),
+    ENTRY( 2905, "name_02905"),
+    ENTRY( 2906, "name_02906"),
+    ENTRY( 2907, "name_02907"),
+    ENTRY( 2908, "name_02908"),
+    ENTRY( 2909, "name_02909"),
+    ENTRY( 2910, "name_02910"),
+    ENTRY( 2911, "name_02911"),
+    ENTRY( 2912, "name_02912"),
+    ENTRY( 2913, "name_02913"),
+    ENTRY( 2914, "name_02914"),
+    ENTRY( 2915, "name_02915"),
+    ENTRY( 2916, "name_02916"),
+    ENTRY( 2917, "name_02917"),
+    ENTRY( 2918, "name_02918"),
+    ENTRY( 2919, "name_02919"),
+    ENTRY( 2920, "name_02920"),
+    ENTRY( 2921, "name_02921"),
+    ENTRY( 2922, "name_02922"),
+    ENTRY( 2923, "name_02923"),
+    ENTRY( 2924, "name_02924"),
+    ENTRY( 2925, "name_02925"),
+    ENTRY( 2926, "name_02926"),
+    ENTRY( 2927, "name_02927"),
+    ENTRY( 2928, "name_02928"),
+    ENTRY( 2929, "name_02929"),
+    ENTRY( 2930, "name_02930"),
+    ENTRY( 2931, "name_02931"),
+    ENTRY( 2932, "name_02932"),
+    ENTRY( 2933, "name_02933"),
+    ENTRY( 2934, "name_02934"),
+    ENTRY( 2935, "name_02935"),
+    ENTRY( 2936, "name_02936"),
+    ENTRY( 2937, "name_02937"),
+    ENTRY( 2938, "name_02938"),
+    ENTRY( 2939, "name_02939"),
+    ENTRY( 2940, "name_02940"),
+    ENTRY( 2941, "name_02941"),
+    ENTRY( 2942, "name_02942"),
+    ENTRY( 2943, "name_02943"),
+    ENTRY( 2944, "name_02944"),
+    ENTRY( 2945, "name_02945"),
+    ENTRY( 2946, "name_02946"),
+    ENTRY( 2947, "name_02947"),
+    ENTRY( 2948, "name_02948"),
+    ENTRY( 2949, "name_02949"),
+    ENTRY( 2950, "name_02950"),
+    ENTRY( 2951, "name_02951"),
+    ENTRY( 2952, "name_02952"),
+    ENTRY( 2953, "name_02953"),
+    ENTRY( 2954, "name_02954"),
+    ENTRY( 2955, "name_02955"),
+    ENTRY( 2956, "name_02956"),
+    ENTRY( 2957, "name_02957"),
+    ENTRY( 2958, "name_02958"),
+    ENTRY( 2959, "name_02959"),
+    ENTRY( 2960, "name_02960"),
+    ENTRY( 2961, "name_02961"),
+    ENTRY( 2962, "name_02962"),
+    ENTRY( 2963, "name_02963"),
+    ENTRY( 2964, "name_02964"),
+    ENTRY( 2965, "name_02965"),
+    ENTRY( 2966, "name_02966"),
+    ENTRY( 2967, "name_02967"),
+    ENTRY( 2968, "name_02968"),
+    ENTRY( 2969, "name_02969"),
+    ENTRY( 2970, "name_02970"),
+    ENTRY( 2971, "name_02971"),
+    ENTRY( 2972, "name_02972"),
+    ENTRY( 2973, "name_02973"),
+    ENTRY( 2974, "name_02974"),
+    ENTRY( 2975, "name_02975"),
+    ENTRY( 2976, "name_02976"),
+    ENTRY( 2977, "name_02977"),
+    ENTRY( 2978, "name_02978"),
+    ENTRY( 2979, "name_02979"),
+    ENTRY( 2980, "name_02980"),
+    ENTRY( 2981, "name_02981"),
+    ENTRY( 2982, "name_02982"),
+    ENTRY( 2983, "name_02983"),
+    ENTRY( 2984, "name_02984"),
+    ENTRY( 2985, "name_02985"),
+    ENTRY( 2986, "name_02986"),
+    ENTRY( 2987, "name_02987"),
+    ENTRY( 2988, "name_02988"),
+    ENTRY( 2989, "name_02989"),
+    ENTRY( 2990, "name_02990"),
+    ENTRY( 2991, "name_02991"),
+    ENTRY( 2992, "name_02992"),
+    ENTRY( 2993, "name_02993"),
+    ENTRY( 2994, "name_02994"),
+    ENTRY( 2995, "name_02995"),
+    ENTRY( 2996, "name_02996"),
+    ENTRY( 2997, "name_02997"),
+    ENTRY( 2998, "name_02998"),
+    ENTRY( 2999, "name_02999"),
+    ENTRY( 3000, "name_03000"),
+    ENTRY( 3001, "name_03001"),
+    ENTRY( 3002, "name_03002"),
+    ENTRY( 3003, "name_03003"),
+    ENTRY( 3004, "name_03004"),
+    ENTRY( 3005, "name_03005"),
+    ENTRY( 3006, "name_03006"),
+    ENTRY( 3007, "name_03007"),
+    ENTRY( 3008, "name_03008"),
+    ENTRY( 3009, "name_03009"),
+    ENTRY( 3010, "name_03010"),
+    ENTRY( 3011, "name_03011"),
+    ENTRY( 3012, "name_03012"),
+    ENTRY( 3013, "name_03013"),
+    ENTRY( 3014, "name_03014"),
+    ENTRY( 3015, "name_03015"),
+    ENTRY( 3016, "name_03016"),
+    ENTRY( 3017, "name_03017"),
+    ENTRY( 3018, "name_03018"),
+    ENTRY( 3019, "name_03019"),
+    ENTRY( 3020, "name_03020"),
+    ENTRY( 3021, "name_03021"),
+    ENTRY( 3022, "name_03022"),
+    ENTRY( 3023, "name_03023"),
+    ENTRY( 3024, "name_03024"),
+    ENTRY( 3025, "name_03025"),
+    ENTRY( 3026, "name_03026"),
+    ENTRY( 3027, "name_03027"),
+    ENTRY( 3028, "name_03028"),
+    ENTRY( 3029, "name_03029"),
+    ENTRY( 3030, "name_03030"),
+    ENTRY( 3031, "name_03031"),
+    ENTRY( 3032, "name_03032"),
+    ENTRY( 3033, "name_03033"),
+    ENTRY( 3034, "name_03034"),
+    ENTRY( 3035, "name_03035"),
+    ENTRY( 3036, "name_03036"),
+    ENTRY( 3037, "name_03037"),
+    ENTRY( 3038, "name_03038"),
+    ENTRY( 3039, "name_03039"),
+    ENTRY( 3040, "name_03040"),
+    ENTRY( 3041, "name_03041"),
+    ENTRY( 3042, "name_03042"),
+    ENTRY( 3043, "name_03043"),
+    ENTRY( 3044, "name_03044"),
+    ENTRY( 3045, "name_03045"),
+    ENTRY( 3046, "name_03046"),
+    ENTRY( 3047, "name_03047"),
+    ENTRY( 3048, "name_03048"),
+    ENTRY( 3049, "name_03049"),
+    ENTRY( 3050, "name_03050"),
+    ENTRY( 3051, "name_03051"),
+    ENTRY( 3052, "name_03052"),
+    ENTRY( 3053, "name_03053"),
+    ENTRY( 3054, "name_03054"),
+    ENTRY( 3055, "name_03055"),
+    ENTRY( 3056, "name_03056"),
+    ENTRY( 3057, "name_03057"),
+    ENTRY( 3058, "name_03058"),
+    ENTRY( 3059, "name_03059"),
+    ENTRY( 3060, "name_03060"),
+    ENTRY( 3061, "name_03061"),
+    ENTRY( 3062, "name_03062"),
+    ENTRY( 3063, "name_03063"),
+    ENTRY( 3064, "name_03064"),
+    ENTRY( 3065, "name_03065"),
+    ENTRY( 3066, "name_03066"),
+    ENTRY( 3067, "name_03067"),
+    ENTRY( 3068, "name_03068"),
+    ENTRY( 3069, "name_03069"),
+    ENTRY( 3070, "name_03070"),
+    ENTRY( 3071, "name_03071"),
+    ENTRY( 3072, "name_03072"),
+    ENTRY( 3073, "name_03073"),
+    ENTRY( 3074, "name_03074"),
+    ENTRY( 3075, "name_03075"),
+    ENTRY( 3076, "name_03076"),
+    ENTRY( 3077, "name_03077"),
+    ENTRY( 3078, "name_03078"),
+    ENTRY( 3079, "name_03079"),
+    ENTRY( 3080, "name_03080"),
+    ENTRY( 3081, "name_03081"),
+    ENTRY( 3082, "name_03082"),
+    ENTRY( 3083, "name_03083"),
+    ENTRY( 3084, "name_03084"),
+    ENTRY( 3085, "name_03085"),
+    ENTRY( 3086, "name_03086"),
+    ENTRY( 3087, "name_03087"),
+    ENTRY( 3088, "name_03088"),
+    ENTRY( 3089, "name_03089"),
+    ENTRY( 3090, "name_03090"),
+    ENTRY( 3091, "name_03091"),
+    ENTRY( 3092, "name_03092"),
+    ENTRY( 3093, "name_03093"),
+    ENTRY( 3094, "name_03094"),
+    ENTRY( 3095, "name_03095"),
+    ENTRY( 3096, "name_03096"),
+    ENTRY( 3097, "name_03097"),
+    ENTRY( 3098, "name_03098"),
+    ENTRY( 3099, "name_03099"),
+    ENTRY( 3100, "name_03100"),
+    ENTRY( 3101, "name_03101"),
+    ENTRY( 3102, "name_03102"),
+    ENTRY( 3103, "name_03103"),
+    ENTRY( 3104, "name_03104"),
+    ENTRY( 3105, "name_03105"),
+    ENTRY( 3106, "name_03106"),
+    ENTRY( 3107, "name_03107"),
+    ENTRY( 3108, "name_03108"),
+    ENTRY( 3109, "name_03109"),
+    ENTRY( 3110, "name_03110"),
+    ENTRY( 3111, "name_03111"),
+    ENTRY( 3112, "name_03112"),
+    ENTRY( 3113, "name_03113"),
+    ENTRY( 3114, "name_03114"),
+    ENTRY( 3115, "name_03115"),
+    ENTRY( 3116, "name_03116"),
+    ENTRY( 3117, "name_03117"),
+    ENTRY( 3118, "name_03118"),
+    ENTRY( 3119, "name_03119"),
+    ENTRY( 3120, "name_03120"),
+    ENTRY( 3121, "name_03121"),
+    ENTRY( 3122, "name_03122"),
+    ENTRY( 3123, "name_03123"),
+    ENTRY( 3124, "name_03124"),
+    ENTRY( 3125, "name_03125"),
+    ENTRY( 3126, "name_03126"),
+    ENTRY( 3127, "name_03127"),
+    ENTRY( 3128, "name_03128"),
+    ENTRY( 3129, "name_03129"),
+    ENTRY( 3130, "name_03130"),
+    ENTRY( 3131, "name_03131"),
+    ENTRY( 3132, "name_03132"),
+    ENTRY( 3133, "name_03133"),
+    ENTRY( 3134, "name_03134"),
+    ENTRY( 3135, "name_03135"),
+    ENTRY( 3136, "name_03136"),
+    ENTRY( 3137, "name_03137"),
+    ENTRY( 3138, "name_03138"),
+    ENTRY( 3139, "name_03139"),
+    ENTRY( 3140, "name_03140"),
+    ENTRY( 3141, "name_03141"),
+    ENTRY( 3142, "name_03142"),
+    ENTRY( 3143, "name_03143"),
+    ENTRY( 3144, "name_03144"),
+    ENTRY( 3145, "name_03145"),
+    ENTRY( 3146, "name_03146"),
+    ENTRY( 3147, "name_03147"),
+    ENTRY( 3148, "name_03148"),
+    ENTRY( 3149, "name_03149"),
+    ENTRY( 3150, "name_03150"),
+    ENTRY( 3151, "name_03151"),
+    ENTRY( 3152, "name_03152"),
+    ENTRY( 3153, "name_03153"),
+    ENTRY( 3154, "name_03154"),
+    ENTRY( 3155, "name_03155"),
+    ENTRY( 3156, "name_03156"),
+    ENTRY( 3157, "name_03157"),
+    ENTRY( 3158, "name_03158"),
+    ENTRY( 3159, "name_03159"),
+    ENTRY( 3160, "name_03160"),
+    ENTRY( 3161, "name_03161"),
+    ENTRY( 3162, "name_03162"),
+    ENTRY( 3163, "name_03163"),
+    ENTRY( 3164, "name_03164"),
+    ENTRY( 3165, "name_03165"),
+    ENTRY( 3166, "name_03166"),
+    ENTRY( 3167, "name_03167"),
+    ENTRY( 3168, "name_03168"),
+    ENTRY( 3169, "name_03169"),
+    ENTRY( 3170, "name_03170"),
+    ENTRY( 3171, "name_03171"),
+    ENTRY( 3172, "name_03172"),
+    ENTRY( 3173, "name_03173"),
+    ENTRY( 3174, "name_03174"),
+    ENTRY( 3175, "name_03175"),
+    ENTRY( 3176, "name_03176"),
+    ENTRY( 3177, "name_03177"),
+    ENTRY( 3178, "name_03178"),
+    ENTRY( 3179, "name_03179"),
+    ENTRY( 3180, "name_03180"),
+    ENTRY( 3181, "name_03181"),
+    ENTRY( 3182, "name_03182"),
+    ENTRY( 3183, "name_03183"),
+    ENTRY( 3184, "name_03184"),
+    ENTRY( 3185, "name_03185"),
+    ENTRY( 3186, "name_03186"),
+    ENTRY( 3187, "name_03187"),
+    ENTRY( 3188, "name_03188"),
+    ENTRY( 3189, "name_03189"),
+    ENTRY( 3190, "name_03190"),
+    ENTRY( 3191, "name_03191"),
+    ENTRY( 3192, "name_03192"),
+    ENTRY( 3193, "name_03193"),
+    ENTRY( 3194, "name_03194"),
+    ENTRY( 3195, "name_03195"),
+    ENTRY( 3196, "name_03196"),
+    ENTRY( 3197, "name_03197"),
+    ENTRY( 3198, "name_03198"),
+    ENTRY( 3199, "name_03199"),
+    ENTRY( 3200, "name_03200"),
+    ENTRY( 3201, "name_03201"),
+    ENTRY( 3202, "name_03202"),
+    ENTRY( 3203, "name_03203"),
+    ENTRY( 3204, "name_03204"),
+    ENTRY( 3205, "name_03205"),
+    ENTRY( 3206, "name_03206"),
+    ENTRY( 3207, "name_03207"),
+    ENTRY( 3208, "name_03208"),
+    ENTRY( 3209, "name_03209"),
+    ENTRY( 3210, "name_03210"),
+    ENTRY( 3211, "name_03211"),
+    ENTRY( 3212, "name_03212"),
+    ENTRY( 3213, "name_03213"),
+    ENTRY( 3214, "name_03214"),
+    ENTRY( 3215, "name_03215"),
+    ENTRY( 3216, "name_03216"),
+    ENTRY( 3217, "name_03217"),
+    ENTRY( 3218, "name_03218"),
+    ENTRY( 3219, "name_03219"),
+    ENTRY( 3220, "name_03220"),
+    ENTRY( 3221, "name_03221"),
+    ENTRY( 3222, "name_03222"),
+    ENTRY( 3223, "name_03223"),
+    ENTRY( 3224, "name_03224"),
+    ENTRY( 3225, "name_03225"),
+    ENTRY( 3226, "name_03226"),
+    ENTRY( 3227, "name_03227"),
+    ENTRY( 3228, "name_03228"),
+    ENTRY( 3229, "name_03229"),
+    ENTRY( 3230, "name_03230"),
+    ENTRY( 3231, "name_03231"),
+    ENTRY( 3232, "name_03232"),
+    ENTRY( 3233, "name_03233"),
+    ENTRY( 3234, "name_03234"),
+    ENTRY( 3235, "name_03235"),
+    ENTRY( 3236, "name_03236"),
+    ENTRY( 3237, "name_03237"),
+    ENTRY( 3238, "name_03238"),
+    ENTRY( 3239, "name_03239"),
+    ENTRY( 3240, "name_03240"),
+    ENTRY( 3241, "name_03241"),
+    ENTRY( 3242, "name_03242"),
+    ENTRY( 3243, "name_03243"),
+    ENTRY( 3244, "name_03244"),
+    ENTRY( 3245, "name_03245"),
+    ENTRY( 3246, "name_03246"),
+    ENTRY( 3247, "name_03247"),
+    ENTRY( 3248, "name_03248"),
+    ENTRY( 3249, "name_03249"),
+    ENTRY( 3250, "name_03250"),
+    ENTRY( 3251, "name_03251"),
+    ENTRY( 3252, "name_03252"),
+    ENTRY( 3253, "name_03253"),
+    ENTRY( 3254, "name_03254"),
+    ENTRY( 3255, "name_03255"),
+    ENTRY( 3256, "name_03256"),
+    ENTRY( 3257, "name_03257"),
+    ENTRY( 3258, "name_03258"),
+    ENTRY( 3259, "name_03259"),
+    ENTRY( 3260, "name_03260"),
+    ENTRY( 3261, "name_03261"),
+    ENTRY( 3262, "name_03262"),
+    ENTRY( 3263, "name_03263"),
+    ENTRY( 3264, "name_03264"),
+    ENTRY( 3265, "name_03265"),
+    ENTRY( 3266, "name_03266"),
+    ENTRY( 3267, "name_03267"),
+    ENTRY( 3268, "name_03268"),
+    ENTRY( 3269, "name_03269"),
+    ENTRY( 3270, "name_03270"),
+    ENTRY( 3271, "name_03271"),
+    ENTRY( 3272, "name_03272"),
+    ENTRY( 3273, "name_03273"),
+    ENTRY( 3274, "name_03274"),
+    ENTRY( 3275, "name_03275"),
+    ENTRY( 3276, "name_03276"),
+    ENTRY( 3277, "name_03277"),
+    ENTRY( 3278, "name_03278"),
+    ENTRY( 3279, "name_03279"),
+    ENTRY( 3280, "name_03280"),
+    ENTRY( 3281, "name_03281"),
+    ENTRY( 3282, "name_03282"),
+    ENTRY( 3283, "name_03283"),
+    ENTRY( 3284, "name_03284"),
+    ENTRY( 3285, "name_03285"),
+    ENTRY( 3286, "name_03286"),
+    ENTRY( 3287, "name_03287"),
+    ENTRY( 3288, "name_03288"),
+    ENTRY( 3289, "name_03289"),
+    ENTRY( 3290, "name_03290"),
+    ENTRY( 3291, "name_03291"),
+    ENTRY( 3292, "name_03292"),
+    ENTRY( 3293, "name_03293"),
+    ENTRY( 3294, "name_03294"),
+    ENTRY( 3295, "name_03295"),
+    ENTRY( 3296, "name_03296"),
+    ENTRY( 3297, "name_03297"),
+    ENTRY( 3298, "name_03298"),
+    ENTRY( 3299, "name_03299"),
+    ENTRY( 3300, "name_03300"),
+    ENTRY( 3301, "name_03301"),
+    ENTRY( 3302, "name_03302"),
+    ENTRY( 3303, "name_03303"),
+    ENTRY( 3304, "name_03304"),
+    ENTRY( 3305, "name_03305"),
+    ENTRY( 3306, "name_03306"),
+    ENTRY( 3307, "name_03307"),
+    ENTRY( 3308, "name_03308"),
+    ENTRY( 3309, "name_03309"),
+    ENTRY( 3310, "name_03310"),
+    ENTRY( 3311, "name_03311"),
+    ENTRY( 3312, "name_03312"),
+    ENTRY( 3313, "name_03313"),
+    ENTRY( 3314, "name_03314"),
+    ENTRY( 3315, "name_03315"),
+    ENTRY( 3316, "name_03316"),
+    ENTRY( 3317, "name_03317"),
+    ENTRY( 3318, "name_03318"),
+    ENTRY( 3319, "name_03319"),
+    ENTRY( 3320, "name_03320"),
+    ENTRY( 3321, "name_03321"),
+    ENTRY( 3322, "name_03322"),
+    ENTRY( 3323, "name_03323"),
+    ENTRY( 3324, "name_03324"),
+    ENTRY( 3325, "name_03325"),
+    ENTRY( 3326, "name_03326"),
+    ENTRY( 3327, "name_03327"),
+    ENTRY( 3328, "name_03328"),
+    ENTRY( 3329, "name_03329"),
+    ENTRY( 3330, "name_03330"),
+    ENTRY( 3331, "name_03331"),
+    ENTRY( 3332, "name_03332"),
+    ENTRY( 3333, "name_03333"),
+    ENTRY( 3334, "name_03334"),
+    ENTRY( 3335, "name_03335"),
+    ENTRY( 3336, "name_03336"),
+    ENTRY( 3337, "name_03337"),
+    ENTRY( 3338, "name_03338"),
+    ENTRY( 3339, "name_03339"),
+    ENTRY( 3340, "name_03340"),
+    ENTRY( 3341, "name_03341"),
+    ENTRY( 3342, "name_03342"),
+    ENTRY( 3343, "name_03343"),
+    ENTRY( 3344, "name_03344"),
+    ENTRY( 3345, "name_03345"),
+    ENTRY( 3346, "name_03346"),
+    ENTRY( 3347, "name_03347"),
+    ENTRY( 3348, "name_03348"),
+    ENTRY( 3349, "name_03349"),
+    ENTRY( 3350, "name_03350"),
+    ENTRY( 3351, "name_03351"),
+    ENTRY( 3352, "name_03352"),
+    ENTRY( 3353, "name_03353"),
+    ENTRY( 3354, "name_03354"),
+    ENTRY( 3355, "name_03355"),
+    ENTRY( 3356, "name_03356"),
+    ENTRY( 3357, "name_03357"),
+    ENTRY( 3358, "name_03358"),
+    ENTRY( 3359, "name_03359"),
+    ENTRY( 3360, "name_03360"),
+    ENTRY( 3361, "name_03361"),
+    ENTRY( 3362, "name_03362"),
+    ENTRY( 3363, "name_03363"),
+    ENTRY( 3364, "name_03364"),
+    ENTRY( 3365, "name_03365"),
+    ENTRY( 3366, "name_03366"),
+    ENTRY( 3367, "name_03367"),
+    ENTRY( 3368, "name_03368"),
+    ENTRY( 3369, "name_03369"),
+    ENTRY( 3370, "name_03370"),
+    ENTRY( 3371, "name_03371"),
+    ENTRY( 3372, "name_03372"),
+    ENTRY( 3373, "name_03373"),
+    ENTRY( 3374, "name_03374"),
+    ENTRY( 3375, "name_03375"),
+    ENTRY( 3376, "name_03376"),
+    ENTRY( 3377, "name_03377"),
+    ENTRY( 3378, "name_03378"),
+    ENTRY( 3379, "name_03379"),
+    ENTRY( 3380, "name_03380"),
+    ENTRY( 3381, "name_03381"),
+    ENTRY( 3382, "name_03382"),
+    ENTRY( 3383, "name_03383"),
+    ENTRY( 3384, "name_03384"),
+    ENTRY( 3385, "name_03385"),
+    ENTRY( 3386, "name_03386"),
+    ENTRY( 3387, "name_03387"),
+    ENTRY( 3388, "name_03388"),
+    ENTRY( 3389, "name_03389"),
+    ENTRY( 3390, "name_03390"),
+    ENTRY( 3391, "name_03391"),
+    ENTRY( 3392, "name_03392"),
+    ENTRY( 3393, "name_03393"),
+    ENTRY( 3394, "name_03394"),
+    ENTRY( 3395, "name_03395"),
+    ENTRY( 3396, "name_03396"),
+    ENTRY( 3397, "name_03397"),
+    ENTRY( 3398, "name_03398"),
+    ENTRY( 3399, "name_03399"),
+    ENTRY( 3400, "name_03400"),
+    ENTRY( 3401, "name_03401"),
+    ENTRY( 3402, "name_03402"),
+    ENTRY( 3403, "name_03403"),
+    ENTRY( 3404, "name_03404"),
+    ENTRY( 3405, "name_03405"),
+    ENTRY( 3406, "name_03406"),
+    ENTRY( 3407, "name_03407"),
+    ENTRY( 3408, "name_03408"),
+    ENTRY( 3409, "name_03409"),
+    ENTRY( 3410, "name_03410"),
+    ENTRY( 3411, "name_03411"),
+    ENTRY( 3412, "name_03412"),
+    ENTRY( 3413, "name_03413"),
+    ENTRY( 3414, "name_03414"),
+    ENTRY( 3415, "name_03415"),
+    ENTRY( 3416, "name_03416"),
+    ENTRY( 3417, "name_03417"),
+    ENTRY( 3418, "name_03418"),
+    ENTRY( 3419, "name_03419"),
+    ENTRY( 3420, "name_03420"),
+    ENTRY( 3421, "name_03421"),
+    ENTRY( 3422, "name_03422"),
+    ENTRY( 3423, "name_03423"),
+    ENTRY( 3424, "name_03424"),
+    ENTRY( 3425, "name_03425"),
+    ENTRY( 3426, "name_03426"),
+    ENTRY( 3427, "name_03427"),
+    ENTRY( 3428, "name_03428"),
+    ENTRY( 3429, "name_03429"),
+    ENTRY( 3430, "name_03430"),
+    ENTRY( 3431, "name_03431"),
+    ENTRY( 3432, "name_03432"),
+    ENTRY( 3433, "name_03433"),
+    ENTRY( 3434, "name_03434"),
+    ENTRY( 3435, "name_03435"),
+    ENTRY( 3436, "name_03436"),
+    ENTRY( 3437, "name_03437"),
+    ENTRY( 3438, "name_03438"),
+    ENTRY( 3439, "name_03439"),
+    ENTRY( 3440, "name_03440"),
+    ENTRY( 3441, "name_03441"),
+    ENTRY( 3442, "name_03442"),
+    ENTRY( 3443, "name_03443"),
+    ENTRY( 3444, "name_03444"),
+    ENTRY( 3445, "name_03445"),
+    ENTRY( 3446, "name_03446"),
+    ENTRY( 3447, "name_03447"),
+    ENTRY( 3448, "name_03448"),
+    ENTRY( 3449, "name_03449"),
+    ENTRY( 3450, "name_03450"),
+    ENTRY( 3451, "name_03451"),
+    ENTRY( 3452, "name_03452"),
+    ENTRY( 3453, "name_03453"),
+    ENTRY( 3454, "name_03454"),
+    ENTRY( 3455, "name_03455"),
+    ENTRY( 3456, "name_03456"),
+    ENTRY( 3457, "name_03457"),
+    ENTRY( 3458, "name_03458"),
+    ENTRY( 3459, "name_03459"),
+    ENTRY( 3460, "name_03460"),
+    ENTRY( 3461, "name_03461"),
+    ENTRY( 3462, "name_03462"),
+    ENTRY( 3463, "name_03463"),
+    ENTRY( 3464, "name_03464"),
+    ENTRY( 3465, "name_03465"),
+    ENTRY( 3466, "name_03466"),
+    ENTRY( 3467, "name_03467"),
+    ENTRY( 3468, "name_03468"),
+    ENTRY( 3469, "name_03469"),
+    ENTRY( 3470, "name_03470"),
+    ENTRY( 3471, "name_03471"),
+    ENTRY( 3472, "name_03472"),
+    ENTRY( 3473, "name_03473"),
+    ENTRY( 3474, "name_03474"),
+    ENTRY( 3475, "name_03475"),
+    ENTRY( 3476, "name_03476"),
+    ENTRY( 3477, "name_03477"),
+    ENTRY( 3478, "name_03478"),
+    ENTRY( 3479, "name_03479"),
+    ENTRY( 3480, "name_03480"),
+    ENTRY( 3481, "name_03481"),
+    ENTRY( 3482, "name_03482"),
+    ENTRY( 3483, "name_03483"),
+    ENTRY( 3484, "name_03484"),
+    ENTRY( 3485, "name_03485"),
+    ENTRY( 3486, "name_03486"),
+    ENTRY( 3487, "name_03487"),
+    ENTRY( 3488, "name_03488"),
+    ENTRY( 3489, "name_03489"),
+    ENTRY( 3490, "name_03490"),
+    ENTRY( 3491, "name_03491"),
+    ENTRY( 3492, "name_03492"),
+    ENTRY( 3493, "name_03493"),
+    ENTRY( 3494, "name_03494"),
+    ENTRY( 3495, "name_03495"),
+    ENTRY( 3496, "name_03496"),
+    ENTRY( 3497, "name_03497"),
+    ENTRY( 3498, "name_03498"),
+    ENTRY( 3499, "name_03499"),
+    ENTRY( 3500, "name_03500"),
+    ENTRY( 3501, "name_03501"),
+    ENTRY( 3502, "name_03502"),
+    ENTRY( 3503, "name_03503"),
+    ENTRY( 3504, "name_03504"),
+    ENTRY( 3505, "name_03505"),
+    ENTRY( 3506, "name_03506"),
+    ENTRY( 3507, "name_03507"),
+    ENTRY( 3508, "name_03508"),
+    ENTRY( 3509, "name_03509"),
+    ENTRY( 3510, "name_03510"),
+    ENTRY( 3511, "name_03511"),
+    ENTRY( 3512, "name_03512"),
+    ENTRY( 3513, "name_03513"),
+    ENTRY( 3514, "name_03514"),
+    ENTRY( 3515, "name_03515"),
+    ENTRY( 3516, "name_03516"),
+    ENTRY( 3517, "name_03517"),
+    ENTRY( 3518, "name_03518"),
+    ENTRY( 3519, "name_03519"),
+    ENTRY( 3520, "name_03520"),
+    ENTRY( 3521, "name_03521"),
+    ENTRY( 3522, "name_03522"),
+    ENTRY( 3523, "name_03523"),
+    ENTRY( 3524, "name_03524"),
+    ENTRY( 3525, "name_03525"),
+    ENTRY( 3526, "name_03526"),
+    ENTRY( 3527, "name_03527"),
+    ENTRY( 3528, "name_03528"),
+    ENTRY( 3529, "name_03529"),
+    ENTRY( 3530, "name_03530"),
+    ENTRY( 3531, "name_03531"),
+    ENTRY( 3532, "name_03532"),
+    ENTRY( 3533, "name_03533"),
+    ENTRY( 3534, "name_03534"),
+    ENTRY( 3535, "name_03535"),
+    ENTRY( 3536, "name_03536"),
+    ENTRY( 3537, "name_03537"),
+    ENTRY( 3538, "name_03538"),
+    ENTRY( 3539, "name_03539"),
+    ENTRY( 3540, "name_03540"),
+    ENTRY( 3541, "name_03541"),
+    ENTRY( 3542, "name_03542"),
+    ENTRY( 3543, "name_03543"),
+    ENTRY( 3544, "name_03544"),
+    ENTRY( 3545, "name_03545"),
+    ENTRY( 3546, "name_03546"),
+    ENTRY( 3547, "name_03547"),
+    ENTRY( 3548, "name_03548"),
+    ENTRY( 3549, "name_03549"),
+    ENTRY( 3550, "name_03550"),
+    ENTRY( 3551, "name_03551"),
+    ENTRY( 3552, "name_03552"),
+    ENTRY( 3553, "name_03553"),
+    ENTRY( 3554, "name_03554"),
+    ENTRY( 3555, "name_03555"),
+    ENTRY( 3556, "name_03556"),
+    ENTRY( 3557, "name_03557"),
+    ENTRY( 3558, "name_03558"),
+    ENTRY( 3559, "name_03559"),
+    ENTRY( 3560, "name_03560"),
+    ENTRY( 3561, "name_03561"),
+    ENTRY( 3562, "name_03562"),
+    ENTRY( 3563, "name_03563"),
+    ENTRY( 3564, "name_03564"),
+    ENTRY( 3565, "name_03565"),
+    ENTRY( 3566, "name_03566"),
+    ENTRY( 3567, "name_03567"),
+    ENTRY( 3568, "name_03568"),
+    ENTRY( 3569, "name_03569"),
+    ENTRY( 3570, "name_03570"),
+    ENTRY( 3571, "name_03571"),
+    ENTRY( 3572, "name_03572"),
+    ENTRY( 3573, "name_03573"),
+    ENTRY( 3574, "name_03574"),
+    ENTRY( 3575, "name_03575"),
+    ENTRY( 3576, "name_03576"),
+    ENTRY( 3577, "name_03577"),
+    ENTRY( 3578, "name_03578"),
+    ENTRY( 3579, "name_03579"),
+    ENTRY( 3580, "name_03580"),
+    ENTRY( 3581, "name_03581"),
+    ENTRY( 3582, "name_03582"),
+    ENTRY( 3583, "name_03583"),
+    ENTRY( 3584, "name_03584"),
+    ENTRY( 3585, "name_03585"),
+    ENTRY( 3586, "name_03586"),
+    ENTRY( 3587, "name_03587"),
+    ENTRY( 3588, "name_03588"),
+    ENTRY( 3589, "name_03589"),
+    ENTRY( 3590, "name_03590"),
+    ENTRY( 3591, "name_03591"),
+    ENTRY( 3592, "name_03592"),
+    ENTRY( 3593, "name_03593"),
+    ENTRY( 3594, "name_03594"),
+    ENTRY( 3595, "name_03595"),
+    ENTRY( 3596, "name_03596"),
+    ENTRY( 3597, "name_03597"),
+    ENTRY( 3598, "name_03598"),
+    ENTRY( 3599, "name_03599"),
+    ENTRY( 3600, "name_03600"),
+    ENTRY( 3601, "name_03601"),
+    ENTRY( 3602, "name_03602"),
+    ENTRY( 3603, "name_03603"),
+    ENTRY( 3604, "name_03604"),
+    ENTRY( 3605, "name_03605"),
+    ENTRY( 3606, "name_03606"),
+    ENTRY( 3607, "name_03607"),
+    ENTRY( 3608, "name_03608"),
+    ENTRY( 3609, "name_03609"),
+    ENTRY( 3610, "name_03610"),
+    ENTRY( 3611, "name_03611"),
+    ENTRY( 3612, "name_03612"),
+    ENTRY( 3613, "name_03613"),
+    ENTRY( 3614, "name_03614"),
+    ENTRY( 3615, "name_03615"),
+    ENTRY( 3616, "name_03616"),
+    ENTRY( 3617, "name_03617"),
+    ENTRY( 3618, "name_03618"),
+    ENTRY( 3619, "name_03619"),
+    ENTRY( 3620, "name_03620"),
+    ENTRY( 3621, "name_03621"),
+    ENTRY( 3622, "name_03622"),
+    ENTRY( 3623, "name_03623"),
+    ENTRY( 3624, "name_03624"),
+    ENTRY( 3625, "name_03625"),
+    ENTRY( 3626, "name_03626"),
+    ENTRY( 3627, "name_03627"),
+    ENTRY( 3628, "name_03628"),
+    ENTRY( 3629, "name_03629"),
+    ENTRY( 3630, "name_03630"),
+    ENTRY( 3631, "name_03631"),
+    ENTRY( 3632, "name_03632"),
+    ENTRY( 3633, "name_03633"),
+    ENTRY( 3634, "name_03634"),
+    ENTRY( 3635, "name_03635"),
+    ENTRY( 3636, "name_03636"),
+    ENTRY( 3637, "name_03637"),
+    ENTRY( 3638, "name_03638"),
+    ENTRY( 3639, "name_03639"),
+    ENTRY( 3640, "name_03640"),
+    ENTRY( 3641, "name_03641"),
+    ENTRY( 3642, "name_03642"),
+    ENTRY( 3643, "name_03643"),
+    ENTRY( 3644, "name_03644"),
+    ENTRY( 3645, "name_03645"),
+    ENTRY( 3646, "name_03646"),
+    ENTRY( 3647, "name_03647"),
+    ENTRY( 3648, "name_03648"),
+    ENTRY( 3649, "name_03649"),
+    ENTRY( 3650, "name_03650"),
+    ENTRY( 3651, "name_03651"),
+    ENTRY( 3652, "name_03652"),
+    ENTRY( 3653, "name_03653"),
+    ENTRY( 3654, "name_03654"),
+    ENTRY( 3655, "name_03655"),
+    ENTRY( 3656, "name_03656"),
+    ENTRY( 3657, "name_03657"),
+    ENTRY( 3658, "name_03658"),
+    ENTRY( 3659, "name_03659"),
+    ENTRY( 3660, "name_03660"),
+    ENTRY( 3661, "name_03661"),
+    ENTRY( 3662, "name_03662"),
+    ENTRY( 3663, "name_03663"),
+    ENTRY( 3664, "name_03664"),
+    ENTRY( 3665, "name_03665"),
+    ENTRY( 3666, "name_03666"),
+    ENTRY( 3667, "name_03667"),
+    ENTRY( 3668, "name_03668"),
+    ENTRY( 3669, "name_03669"),
+    ENTRY( 3670, "name_03670"),
+    ENTRY( 3671, "name_03671"),
+    ENTRY( 3672, "name_03672"),
+    ENTRY( 3673, "name_03673"),
+    ENTRY( 3674, "name_03674"),
+    ENTRY( 3675, "name_03675"),
+    ENTRY( 3676, "name_03676"),
+    ENTRY( 3677, "name_03677"),
+    ENTRY( 3678, "name_03678"),
+    ENTRY( 3679, "name_03679"),
+    ENTRY( 3680, "name_03680"),
+    ENTRY( 3681, "name_03681"),
+    ENTRY( 3682, "name_03682"),
+    ENTRY( 3683, "name_03683"),
+    ENTRY( 3684, "name_03684"),
+    ENTRY( 3685, "name_03685"),
+    ENTRY( 3686, "name_03686"),
+    ENTRY( 3687, "name_03687"),
+    ENTRY( 3688, "name_03688"),
+    ENTRY( 3689, "name_03689"),
+    ENTRY( 3690, "name_03690"),
+    ENTRY( 3691, "name_03691"),
+    ENTRY( 3692, "name_03692"),
+    ENTRY( 3693, "name_03693"),
+    ENTRY( 3694, "name_03694"),
+    ENTRY( 3695, "name_03695"),
+    ENTRY( 3696, "name_03696"),
+    ENTRY( 3697, "name_03697"),
+    ENTRY( 3698, "name_03698"),
+    ENTRY( 3699, "name_03699"),
+    ENTRY( 3700, "name_03700"),
+    ENTRY( 3701, "name_03701"),
+    ENTRY( 3702, "name_03702"),
+    ENTRY( 3703, "name_03703"),
+    ENTRY( 3704, "name_03704"),
+    ENTRY( 3705, "name_03705"),
+    ENTRY( 3706, "name_03706"),
+    ENTRY( 3707, "name_03707"),
+    ENTRY( 3708, "name_03708"),
+    ENTRY( 3709, "name_03709"),
+    ENTRY( 3710, "name_03710"),
+    ENTRY( 3711, "name_03711"),
+    ENTRY( 3712, "name_03712"),
+    ENTRY( 3713, "name_03713"),
+    ENTRY( 3714, "name_03714"),
+    ENTRY( 3715, "name_03715"),
+    ENTRY( 3716, "name_03716"),
+    ENTRY( 3717, "name_03717"),
+    ENTRY( 3718, "name_03718"),
+    ENTRY( 3719, "name_03719"),
+    ENTRY( 3720, "name_03720"),
+    ENTRY( 3721, "name_03721"),
+    ENTRY( 3722, "name_03722"),
+    ENTRY( 3723, "name_03723"),
+    ENTRY( 3724, "name_03724"),
+    ENTRY( 3725, "name_03725"),
+    ENTRY( 3726, "name_03726"),
+    ENTRY( 3727, "name_03727"),
+    ENTRY( 3728, "name_03728"),
+    ENTRY( 3729, "name_03729"),
+    ENTRY( 3730, "name_03730"),
+    ENTRY( 3731, "name_03731"),
+    ENTRY( 3732, "name_03732"),
+    ENTRY( 3733, "name_03733"),
+    ENTRY( 3734, "name_03734"),
+    ENTRY( 3735, "name_03735"),
+    ENTRY( 3736, "name_03736"),
+    ENTRY( 3737, "name_03737"),
+    ENTRY( 3738, "name_03738"),
+    ENTRY( 3739, "name_03739"),
+    ENTRY( 3740, "name_03740"),
+    ENTRY( 3741, "name_03741"),
+    ENTRY( 3742, "name_03742"),
+    ENTRY( 3743, "name_03743"),
+    ENTRY( 3744, "name_03744"),
+    ENTRY( 3745, "name_03745"),
+    ENTRY( 3746, "name_03746"),
+    ENTRY( 3747, "name_03747"),
+    ENTRY( 3748, "name_03748"),
+    ENTRY( 3749, "name_03749"),
+    ENTRY( 3750, "name_03750"),
+    ENTRY( 3751, "name_03751"),
+    ENTRY( 3752, "name_03752"),
+    ENTRY( 3753, "name_03753"),
+    ENTRY( 3754, "name_03754"),
+    ENTRY( 3755, "name_03755"),
+    ENTRY( 3756, "name_03756"),
+    ENTRY( 3757, "name_03757"),
+    ENTRY( 3758, "name_03758"),
+    ENTRY( 3759, "name_03759"),
+    ENTRY( 3760, "name_03760"),
+    ENTRY( 3761, "name_03761"),
+    ENTRY( 3762, "name_03762"),
+    ENTRY( 3763, "name_03763"),
+    ENTRY( 3764, "name_03764"),
+    ENTRY( 3765, "name_03765"),
+    ENTRY( 3766, "name_03766"),
+    ENTRY( 3767, "name_03767"),
+    ENTRY( 3768, "name_03768"),
+    ENTRY( 3769, "name_03769"),
+    ENTRY( 3770, "name_03770"),
+    ENTRY( 3771, "name_03771"),
+    ENTRY( 3772, "name_03772"),
+    ENTRY( 3773, "name_03773"),
+    ENTRY( 3774, "name_03774"),
+    ENTRY( 3775, "name_03775"),
+    ENTRY( 3776, "name_03776"),
+    ENTRY( 3777, "name_03777"),
+    ENTRY( 3778, "name_03778"),
+    ENTRY( 3779, "name_03779"),
+    ENTRY( 3780, "name_03780"),
+    ENTRY( 3781, "name_03781"),
+    ENTRY( 3782, "name_03782"),
+    ENTRY( 3783, "name_03783"),
+    ENTRY( 3784, "name_03784"),
+    ENTRY( 3785, "name_03785"),
+    ENTRY( 3786, "name_03786"),
+    ENTRY( 3787, "name_03787"),
+    ENTRY( 3788, "name_03788"),
+    ENTRY( 3789, "name_03789"),
+    ENTRY( 3790, "name_03790"),
+    ENTRY( 3791, "name_03791"),
+    ENTRY( 3792, "name_03792"),
+    ENTRY( 3793, "name_03793"),
+    ENTRY( 3794, "name_03794"),
+    ENTRY( 3795, "name_03795"),
+    ENTRY( 3796, "name_03796"),
+    ENTRY( 3797, "name_03797"),
+    ENTRY( 3798, "name_03798"),
+    ENTRY( 3799, "name_03799"),
+    ENTRY( 3800, "name_03800"),
+    ENTRY( 3801, "name_03801"),
+    ENTRY( 3802, "name_03802"),
+    ENTRY( 3803, "name_03803"),
+    ENTRY( 3804, "name_03804"),
+    ENTRY( 3805, "name_03805"),
+    ENTRY( 3806, "name_03806"),
+    ENTRY( 3807, "name_03807"),
+    ENTRY( 3808, "name_03808"),
+    ENTRY( 3809, "name_03809"),
+    ENTRY( 3810, "name_03810"),
+    ENTRY( 3811, "name_03811"),
+    ENTRY( 3812, "name_03812"),
+    ENTRY( 3813, "name_03813"),
+    ENTRY( 3814, "name_03814"),
+    ENTRY( 3815, "name_03815"),
+    ENTRY( 3816, "name_03816"),
+    ENTRY( 3817, "name_03817"),
+    ENTRY( 3818, "name_03818"),
+    ENTRY( 3819, "name_03819"),
+    ENTRY( 3820, "name_03820"),
+    ENTRY( 3821, "name_03821"),
+    ENTRY( 3822, "name_03822"),
+    ENTRY( 3823, "name_03823"),
+    ENTRY( 3824, "name_03824"),
+    ENTRY( 3825, "name_03825"),
+    ENTRY( 3826, "name_03826"),
+    ENTRY( 3827, "name_03827"),
+    ENTRY( 3828, "name_03828"),
+    ENTRY( 3829, "name_03829"),
+    ENTRY( 3830, "name_03830"),
+    ENTRY( 3831, "name_03831"),
+    ENTRY( 3832, "name_03832"),
+    ENTRY( 3833, "name_03833"),
+    ENTRY( 3834, "name_03834"),
+    ENTRY( 3835, "name_03835"),
+    ENTRY( 3836, "name_03836"),
+    ENTRY( 3837, "name_03837"),
+    ENTRY( 3838, "name_03838"),
+    ENTRY( 3839, "name_03839"),
+    ENTRY( 3840, "name_03840"),
+    ENTRY( 3841, "name_03841"),
+    ENTRY( 3842, "name_03842"),
+    ENTRY( 3843, "name_03843"),
+    ENTRY( 3844, "name_03844"),
+    ENTRY( 3845, "name_03845"),
+    ENTRY( 3846, "name_03846"),
+    ENTRY( 3847, "name_03847"),
+    ENTRY( 3848, "name_03848"),
+    ENTRY( 3849, "name_03849"),
+    ENTRY( 3850, "name_03850"),
+    ENTRY( 3851, "name_03851"),
+    ENTRY( 3852, "name_03852"),
+    ENTRY( 3853, "name_03853"),
+    ENTRY( 3854, "name_03854"),
+    ENTRY( 3855, "name_03855"),
+    ENTRY( 3856, "name_03856"),
+    ENTRY( 3857, "name_03857"),
+    ENTRY( 3858, "name_03858"),
+    ENTRY( 3859, "name_03859"),
+    ENTRY( 3860, "name_03860"),
+    ENTRY( 3861, "name_03861"),
+    ENTRY( 3862, "name_03862"),
+    ENTRY( 3863, "name_03863"),
+    ENTRY( 3864, "name_03864"),
+    ENTRY( 3865, "name_03865"),
+    ENTRY( 3866, "name_03866"),
+    ENTRY( 3867, "name_03867"),
+    ENTRY( 3868, "name_03868"),
+    ENTRY( 3869, "name_03869"),
+    ENTRY( 3870, "name_03870"),
+    ENTRY( 3871, "name_03871"),
+    ENTRY( 3872, "name_03872"),
+    ENTRY( 3873, "name_03873"),
+    ENTRY( 3874, "name_03874"),
+    ENTRY( 3875, "name_03875"),
+    ENTRY( 3876, "name_03876"),
+    ENTRY( 3877, "name_03877"),
+    ENTRY( 3878, "name_03878"),
+    ENTRY( 3879, "name_03879"),
+    ENTRY( 3880, "name_03880"),
+    ENTRY( 3881, "name_03881"),
+    ENTRY( 3882, "name_03882"),
+    ENTRY( 3883, "name_03883"),
+    ENTRY( 3884, "name_03884"),
+    ENTRY( 3885, "name_03885"),
+    ENTRY( 3886, "name_03886"),
+    ENTRY( 3887, "name_03887"),
+    ENTRY( 3888, "name_03888"),
+    ENTRY( 3889, "name_03889"),
+    ENTRY( 3890, "name_03890"),
+    ENTRY( 3891, "name_03891"),
+    ENTRY( 3892, "name_03892"),
+    ENTRY( 3893, "name_03893"),
+    ENTRY( 3894, "name_03894"),
+    ENTRY( 3895, "name_03895"),
+    ENTRY( 3896, "name_03896"),
+    ENTRY( 3897, "name_03897"),
+    ENTRY( 3898, "name_03898"),
+    ENTRY( 3899, "name_03899"),
+    ENTRY( 3900, "name_03900"),
+    ENTRY( 3901, "name_03901"),
+    ENTRY( 3902, "name_03902"),
+    ENTRY( 3903, "name_03903"),
+    ENTRY( 3904, "name_03904"),
+    ENTRY( 3905, "name_03905"),
+    ENTRY( 3906, "name_03906"),
+    ENTRY( 3907, "name_03907"),
+    ENTRY( 3908, "name_03908"),
+    ENTRY( 3909, "name_03909"),
+    ENTRY( 3910, "name_03910"),
+    ENTRY( 3911, "name_03911"),
+    ENTRY( 3912, "name_03912"),
+    ENTRY( 3913, "name_03913"),
+    ENTRY( 3914, "name_03914"),
+    ENTRY( 3915, "name_03915"),
+    ENTRY( 3916, "name_03916"),
+    ENTRY( 3917, "name_03917"),
+    ENTRY( 3918, "name_03918"),
+    ENTRY( 3919, "name_03919"),
+    ENTRY( 3920, "name_03920"),
+    ENTRY( 3921, "name_03921"),
+    ENTRY( 3922, "name_03922"),
+    ENTRY( 3923, "name_03923"),
+    ENTRY( 3924, "name_03924"),
+    ENTRY( 3925, "name_03925"),
+    ENTRY( 3926, "name_03926"),
+    ENTRY( 3927, "name_03927"),
+    ENTRY( 3928, "name_03928"),
+    ENTRY( 3929, "name_03929"),
+    ENTRY( 3930, "name_03930"),
+    ENTRY( 3931, "name_03931"),
+    ENTRY( 3932, "name_03932"),
+    ENTRY( 3933, "name_03933"),
+    ENTRY( 3934, "name_03934"),
+    ENTRY( 3935, "name_03935"),
+    ENTRY( 3936, "name_03936"),
+    ENTRY( 3937, "name_03937"),
+    ENTRY( 3938, "name_03938"),
+    ENTRY( 3939, "name_03939"),
+    ENTRY( 3940, "name_03940"),
+    ENTRY( 3941, "name_03941"),
+    ENTRY( 3942, "name_03942"),
+    ENTRY( 3943, "name_03943"),
+    ENTRY( 3944, "name_03944"),
+    ENTRY( 3945, "name_03945"),
+    ENTRY( 3946, "name_03946"),
+    ENTRY( 3947, "name_03947"),
+    ENTRY( 3948, "name_03948"),
+    ENTRY( 3949, "name_03949"),
+    ENTRY( 3950, "name_03950"),
+    ENTRY( 3951, "name_03951"),
+    ENTRY( 3952, "name_03952"),
+    ENTRY( 3953, "name_03953"),
+    ENTRY( 3954, "name_03954"),
+    ENTRY( 3955, "name_03955"),
+    ENTRY( 3956, "name_03956"),
+    ENTRY( 3957, "name_03957"),
+    ENTRY( 3958, "name_03958"),
+    ENTRY( 3959, "name_03959"),
+    ENTRY( 3960, "name_03960"),
+    ENTRY( 3961, "name_03961"),
+    ENTRY( 3962, "name_03962"),
+    ENTRY( 3963, "name_03963"),
+    ENTRY( 3964, "name_03964"),
+    ENTRY( 3965, "name_03965"),
+    ENTRY( 3966, "name_03966"),
+    ENTRY( 3967, "name_03967"),
+    ENTRY( 3968, "name_03968"),
+    ENTRY( 3969, "name_03969"),
+    ENTRY( 3970, "name_03970"),
+    ENTRY( 3971, "name_03971"),
+    ENTRY( 3972, "name_03972"),
+    ENTRY( 3973, "name_03973"),
+    ENTRY( 3974, "name_03974"),
+    ENTRY( 3975, "name_03975"),
+    ENTRY( 3976, "name_03976"),
+    ENTRY( 3977, "name_03977"),
+    ENTRY( 3978, "name_03978"),
+    ENTRY( 3979, "name_03979"),
+    ENTRY( 3980, "name_03980"),
+    ENTRY( 3981, "name_03981"),
+    ENTRY( 3982, "name_03982"),
+    ENTRY( 3983, "name_03983"),
+    ENTRY( 3984, "name_03984"),
+    ENTRY( 3985, "name_03985"),
+    ENTRY( 3986, "name_03986"),
+    ENTRY( 3987, "name_03987"),
+    ENTRY( 3988, "name_03988"),
+    ENTRY( 3989, "name_03989"),
+    ENTRY( 3990, "name_03990"),
+    ENTRY( 3991, "name_03991"),
+    ENTRY( 3992, "name_03992"),
+    ENTRY( 3993, "name_03993"),
+    ENTRY( 3994, "name_03994"),
+    ENTRY( 3995, "name_03995"),
+    ENTRY( 3996, "name_03996"),
+    ENTRY( 3997, "name_03997"),
+    ENTRY( 3998, "name_03998"),
+    ENTRY( 3999, "name_03999"),
+    ENTRY( 4000, "name_04000"),
+    ENTRY( 4001, "name_04001"),
+    ENTRY( 4002, "name_04002"),
+    ENTRY( 4003, "name_04003"),
+    ENTRY( 4004, "name_04004"),
+    ENTRY( 4005, "name_04005"),
+    ENTRY( 4006, "name_04006"),
+    ENTRY( 4007, "name_04007"),
+    ENTRY( 4008, "name_04008"),
+    ENTRY( 4009, "name_04009"),
+    ENTRY( 4010, "name_04010"),
+    ENTRY( 4011, "name_04011"),
+    ENTRY( 4012, "name_04012"),
+    ENTRY( 4013, "name_04013"),
+    ENTRY( 4014, "name_04014"),
+    ENTRY( 4015, "name_04015"),
+    ENTRY( 4016, "name_04016"),
+    ENTRY( 4017, "name_04017"),
+    ENTRY( 4018, "name_04018"),
+    ENTRY( 4019, "name_04019"),
+    ENTRY( 4020, "name_04020"),
+    ENTRY( 4021, "name_04021"),
+    ENTRY( 4022, "name_04022"),
+    ENTRY( 4023, "name_04023"),
+    ENTRY( 4024, "name_04024"),
+    ENTRY( 4025, "name_04025"),
+    ENTRY( 4026, "name_04026"),
+    ENTRY( 4027, "name_04027"),
+    ENTRY( 4028, "name_04028"),
+    ENTRY( 4029, "name_04029"),
+    ENTRY( 4030, "name_04030"),
+    ENTRY( 4031, "name_04031"),
+    ENTRY( 4032, "name_04032"),
+    ENTRY( 4033, "name_04033"),
+    ENTRY( 4034, "name_04034"),
+    ENTRY( 4035, "name_04035"),
+    ENTRY( 4036, "name_04036"),
+    ENTRY( 4037, "name_04037"),
+    ENTRY( 4038, "name_04038"),
+    ENTRY( 4039, "name_04039"),
+    ENTRY( 4040, "name_04040"),
+    ENTRY( 4041, "name_04041"),
+    ENTRY( 4042, "name_04042"),
+    ENTRY( 4043, "name_04043"),
+    ENTRY( 4044, "name_04044"),
+    ENTRY( 4045, "name_04045"),
+    ENTRY( 4046, "name_04046"),
+    ENTRY( 4047, "name_04047"),
+    ENTRY( 4048, "name_04048"),
+    ENTRY( 4049, "name_04049"),
+    ENTRY( 4050, "name_04050"),
+    ENTRY( 4051, "name_04051"),
+    ENTRY( 4052, "name_04052"),
+    ENTRY( 4053, "name_04053"),
+    ENTRY( 4054, "name_04054"),
+    ENTRY( 4055, "name_04055"),
+    ENTRY( 4056, "name_04056"),
+    ENTRY( 4057, "name_04057"),
+    ENTRY( 4058, "name_04058"),
+    ENTRY( 4059, "name_04059"),
+    ENTRY( 4060, "name_04060"),
+    ENTRY( 4061, "name_04061"),
+    ENTRY( 4062, "name_04062"),
+    ENTRY( 4063, "name_04063"),
+    ENTRY( 4064, "name_04064"),
+    ENTRY( 4065, "name_04065"),
+    ENTRY( 4066, "name_04066"),
+    ENTRY( 4067, "name_04067"),
+    ENTRY( 4068, "name_04068"),
+    ENTRY( 4069, "name_04069"),
+    ENTRY( 4070, "name_04070"),
+    ENTRY( 4071, "name_04071"),
+    ENTRY( 4072, "name_04072"),
+    ENTRY( 4073, "name_04073"),
+    ENTRY( 4074, "name_04074"),
+    ENTRY( 4075, "name_04075"),
+    ENTRY( 4076, "name_04076"),
+    ENTRY( 4077, "name_04077"),
+    ENTRY( 4078, "name_04078"),
+    ENTRY( 4079, "name_04079"),
+    ENTRY( 4080, "name_04080"),
+    ENTRY( 4081, "name_04081"),
+    ENTRY( 4082, "name_04082"),
+    ENTRY( 4083, "name_04083"),
+    ENTRY( 4084, "name_04084"),
+    ENTRY( 4085, "name_04085"),
+    ENTRY( 4086, "name_04086"),
+    ENTRY( 4087, "name_04087"),
+    ENTRY( 4088, "name_04088"),
+    ENTRY( 4089, "name_04089"),
+    ENTRY( 4090, "name_04090"),
+    ENTRY( 4091, "name_04091"),
+    ENTRY( 4092, "name_04092"),
+    ENTRY( 4093, "name_04093"),
+    ENTRY( 4094, "name_04094"),
+    ENTRY( 4095, "name_04095"),
+    ENTRY( 4096, "name_04096"),
+    ENTRY( 4097, "name_04097"),
+    ENTRY( 4098, "name_04098"),
+    ENTRY( 4099, "name_04099"),
+    ENTRY( 4100, "name_04100"),
+    ENTRY( 4101, "name_04101"),
+    ENTRY( 4102, "name_04102"),
+    ENTRY( 4103, "name_04103"),
+    ENTRY( 4104, "name_04104"),
+    ENTRY( 4105, "name_04105"),
+    ENTRY( 4106, "name_04106"),
+    ENTRY( 4107, "name_04107"),
+    ENTRY( 4108, "name_04108"),
+    ENTRY( 4109, "name_04109"),
+    ENTRY( 4110, "name_04110"),
+    ENTRY( 4111, "name_04111"),
+    ENTRY( 4112, "name_04112"),
+    ENTRY( 4113, "name_04113"),
+    ENTRY( 4114, "name_04114"),
+    ENTRY( 4115, "name_04115"),
+    ENTRY( 4116, "name_04116"),
+    ENTRY( 4117, "name_04117"),
+    ENTRY( 4118, "name_04118"),
+    ENTRY( 4119, "name_04119"),
+    ENTRY( 4120, "name_04120"),
+    ENTRY( 4121, "name_04121"),
+    ENTRY( 4122, "name_04122"),
+    ENTRY( 4123, "name_04123"),
+    ENTRY( 4124, "name_04124"),
+    ENTRY( 4125, "name_04125"),
+    ENTRY( 4126, "name_04126"),
+    ENTRY( 4127, "name_04127"),
+    ENTRY( 4128, "name_04128"),
+    ENTRY( 4129, "name_04129"),
+    ENTRY( 4130, "name_04130"),
+    ENTRY( 4131, "name_04131"),
+    ENTRY( 4132, "name_04132"),
+    ENTRY( 4133, "name_04133"),
+    ENTRY( 4134, "name_04134"),
+    ENTRY( 4135, "name_04135"),
+    ENTRY( 4136, "name_04136"),
+    ENTRY( 4137, "name_04137"),
+    ENTRY( 4138, "name_04138"),
+    ENTRY( 4139, "name_04139"),
+    ENTRY( 4140, "name_04140"),
+    ENTRY( 4141, "name_04141"),
+    ENTRY( 4142, "name_04142"),
+    ENTRY( 4143, "name_04143"),
+    ENTRY( 4144, "name_04144"),
+    ENTRY( 4145, "name_04145"),
+    ENTRY( 4146, "name_04146"),
+    ENTRY( 4147, "name_04147"),
+    ENTRY( 4148, "name_04148"),
+    ENTRY( 4149, "name_04149"),
+    ENTRY( 4150, "name_04150"),
+    ENTRY( 4151, "name_04151"),
+    ENTRY( 4152, "name_04152"),
+    ENTRY( 4153, "name_04153"),
+    ENTRY( 4154, "name_04154"),
+    ENTRY( 4155, "name_04155"),
+    ENTRY( 4156, "name_04156"),
+    ENTRY( 4157, "name_04157"),
+    ENTRY( 4158, "name_04158"),
+    ENTRY( 4159, "name_04159"),
+    ENTRY( 4160, "name_04160"),
+    ENTRY( 4161, "name_04161"),
+    ENTRY( 4162, "name_04162"),
+    ENTRY( 4163, "name_04163"),
+    ENTRY( 4164, "name_04164"),
+    ENTRY( 4165, "name_04165"),
+    ENTRY( 4166, "name_04166"),
+    ENTRY( 4167, "name_04167"),
+    ENTRY( 4168, "name_04168"),
+    ENTRY( 4169, "name_04169"),
+    ENTRY( 4170, "name_04170"),
+    ENTRY( 4171, "name_04171"),
+    ENTRY( 4172, "name_04172"),
+    ENTRY( 4173, "name_04173"),
+    ENTRY( 4174, "name_04174"),
+    ENTRY( 4175, "name_04175"),
+    ENTRY( 4176, "name_04176"),
+    ENTRY( 4177, "name_04177"),
+    ENTRY( 4178, "name_04178"),
+    ENTRY( 4179, "name_04179"),
+    ENTRY( 4180, "name_04180"),
+    ENTRY( 4181, "name_04181"),
+    ENTRY( 4182, "name_04182"),
+    ENTRY( 4183, "name_04183"),
+    ENTRY( 4184, "name_04184"),
+    ENTRY( 4185, "name_04185"),
+    ENTRY( 4186, "name_04186"),
+    ENTRY( 4187, "name_04187"),
+    ENTRY( 4188, "name_04188"),
+    ENTRY( 4189, "name_04189"),
+    ENTRY( 4190, "name_04190"),
+    ENTRY( 4191, "name_04191"),
+    ENTRY( 4192, "name_04192"),
+    ENTRY( 4193, "name_04193"),
+    ENTRY( 4194, "name_04194"),
+    ENTRY( 4195, "name_04195"),
+    ENTRY( 4196, "name_04196"),
+    ENTRY( 4197, "name_04197"),
+    ENTRY( 4198, "name_04198"),
+    ENTRY( 4199, "name_04199"),
+    ENTRY( 4200, "name_04200"),
+    ENTRY( 4201, "name_04201"),
+    ENTRY( 4202, "name_04202"),
+    ENTRY( 4203, "name_04203"),
+    ENTRY( 4204, "name_04204"),
+    ENTRY( 4205, "name_04205"),
+    ENTRY( 4206, "name_04206"),
+    ENTRY( 4207, "name_04207"),
+    ENTRY( 4208, "name_04208"),
+    ENTRY( 4209, "name_04209"),
+    ENTRY( 4210, "name_04210"),
+    ENTRY( 4211, "name_04211"),
+    ENTRY( 4212, "name_04212"),
+    ENTRY( 4213, "name_04213"),
+    ENTRY( 4214, "name_04214"),
+    ENTRY( 4215, "name_04215"),
+    ENTRY( 4216, "name_04216"),
+    ENTRY( 4217, "name_04217"),
+    ENTRY( 4218, "name_04218"),
+    ENTRY( 4219, "name_04219"),
+    ENTRY( 4220, "name_04220"),
+    ENTRY( 4221, "name_04221"),
+    ENTRY( 4222, "name_04222"),
+    ENTRY( 4223, "name_04223"),
+    ENTRY( 4224, "name_04224"),
+    ENTRY( 4225, "name_04225"),
+    ENTRY( 4226, "name_04226"),
+    ENTRY( 4227, "name_04227"),
+    ENTRY( 4228, "name_04228"),
+    ENTRY( 4229, "name_04229"),
+    ENTRY( 4230, "name_04230"),
+    ENTRY( 4231, "name_04231"),
+    ENTRY( 4232, "name_04232"),
+    ENTRY( 4233, "name_04233"),
+    ENTRY( 4234, "name_04234"),
+    ENTRY( 4235, "name_04235"),
+    ENTRY( 4236, "name_04236"),
+    ENTRY( 4237, "name_04237"),
+    ENTRY( 4238, "name_04238"),
+    ENTRY( 4239, "name_04239"),
+    ENTRY( 4240, "name_04240"),
+    ENTRY( 4241, "name_04241"),
+    ENTRY( 4242, "name_04242"),
+    ENTRY( 4243, "name_04243"),
+    ENTRY( 4244, "name_04244"),
+    ENTRY( 4245, "name_04245"),
+    ENTRY( 4246, "name_04246"),
+    ENTRY( 4247, "name_04247"),
+    ENTRY( 4248, "name_04248"),
+    ENTRY( 4249, "name_04249"),
+    ENTRY( 4250, "name_04250"),
+    ENTRY( 4251, "name_04251"),
+    ENTRY( 4252, "name_04252"),
+    ENTRY( 4253, "name_04253"),
+    ENTRY( 4254, "name_04254"),
+    ENTRY( 4255, "name_04255"),
+    ENTRY( 4256, "name_04256"),
+    ENTRY( 4257, "name_04257"),
+    ENTRY( 4258, "name_04258"),
+    ENTRY( 4259, "name_04259"),
+    ENTRY( 4260, "name_04260"),
+    ENTRY( 4261, "name_04261"),
+    ENTRY( 4262, "name_04262"),
+    ENTRY( 4263, "name_04263"),
+    ENTRY( 4264, "name_04264"),
+    ENTRY( 4265, "name_04265"),
+    ENTRY( 4266, "name_04266"),
+    ENTRY( 4267, "name_04267"),
+    ENTRY( 4268, "name_04268"),
+    ENTRY( 4269, "name_04269"),
+    ENTRY( 4270, "name_04270"),
+    ENTRY( 4271, "name_04271"),
+    ENTRY( 4272, "name_04272"),
+    ENTRY( 4273, "name_04273"),
+    ENTRY( 4274, "name_04274"),
+    ENTRY( 4275, "name_04275"),
+    ENTRY( 4276, "name_04276"),
+    ENTRY( 4277, "name_04277"),
+    ENTRY( 4278, "name_04278"),
+    ENTRY( 4279, "name_04279"),
+    ENTRY( 4280, "name_04280"),
+    ENTRY( 4281, "name_04281"),
+    ENTRY( 4282, "name_04282"),
+    ENTRY( 4283, "name_04283"),
+    ENTRY( 4284, "name_04284"),
+    ENTRY( 4285, "name_04285"),
+    ENTRY( 4286, "name_04286"),
+    ENTRY( 4287, "name_04287"),
+    ENTRY( 4288, "name_04288"),
+    ENTRY( 4289, "name_04289"),
+    ENTRY( 4290, "name_04290"),
+    ENTRY( 4291, "name_04291"),
+    ENTRY( 4292, "name_04292"),
+    ENTRY( 4293, "name_04293"),
+    ENTRY( 4294, "name_04294"),
+    ENTRY( 4295, "name_04295"),
+    ENTRY( 4296, "name_04296"),
+    ENTRY( 4297, "name_04297"),
+    ENTRY( 4298, "name_04298"),
+    ENTRY( 4299, "name_04299"),
+    ENTRY( 4300, "name_04300"),
+    ENTRY( 4301, "name_04301"),
+    ENTRY( 4302, "name_04302"),
+    ENTRY( 4303, "name_04303"),
+    ENTRY( 4304, "name_04304"),
+    ENTRY( 4305, "name_04305"),
+    ENTRY( 4306, "name_04306"),
+    ENTRY( 4307, "name_04307"),
+    ENTRY( 4308, "name_04308"),
+    ENTRY( 4309, "name_04309"),
+    ENTRY( 4310, "name_04310"),
+    ENTRY( 4311, "name_04311"),
+    ENTRY( 4312, "name_04312"),
+    ENTRY( 4313, "name_04313"),
+    ENTRY( 4314, "name_04314"),
+    ENTRY( 4315, "name_04315"),
+    ENTRY( 4316, "name_04316"),
+    ENTRY( 4317, "name_04317"),
+    ENTRY( 4318, "name_04318"),
+    ENTRY( 4319, "name_04319"),
+    ENTRY( 4320, "name_04320"),
+    ENTRY( 4321, "name_04321"),
+    ENTRY( 4322, "name_04322"),
+    ENTRY( 4323, "name_04323"),
+    ENTRY( 4324, "name_04324"),
+    ENTRY( 4325, "name_04325"),
+    ENTRY( 4326, "name_04326"),
+    ENTRY( 4327, "name_04327"),
+    ENTRY( 4328, "name_04328"),
+    ENTRY( 4329, "name_04329"),
+    ENTRY( 4330, "name_04330"),
+    ENTRY( 4331, "name_04331"),
+    ENTRY( 4332, "name_04332"),
+    ENTRY( 4333, "name_04333"),
+    ENTRY( 4334, "name_04334"),
+    ENTRY( 4335, "name_04335"),
+    ENTRY( 4336, "name_04336"),
+    ENTRY( 4337, "name_04337"),
+    ENTRY( 4338, "name_04338"),
+    ENTRY( 4339, "name_04339"),
+    ENTRY( 4340, "name_04340"),
+    ENTRY( 4341, "name_04341"),
+    ENTRY( 4342, "name_04342"),
+    ENTRY( 4343, "name_04343"),
+    ENTRY( 4344, "name_04344"),
+    ENTRY( 4345, "name_04345"),
+    ENTRY( 4346, "name_04346"),
+    ENTRY( 4347, "name_04347"),
+    ENTRY( 4348, "name_04348"),
+    ENTRY( 4349, "name_04349"),
+    ENTRY( 4350, "name_04350"),
+    ENTRY( 4351, "name_04351"),
+    ENTRY( 4352, "name_04352"),
+    ENTRY( 4353, "name_04353"),
+    ENTRY( 4354, "name_04354"),
+    ENTRY( 4355, "name_04355"),
+    ENTRY( 4356, "name_04356"),
+    ENTRY( 4357, "name_04357"),
+    ENTRY( 4358, "name_04358"),
+    ENTRY( 4359, "name_04359"),
+    ENTRY( 4360, "name_04360"),
+    ENTRY( 4361, "name_04361"),
+    ENTRY( 4362, "name_04362"),
+    ENTRY( 4363, "name_04363"),
+    ENTRY( 4364, "name_04364"),
+    ENTRY( 4365, "name_04365"),
+    ENTRY( 4366, "name_04366"),
+    ENTRY( 4367, "name_04367"),
+    ENTRY( 4368, "name_04368"),
+    ENTRY( 4369, "name_04369"),
+    ENTRY( 4370, "name_04370"),
+    ENTRY( 4371, "name_04371"),
+    ENTRY( 4372, "name_04372"),
+    ENTRY( 4373, "name_04373"),
+    ENTRY( 4374, "name_04374"),
+    ENTRY( 4375, "name_04375"),
+    ENTRY( 4376, "name_04376"),
+    ENTRY( 4377, "name_04377"),
+    ENTRY( 4378, "name_04378"),
+    ENTRY( 4379, "name_04379"),
+    ENTRY( 4380, "name_04380"),
+    ENTRY( 4381, "name_04381"),
+    ENTRY( 4382, "name_04382"),
+    ENTRY( 4383, "name_04383"),
+    ENTRY( 4384, "name_04384"),
+    ENTRY( 4385, "name_04385"),
+    ENTRY( 4386, "name_04386"),
+    ENTRY( 4387, "name_04387"),
+    ENTRY( 4388, "name_04388"),
+    ENTRY( 4389, "name_04389"),
+    ENTRY( 4390, "name_04390"),
+    ENTRY( 4391, "name_04391"),
+    ENTRY( 4392, "name_04392"),
+    ENTRY( 4393, "name_04393"),
+    ENTRY( 4394, "name_04394"),
+    ENTRY( 4395, "name_04395"),
+    ENTRY( 4396, "name_04396"),
+    ENTRY( 4397, "name_04397"),
+    ENTRY( 4398, "name_04398"),
+    ENTRY( 4399, "name_04399"),
+    ENTRY( 4400, "name_04400"),
+    ENTRY( 4401, "name_04401"),
+    ENTRY( 4402, "name_04402"),
+    ENTRY( 4403, "name_04403"),
+    ENTRY( 4404, "name_04404"),
+    ENTRY( 4405, "name_04405"),
+    ENTRY( 4406, "name_04406"),
+    ENTRY( 4407, "name_04407"),
+    ENTRY( 4408, "name_04408"),
+    ENTRY( 4409, "name_04409"),
+    ENTRY( 4410, "name_04410"),
+    ENTRY( 4411, "name_04411"),
+    ENTRY( 4412, "name_04412"),
+    ENTRY( 4413, "name_04413"),
+    ENTRY( 4414, "name_04414"),
+    ENTRY( 4415, "name_04415"),
+    ENTRY( 4416, "name_04416"),
+    ENTRY( 4417, "name_04417"),
+    ENTRY( 4418, "name_04418"),
+    ENTRY( 4419, "name_04419"),
+    ENTRY( 4420, "name_04420"),
+    ENTRY( 4421, "name_04421"),
+    ENTRY( 4422, "name_04422"),
+    ENTRY( 4423, "name_04423"),
+    ENTRY( 4424, "name_04424"),
+    ENTRY( 4425, "name_04425"),
+    ENTRY( 4426, "name_04426"),
+    ENTRY( 4427, "name_04427"),
+    ENTRY( 4428, "name_04428"),
+    ENTRY( 4429, "name_04429"),
+    ENTRY( 4430, "name_04430"),
+    ENTRY( 4431, "name_04431"),
+    ENTRY( 4432, "name_04432"),
+    ENTRY( 4433, "name_04433"),
+    ENTRY( 4434, "name_04434"),
+    ENTRY( 4435, "name_04435"),
+    ENTRY( 4436, "name_04436"),
+    ENTRY( 4437, "name_04437"),
+    ENTRY( 4438, "name_04438"),
+    ENTRY( 4439, "name_04439"),
+    ENTRY( 4440, "name_04440"),
+    ENTRY( 4441, "name_04441"),
+    ENTRY( 4442, "name_04442"),
+    ENTRY( 4443, "name_04443"),
+    ENTRY( 4444, "name_04444"),
+    ENTRY( 4445, "name_04445"),
+    ENTRY( 4446, "name_04446"),
+    ENTRY( 4447, "name_04447"),
+    ENTRY( 4448, "name_04448"),
+    ENTRY( 4449, "name_04449"),
+    ENTRY( 4450, "name_04450"),
+    ENTRY( 4451, "name_04451"),
+    ENTRY( 4452, "name_04452"),
+    ENTRY( 4453, "name_04453"),
+    ENTRY( 4454, "name_04454"),
+    ENTRY( 4455, "name_04455"),
+    ENTRY( 4456, "name_04456"),
+    ENTRY( 4457, "name_04457"),
+    ENTRY( 4458, "name_04458"),
+    ENTRY( 4459, "name_04459"),
+    ENTRY( 4460, "name_04460"),
+    ENTRY( 4461, "name_04461"),
+    ENTRY( 4462, "name_04462"),
+    ENTRY( 4463, "name_04463"),
+    ENTRY( 4464, "name_04464"),
+    ENTRY( 4465, "name_04465"),
+    ENTRY( 4466, "name_04466"),
+    ENTRY( 4467, "name_04467"),
+    ENTRY( 4468, "name_04468"),
+    ENTRY( 4469, "name_04469"),
+    ENTRY( 4470, "name_04470"),
+    ENTRY( 4471, "name_04471"),
+    ENTRY( 4472, "name_04472"),
+    ENTRY( 4473, "name_04473"),
+    ENTRY( 4474, "name_04474"),
+    ENTRY( 4475, "name_04475"),
+    ENTRY( 4476, "name_04476"),
+    ENTRY( 4477, "name_04477"),
+    ENTRY( 4478, "name_04478"),
+    ENTRY( 4479, "name_04479"),
+    ENTRY( 4480, "name_04480"),
+    ENTRY( 4481, "name_04481"),
+    ENTRY( 4482, "name_04482"),
+    ENTRY( 4483, "name_04483"),
+    ENTRY( 4484, "name_04484"),
+    ENTRY( 4485, "name_04485"),
+    ENTRY( 4486, "name_04486"),
+    ENTRY( 4487, "name_04487"),
+    ENTRY( 4488, "name_04488"),
+    ENTRY( 4489, "name_04489"),
+    ENTRY( 4490, "name_04490"),
+    ENTRY( 4491, "name_04491"),
+    ENTRY( 4492, "name_04492"),
+    ENTRY( 4493, "name_04493"),
+    ENTRY( 4494, "name_04494"),
+    ENTRY( 4495, "name_04495"),
+    ENTRY( 4496, "name_04496"),
+    ENTRY( 4497, "name_04497"),
+    ENTRY( 4498, "name_04498"),
+    ENTRY( 4499, "name_04499"),
+    ENTRY( 4500, "name_04500"),
+    ENTRY( 4501, "name_04501"),
+    ENTRY( 4502, "name_04502"),
+    ENTRY( 4503, "name_04503"),
+    ENTRY( 4504, "name_04504"),
+    ENTRY( 4505, "name_04505"),
+    ENTRY( 4506, "name_04506"),
+    ENTRY( 4507, "name_04507"),
+    ENTRY( 4508, "name_04508"),
+    ENTRY( 4509, "name_04509"),
+    ENTRY( 4510, "name_04510"),
+    ENTRY( 4511, "name_04511"),
+    ENTRY( 4512, "name_04512"),
+    ENTRY( 4513, "name_04513"),
+    ENTRY( 4514, "name_04514"),
+    ENTRY( 4515, "name_04515"),
+    ENTRY( 4516, "name_04516"),
+    ENTRY( 4517, "name_04517"),
+    ENTRY( 4518, "name_04518"),
+    ENTRY( 4519, "name_04519"),
+    ENTRY( 4520, "name_04520"),
+    ENTRY( 4521, "name_04521"),
+    ENTRY( 4522, "name_04522"),
+    ENTRY( 4523, "name_04523"),
+    ENTRY( 4524, "name_04524"),
+    ENTRY( 4525, "name_04525"),
+    ENTRY( 4526, "name_04526"),
+    ENTRY( 4527, "name_04527"),
+    ENTRY( 4528, "name_04528"),
+    ENTRY( 4529, "name_04529"),
+    ENTRY( 4530, "name_04530"),
+    ENTRY( 4531, "name_04531"),
+    ENTRY( 4532, "name_04532"),
+    ENTRY( 4533, "name_04533"),
+    ENTRY( 4534, "name_04534"),
+    ENTRY( 4535, "name_04535"),
+    ENTRY( 4536, "name_04536"),
+    ENTRY( 4537, "name_04537"),
+    ENTRY( 4538, "name_04538"),
+    ENTRY( 4539, "name_04539"),
+    ENTRY( 4540, "name_04540"),
+    ENTRY( 4541, "name_04541"),
+    ENTRY( 4542, "name_04542"),
+    ENTRY( 4543, "name_04543"),
+    ENTRY( 4544, "name_04544"),
+    ENTRY( 4545, "name_04545"),
+    ENTRY( 4546, "name_04546"),
+    ENTRY( 4547, "name_04547"),
+    ENTRY( 4548, "name_04548"),
+    ENTRY( 4549, "name_04549"),
+    ENTRY( 4550, "name_04550"),
+    ENTRY( 4551, "name_04551"),
+    ENTRY( 4552, "name_04552"),
+    ENTRY( 4553, "name_04553"),
+    ENTRY( 4554, "name_04554"),
+    ENTRY( 4555, "name_04555"),
+    ENTRY( 4556, "name_04556"),
+    ENTRY( 4557, "name_04557"),
+    ENTRY( 4558, "name_04558"),
+    ENTRY( 4559, "name_04559"),
+    ENTRY( 4560, "name_04560"),
+    ENTRY( 4561, "name_04561"),
+    ENTRY( 4562, "name_04562"),
+    ENTRY( 4563, "name_04563"),
+    ENTRY( 4564, "name_04564"),
+    ENTRY( 4565, "name_04565"),
+    ENTRY( 4566, "name_04566"),
+    ENTRY( 4567, "name_04567"),
+    ENTRY( 4568, "name_04568"),
+    ENTRY( 4569, "name_04569"),
+    ENTRY( 4570, "name_04570"),
+    ENTRY( 4571, "name_04571"),
+    ENTRY( 4572, "name_04572"),
+    ENTRY( 4573, "name_04573"),
+    ENTRY( 4574, "name_04574"),
+    ENTRY( 4575, "name_04575"),
+    ENTRY( 4576, "name_04576"),
+    ENTRY( 4577, "name_04577"),
+    ENTRY( 4578, "name_04578"),
+    ENTRY( 4579, "name_04579"),
+    ENTRY( 4580, "name_04580"),
+    ENTRY( 4581, "name_04581"),
+    ENTRY( 4582, "name_04582"),
+    ENTRY( 4583, "name_04583"),
+    ENTRY( 4584, "name_04584"),
+    ENTRY( 4585, "name_04585"),
+    ENTRY( 4586, "name_04586"),
+    ENTRY( 4587, "name_04587"),
+    ENTRY( 4588, "name_04588"),
+    ENTRY( 4589, "name_04589"),
+    ENTRY( 4590, "name_04590"),
+    ENTRY( 4591, "name_04591"),
+    ENTRY( 4592, "name_04592"),
+    ENTRY( 4593, "name_04593"),
+    ENTRY( 4594, "name_04594"),
+    ENTRY( 4595, "name_04595"),
+    ENTRY( 4596, "name_04596"),
+    ENTRY( 4597, "name_04597"),
+    ENTRY( 4598, "name_04598"),
+    ENTRY( 4599, "name_04599"),
+    ENTRY( 4600, "name_04600"),
+    ENTRY( 4601, "name_04601"),
+    ENTRY( 4602, "name_04602"),
+    ENTRY( 4603, "name_04603"),
+    ENTRY( 4604, "name_04604"),
+    ENTRY( 4605, "name_04605"),
+    ENTRY( 4606, "name_04606"),
+    ENTRY( 4607, "name_04607"),
+    ENTRY( 4608, "name_04608"),
+    ENTRY( 4609, "name_04609"),
+    ENTRY( 4610, "name_04610"),
+    ENTRY( 4611, "name_04611"),
+    ENTRY( 4612, "name_04612"),
+    ENTRY( 4613, "name_04613"),
+    ENTRY( 4614, "name_04614"),
+    ENTRY( 4615, "name_04615"),
+    ENTRY( 4616, "name_04616"),
+    ENTRY( 4617, "name_04617"),
+    ENTRY( 4618, "name_04618"),
+    ENTRY( 4619, "name_04619"),
+    ENTRY( 4620, "name_04620"),
+    ENTRY( 4621, "name_04621"),
+    ENTRY( 4622, "name_04622"),
+    ENTRY( 4623, "name_04623"),
+    ENTRY( 4624, "name_04624"),
+    ENTRY( 4625, "name_04625"),
+    ENTRY( 4626, "name_04626"),
+    ENTRY( 4627, "name_04627"),
+    ENTRY( 4628, "name_04628"),
+    ENTRY( 4629, "name_04629"),
+    ENTRY( 4630, "name_04630"),
+    ENTRY( 4631, "name_04631"),
+    ENTRY( 4632, "name_04632"),
+    ENTRY( 4633, "name_04633"),
+    ENTRY( 4634, "name_04634"),
+    ENTRY( 4635, "name_04635"),
+    ENTRY( 4636, "name_04636"),
+    ENTRY( 4637, "name_04637"),
+    ENTRY( 4638, "name_04638"),
+    ENTRY( 4639, "name_04639"),
+    ENTRY( 4640, "name_04640"),
+    ENTRY( 4641, "name_04641"),
+    ENTRY( 4642, "name_04642"),
+    ENTRY( 4643, "name_04643"),
+    ENTRY( 4644, "name_04644"),
+    ENTRY( 4645, "name_04645"),
+    ENTRY( 4646, "name_04646"),
+    ENTRY( 4647, "name_04647"),
+    ENTRY( 4648, "name_04648"),
+    ENTRY( 4649, "name_04649"),
+    ENTRY( 4650, "name_04650"),
+    ENTRY( 4651, "name_04651"),
+    ENTRY( 4652, "name_04652"),
+    ENTRY( 4653, "name_04653"),
+    ENTRY( 4654, "name_04654"),
+    ENTRY( 4655, "name_04655"),
+    ENTRY( 4656, "name_04656"),
+    ENTRY( 4657, "name_04657"),
+    ENTRY( 4658, "name_04658"),
+    ENTRY( 4659, "name_04659"),
+    ENTRY( 4660, "name_04660"),
+    ENTRY( 4661, "name_04661"),
+    ENTRY( 4662, "name_04662"),
+    ENTRY( 4663, "name_04663"),
+    ENTRY( 4664, "name_04664"),
+    ENTRY( 4665, "name_04665"),
+    ENTRY( 4666, "name_04666"),
+    ENTRY( 4667, "name_04667"),
+    ENTRY( 4668, "name_04668"),
+    ENTRY( 4669, "name_04669"),
+    ENTRY( 4670, "name_04670"),
+    ENTRY( 4671, "name_04671"),
+    ENTRY( 4672, "name_04672"),
+    ENTRY( 4673, "name_04673"),
+    ENTRY( 4674, "name_04674"),
+    ENTRY( 4675, "name_04675"),
+    ENTRY( 4676, "name_04676"),
+    ENTRY( 4677, "name_04677"),
+    ENTRY( 4678, "name_04678"),
+    ENTRY( 4679, "name_04679"),
+    ENTRY( 4680, "name_04680"),
+    ENTRY( 4681, "name_04681"),
+    ENTRY( 4682, "name_04682"),
+    ENTRY( 4683, "name_04683"),
+    ENTRY( 4684, "name_04684"),
+    ENTRY( 4685, "name_04685"),
+    ENTRY( 4686, "name_04686"),
+    ENTRY( 4687, "name_04687"),
+    ENTRY( 4688, "name_04688"),
+    ENTRY( 4689, "name_04689"),
+    ENTRY( 4690, "name_04690"),
+    ENTRY( 4691, "name_04691"),
+    ENTRY( 4692, "name_04692"),
+    ENTRY( 4693, "name_04693"),
+    ENTRY( 4694, "name_04694"),
+    ENTRY( 4695, "name_04695"),
+    ENTRY( 4696, "name_04696"),
+    ENTRY( 4697, "name_04697"),
+    ENTRY( 4698, "name_04698"),
+    ENTRY( 4699, "name_04699"),
+    ENTRY( 4700, "name_04700"),
+    ENTRY( 4701, "name_04701"),
+    ENTRY( 4702, "name_04702"),
+    ENTRY( 4703, "name_04703"),
+    ENTRY( 4704, "name_04704"),
+    ENTRY( 4705, "name_04705"),
+    ENTRY( 4706, "name_04706"),
+    ENTRY( 4707, "name_04707"),
+    ENTRY( 4708, "name_04708"),
+    ENTRY( 4709, "name_04709"),
+    ENTRY( 4710, "name_04710"),
+    ENTRY( 4711, "name_04711"),
+    ENTRY( 4712, "name_04712"),
+    ENTRY( 4713, "name_04713"),
+    ENTRY( 4714, "name_04714"),
+    ENTRY( 4715, "name_04715"),
+    ENTRY( 4716, "name_04716"),
+    ENTRY( 4717, "name_04717"),
+    ENTRY( 4718, "name_04718"),
+    ENTRY( 4719, "name_04719"),
+    ENTRY( 4720, "name_04720"),
+    ENTRY( 4721, "name_04721"),
+    ENTRY( 4722, "name_04722"),
+    ENTRY( 4723, "name_04723"),
+    ENTRY( 4724, "name_04724"),
+    ENTRY( 4725, "name_04725"),
+    ENTRY( 4726, "name_04726"),
+    ENTRY( 4727, "name_04727"),
+    ENTRY( 4728, "name_04728"),
+    ENTRY( 4729, "name_04729"),
+    ENTRY( 4730, "name_04730"),
+    ENTRY( 4731, "name_04731"),
+    ENTRY( 4732, "name_04732"),
+    ENTRY( 4733, "name_04733"),
+    ENTRY( 4734, "name_04734"),
+    ENTRY( 4735, "name_04735"),
+    ENTRY( 4736, "name_04736"),
+    ENTRY( 4737, "name_04737"),
+    ENTRY( 4738, "name_04738"),
+    ENTRY( 4739, "name_04739"),
+    ENTRY( 4740, "name_04740"),
+    ENTRY( 4741, "name_04741"),
+    ENTRY( 4742, "name_04742"),
+    ENTRY( 4743, "name_04743"),
+    ENTRY( 4744, "name_04744"),
+    ENTRY( 4745, "name_04745"),
+    ENTRY( 4746, "name_04746"),
+    ENTRY( 4747, "name_04747"),
+    ENTRY( 4748, "name_04748"),
+    ENTRY( 4749, "name_04749"),
+    ENTRY( 4750, "name_04750"),
+    ENTRY( 4751, "name_04751"),
+    ENTRY( 4752, "name_04752"),
+    ENTRY( 4753, "name_04753"),
+    ENTRY( 4754, "name_04754"),
+    ENTRY( 4755, "name_04755"),
+    ENTRY( 4756, "name_04756"),
+    ENTRY( 4757, "name_04757"),
+    ENTRY( 4758, "name_04758"),
+    ENTRY( 4759, "name_04759"),
+    ENTRY( 4760, "name_04760"),
+    ENTRY( 4761, "name_04761"),
+    ENTRY( 4762, "name_04762"),
+    ENTRY( 4763, "name_04763"),
+    ENTRY( 4764, "name_04764"),
+    ENTRY( 4765, "name_04765"),
+    ENTRY( 4766, "name_04766"),
+    ENTRY( 4767, "name_04767"),
+    ENTRY( 4768, "name_04768"),
+    ENTRY( 4769, "name_04769"),
+    ENTRY( 4770, "name_04770"),
+    ENTRY( 4771, "name_04771"),
+    ENTRY( 4772, "name_04772"),
+    ENTRY( 4773, "name_04773"),
+    ENTRY( 4774, "name_04774"),
+    ENTRY( 4775, "name_04775"),
+    ENTRY( 4776, "name_04776"),
+    ENTRY( 4777, "name_04777"),
+    ENTRY( 4778, "name_04778"),
+    ENTRY( 4779, "name_04779"),
+    ENTRY( 4780, "name_04780"),
+    ENTRY( 4781, "name_04781"),
+    ENTRY( 4782, "name_04782"),
+    ENTRY( 4783, "name_04783"),
+    ENTRY( 4784, "name_04784"),
+    ENTRY( 4785, "name_04785"),
+    ENTRY( 4786, "name_04786"),
+    ENTRY( 4787, "name_04787"),
+    ENTRY( 4788, "name_04788"),
+    ENTRY( 4789, "name_04789"),
+    ENTRY( 4790, "name_04790"),
+    ENTRY( 4791, "name_04791"),
+    ENTRY( 4792, "name_04792"),
+    ENTRY( 4793, "name_04793"),
+    ENTRY( 4794, "name_04794"),
+    ENTRY( 4795, "name_04795"),
+    ENTRY( 4796, "name_04796"),
+    ENTRY( 4797, "name_04797"),
+    ENTRY( 4798, "name_04798"),
+    ENTRY( 4799, "name_04799"),
+    ENTRY( 4800, "name_04800"),
+    ENTRY( 4801, "name_04801"),
+    ENTRY( 4802, "name_04802"),
+    ENTRY( 4803, "name_04803"),
+    ENTRY( 4804, "name_04804"),
+    ENTRY( 4805, "name_04805"),
+    ENTRY( 4806, "name_04806"),
+    ENTRY( 4807, "name_04807"),
+    ENTRY( 4808, "name_04808"),
+    ENTRY( 4809, "name_04809"),
+    ENTRY( 4810, "name_04810"),
+    ENTRY( 4811, "name_04811"),
+    ENTRY( 4812, "name_04812"),
+    ENTRY( 4813, "name_04813"),
+    ENTRY( 4814, "name_04814"),
+    ENTRY( 4815, "name_04815"),
+    ENTRY( 4816, "name_04816"),
+    ENTRY( 4817, "name_04817"),
+    ENTRY( 4818, "name_04818"),
+    ENTRY( 4819, "name_04819"),
+    ENTRY( 4820, "name_04820"),
+    ENTRY( 4821, "name_04821"),
+    ENTRY( 4822, "name_04822"),
+    ENTRY( 4823, "name_04823"),
+    ENTRY( 4824, "name_04824"),
+    ENTRY( 4825, "name_04825"),
+    ENTRY( 4826, "name_04826"),
+    ENTRY( 4827, "name_04827"),
+    ENTRY( 4828, "name_04828"),
+    ENTRY( 4829, "name_04829"),
+    ENTRY( 4830, "name_04830"),
+    ENTRY( 4831, "name_04831"),
+    ENTRY( 4832, "name_04832"),
+    ENTRY( 4833, "name_04833"),
+    ENTRY( 4834, "name_04834"),
+    ENTRY( 4835, "name_04835"),
+    ENTRY( 4836, "name_04836"),
+    ENTRY( 4837, "name_04837"),
+    ENTRY( 4838, "name_04838"),
+    ENTRY( 4839, "name_04839"),
+    ENTRY( 4840, "name_04840"),
+    ENTRY( 4841, "name_04841"),
+    ENTRY( 4842, "name_04842"),
+    ENTRY( 4843, "name_04843"),
+    ENTRY( 4844, "name_04844"),
+    ENTRY( 4845, "name_04845"),
+    ENTRY( 4846, "name_04846"),
+    ENTRY( 4847, "name_04847"),
+    ENTRY( 4848, "name_04848"),
+    ENTRY( 4849, "name_04849"),
+    ENTRY( 4850, "name_04850"),
+    ENTRY( 4851, "name_04851"),
+    ENTRY( 4852, "name_04852"),
+    ENTRY( 4853, "name_04853"),
+    ENTRY( 4854, "name_04854"),
+    ENTRY( 4855, "name_04855"),
+    ENTRY( 4856, "name_04856"),
+    ENTRY( 4857, "name_04857"),
+    ENTRY( 4858, "name_04858"),
+    ENTRY( 4859, "name_04859"),
+    ENTRY( 4860, "name_04860"),
+    ENTRY( 4861, "name_04861"),
+    ENTRY( 4862, "name_04862"),
+    ENTRY( 4863, "name_04863"),
+    ENTRY( 4864, "name_04864"),
+    ENTRY( 4865, "name_04865"),
+    ENTRY( 4866, "name_04866"),
+    ENTRY( 4867, "name_04867"),
+    ENTRY( 4868, "name_04868"),
+    ENTRY( 4869, "name_04869"),
+    ENTRY( 4870, "name_04870"),
+    ENTRY( 4871, "name_04871"),
+    ENTRY( 4872, "name_04872"),
+    ENTRY( 4873, "name_04873"),
+    ENTRY( 4874, "name_04874"),
+    ENTRY( 4875, "name_04875"),
+    ENTRY( 4876, "name_04876"),
+    ENTRY( 4877, "name_04877"),
+    ENTRY( 4878, "name_04878"),
+    ENTRY( 4879, "name_04879"),
+    ENTRY( 4880, "name_04880"),
+    ENTRY( 4881, "name_04881"),
+    ENTRY( 4882, "name_04882"),
+    ENTRY( 4883, "name_04883"),
+    ENTRY( 4884, "name_04884"),
+    ENTRY( 4885, "name_04885"),
+    ENTRY( 4886, "name_04886"),
+    ENTRY( 4887, "name_04887"),
+    ENTRY( 4888, "name_04888"),
+    ENTRY( 4889, "name_04889"),
+    ENTRY( 4890, "name_04890"),
+    ENTRY( 4891, "name_04891"),
+    ENTRY( 4892, "name_04892"),
+    ENTRY( 4893, "name_04893"),
+    ENTRY( 4894, "name_04894"),
+    ENTRY( 4895, "name_04895"),
+    ENTRY( 4896, "name_04896"),
+    ENTRY( 4897, "name_04897"),
+    ENTRY( 4898, "name_04898"),
+    ENTRY( 4899, "name_04899"),
+    ENTRY( 4900, "name_04900"),
+    ENTRY( 4901, "name_04901"),
+    ENTRY( 4902, "name_04902"),
+    ENTRY( 4903, "name_04903"),
+    ENTRY( 4904, "name_04904"),
+    ENTRY( 4905, "name_04905"),
+    ENTRY( 4906, "name_04906"),
+    ENTRY( 4907, "name_04907"),
+    ENTRY( 4908, "name_04908"),
+    ENTRY( 4909, "name_04909"),
+    ENTRY( 4910, "name_04910"),
+    ENTRY( 4911, "name_04911"),
+    ENTRY( 4912, "name_04912"),
+    ENTRY( 4913, "name_04913"),
+    ENTRY( 4914, "name_04914"),
+    ENTRY( 4915, "name_04915"),
+    ENTRY( 4916, "name_04916"),
+    ENTRY( 4917, "name_04917"),
+    ENTRY( 4918, "name_04918"),
+    ENTRY( 4919, "name_04919"),
+    ENTRY( 4920, "name_04920"),
+    ENTRY( 4921, "name_04921"),
+    ENTRY( 4922, "name_04922"),
+    ENTRY( 4923, "name_04923"),
+    ENTRY( 4924, "name_04924"),
+    ENTRY( 4925, "name_04925"),
+    ENTRY( 4926, "name_04926"),
+    ENTRY( 4927, "name_04927"),
+    ENTRY( 4928, "name_04928"),
+    ENTRY( 4929, "name_04929"),
+    ENTRY( 4930, "name_04930"),
+    ENTRY( 4931, "name_04931"),
+    ENTRY( 4932, "name_04932"),
+    ENTRY( 4933, "name_04933"),
+    ENTRY( 4934, "name_04934"),
+    ENTRY( 4935, "name_04935"),
+    ENTRY( 4936, "name_04936"),
+    ENTRY( 4937, "name_04937"),
+    ENTRY( 4938, "name_04938"),
+    ENTRY( 4939, "name_04939"),
+    ENTRY( 4940, "name_04940"),
+    ENTRY( 4941, "name_04941"),
+    ENTRY( 4942, "name_04942"),
+    ENTRY( 4943, "name_04943"),
+    ENTRY( 4944, "name_04944"),
+    ENTRY( 4945, "name_04945"),
+    ENTRY( 4946, "name_04946"),
+    ENTRY( 4947, "name_04947"),
+    ENTRY( 4948, "name_04948"),
+    ENTRY( 4949, "name_04949"),
+    ENTRY( 4950, "name_04950"),
+    ENTRY( 4951, "name_04951"),
+    ENTRY( 4952, "name_04952"),
+    ENTRY( 4953, "name_04953"),
+    ENTRY( 4954, "name_04954"),
+    ENTRY( 4955, "name_04955"),
+    ENTRY( 4956, "name_04956"),
+    ENTRY( 4957, "name_04957"),
+    ENTRY( 4958, "name_04958"),
+    ENTRY( 4959, "name_04959"),
+    ENTRY( 4960, "name_04960"),
+    ENTRY( 4961, "name_04961"),
+    ENTRY( 4962, "name_04962"),
+    ENTRY( 4963, "name_04963"),
+    ENTRY( 4964, "name_04964"),
+    ENTRY( 4965, "name_04965"),
+    ENTRY( 4966, "name_04966"),
+    ENTRY( 4967, "name_04967"),
+    ENTRY( 4968, "name_04968"),
+    ENTRY( 4969, "name_04969"),
+    ENTRY( 4970, "name_04970"),
+    ENTRY( 4971, "name_04971"),
+    ENTRY( 4972, "name_04972"),
+    ENTRY( 4973, "name_04973"),
+    ENTRY( 4974, "name_04974"),
+    ENTRY( 4975, "name_04975"),
+    ENTRY( 4976, "name_04976"),
+    ENTRY( 4977, "name_04977"),
+    ENTRY( 4978, "name_04978"),
+    ENTRY( 4979, "name_04979"),
+    ENTRY( 4980, "name_04980"),
+    ENTRY( 4981, "name_04981"),
+    ENTRY( 4982, "name_04982"),
+    ENTRY( 4983, "name_04983"),
+    ENTRY( 4984, "name_04984"),
+    ENTRY( 4985, "name_04985"),
+    ENTRY( 4986, "name_04986"),
+    ENTRY( 4987, "name_04987"),
+    ENTRY( 4988, "name_04988"),
+    ENTRY( 4989, "name_04989"),
+    ENTRY( 4990, "name_04990"),
+    ENTRY( 4991, "name_04991"),
+    ENTRY( 4992, "name_04992"),
+    ENTRY( 4993, "name_04993"),
+    ENTRY( 4994, "name_04994"),
+    ENTRY( 4995, "name_04995"),
+    ENTRY( 4996, "name_04996"),
+    ENTRY( 4997, "name_04997"),
+    ENTRY( 4998, "name_04998"),
+    ENTRY( 4999, "name_04999"),
+    ENTRY( 5000, "name_05000"),
+    ENTRY( 0, "end"));
+
+/*  x;  */
+x;
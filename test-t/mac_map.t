@@ -0,0 +1,70 @@
+/* mac_map.t:   macro map of -Y option.  */
+/*
+ * Preprocess this file by
+ *      mcpp -Y mac_map.map mac_map.t mac_map.i
+ * and decode the map by mac_map of the tool directory:
+ *      mac_map mac_map.map mac_map.i
+ * The results are shown below.  The columns start at 1 and an end column is
+ * the one next to the last character.  The text of the output shown at each
+ * "out of call" should be the expansion of the top-level call.
+ */
+
+#define ZERO_TOKEN
+#define MACRO_0         0
+#define MACRO_1         1
+#define SUB( x, y)      (x - y)
+#define GLUE( a, b)     a ## b
+#define XGLUE( a, b)    GLUE( a, b)
+#define MAKE( n)        XGLUE( MACRO_, n)
+
+/* An object-like macro expanded to nothing and another one.   */
+ZERO_TOKEN MACRO_1;
+/* Arguments spanning lines, and nested calls in the arguments and in the
+        rescans.    */
+SUB( MACRO_1, 2) + SUB(
+    MACRO_0, MAKE( 1));
+MAKE( 0);
+
+/*
+ * file 1: <the directory>/mac_map.t
+ * macro 1: ZERO_TOKEN defined at file 1, line 12
+ * call 0: ZERO_TOKEN at file 1, 21:1-21:11
+ * macro 2: MACRO_1 defined at file 1, line 14
+ * call 1: MACRO_1 at file 1, 21:12-21:19
+ * out of call 0: offset <n>, length 0
+ * out of call 1: offset <n>, length 1: 1
+ * macro 3: SUB defined at file 1, line 15
+ * call 2: SUB at file 1, 24:1-24:17
+ *     arg 1: 24:6-24:13
+ *     arg 2: 24:15-24:16
+ * call 3:   MACRO_1
+ * macro 4: MACRO_0 defined at file 1, line 13
+ * macro 5: MAKE defined at file 1, line 18
+ * macro 6: XGLUE defined at file 1, line 17
+ * macro 7: GLUE defined at file 1, line 16
+ * call 4: SUB at file 1, 24:20-25:23
+ *     arg 1: 25:5-25:12
+ *     arg 2: 25:14-25:22
+ * call 5:   MACRO_0
+ * call 6:   MAKE
+ *     arg 1: not in the source
+ * call 7:     XGLUE
+ *     arg 1: not in the source
+ *     arg 2: not in the source
+ * call 8:       GLUE
+ *     arg 1: not in the source
+ *     arg 2: not in the source
+ * call 9:         MACRO_1
+ * out of call 2: offset <n>, length 8: ( 1 - 2)
+ * out of call 4: offset <n>, length 9: ( 0 - 1 )
+ * call 10: MAKE at file 1, 26:1-26:9
+ *     arg 1: 26:7-26:8
+ * call 11:   XGLUE
+ *     arg 1: not in the source
+ *     arg 2: not in the source
+ * call 12:     GLUE
+ *     arg 1: not in the source
+ *     arg 2: not in the source
+ * call 13:       MACRO_0
+ * out of call 10: offset <n>, length 1: 0
+ */
@@ -0,0 +1,94 @@
+/* mac_nest.t:  nest of macro replacements deeper than 64 levels.  */
+/*
+ * Each macro of the chain is found in the rescan of the replacement list of
+ * the previous one, so that the replacements of the 80 macros are nested.
+ * The nest is limited only by RESCAN_LIMIT (0x1000) of system.H, which was
+ * 0x40.
+ */
+
+#define NEST80      NEST79
+#define NEST79      NEST78
+#define NEST78      NEST77
+#define NEST77      NEST76
+#define NEST76      NEST75
+#define NEST75      NEST74
+#define NEST74      NEST73
+#define NEST73      NEST72
+#define NEST72      NEST71
+#define NEST71      NEST70
+#define NEST70      NEST69
+#define NEST69      NEST68
+#define NEST68      NEST67
+#define NEST67      NEST66
+#define NEST66      NEST65
+#define NEST65      NEST64
+#define NEST64      NEST63
+#define NEST63      NEST62
+#define NEST62      NEST61
+#define NEST61      NEST60
+#define NEST60      NEST59
+#define NEST59      NEST58
+#define NEST58      NEST57
+#define NEST57      NEST56
+#define NEST56      NEST55
+#define NEST55      NEST54
+#define NEST54      NEST53
+#define NEST53      NEST52
+#define NEST52      NEST51
+#define NEST51      NEST50
+#define NEST50      NEST49
+#define NEST49      NEST48
+#define NEST48      NEST47
+#define NEST47      NEST46
+#define NEST46      NEST45
+#define NEST45      NEST44
+#define NEST44      NEST43
+#define NEST43      NEST42
+#define NEST42      NEST41
+#define NEST41      NEST40
+#define NEST40      NEST39
+#define NEST39      NEST38
+#define NEST38      NEST37
+#define NEST37      NEST36
+#define NEST36      NEST35
+#define NEST35      NEST34
+#define NEST34      NEST33
+#define NEST33      NEST32
+#define NEST32      NEST31
+#define NEST31      NEST30
+#define NEST30      NEST29
+#define NEST29      NEST28
+#define NEST28      NEST27
+#define NEST27      NEST26
+#define NEST26      NEST25
+#define NEST25      NEST24
+#define NEST24      NEST23
+#define NEST23      NEST22
+#define NEST22      NEST21
+#define NEST21      NEST20
+#define NEST20      NEST19
+#define NEST19      NEST18
+#define NEST18      NEST17
+#define NEST17      NEST16
+#define NEST16      NEST15
+#define NEST15      NEST14
+#define NEST14      NEST13
+#define NEST13      NEST12
+#define NEST12      NEST11
+#define NEST11      NEST10
+#define NEST10      NEST9
+#define NEST9       NEST8
+#define NEST8       NEST7
+#define NEST7       NEST6
+#define NEST6       NEST5
+#define NEST5       NEST4
+#define NEST4       NEST3
+#define NEST3       NEST2
+#define NEST2       NEST1
+#define NEST1       NEST0
+#define NEST0       nested
+
+/*  nested;  */
+    NEST80;
+/*  nested + nested;    */
+    NEST80 + NEST40;
@@ -0,0 +1,29 @@
+/* profile.t:   profile of the macro expansions.  */
+/*
+ * "#pragma MCPP debug profile" counts the calls of each macro definition
+ * and puts out the counts in CSV at the end of the input.  The calls nested
+ * in an expansion are counted, even if the expansion is repeated.
+ * The seconds vary with the machine.
+ */
+
+#pragma MCPP debug profile
+
+#define INNER           1
+#define OUTER           (INNER + INNER)
+#define TWICE( x)       OUTER * x
+
+/* Each expansion of OUTER calls INNER twice.  */
+/*  (1 + 1); (1 + 1);   */
+    OUTER; OUTER;
+/*  (1 + 1) * (1 + 1);  */
+    TWICE( OUTER);
+
+/*
+ * The report is sorted by the seconds, and has the following rows:
+ *      macro,file,line,calls,bytes,arg_bytes,seconds,depth
+ *      "OUTER","<the directory>/profile.t",12,4,52,0,<seconds>,1
+ *      "TWICE","<the directory>/profile.t",13,1,31,8,<seconds>,2
+ *      "INNER","<the directory>/profile.t",11,8,24,0,<seconds>,0
+ * OUTER is called 4 times: twice on the line of "OUTER; OUTER;", once in
+ * the argument of TWICE and once in the rescan of TWICE.
+ */
@@ -0,0 +1,63 @@
+/* src_map.t:   source map of -L option.  */
+/*
+ * Preprocess this file by
+ *      mcpp -L src_map.map src_map.t src_map.i
+ * and look up the map by src_map of the tool directory.  The results are
+ * shown below.  The lines and the columns start at 1.
+ */
+
+#define MACRO_1         1
+#define SUB( x, y)      (x - y)
+#define MAKE( n)        SUB( n, MACRO_1)
+
+int a = MACRO_1;
+int b = SUB( a,
+        MACRO_1) + MAKE( 2);
+int c;
+
+/*
+ * The output lines:
+ *      1   #line 1 "<the directory>/src_map.t"
+ *      2   #line 13 "<the directory>/src_map.t"
+ *      3   int a =  1 ;
+ *      4   int b =  (a - 1 )
+ *      5   #line 15 "<the directory>/src_map.t"
+ *      6                    +  (2 - 1 ) ;
+ *      7   int c;
+ *
+ * "src_map src_map.map" dumps the map:
+ * file 1: <the directory>/src_map.t
+ * macro 1: MACRO_1 defined at file 1, line 9
+ * chain 1: 0:1
+ * 3:1	file 1, 13:1
+ * 3:9	file 1, 13:9, chain 1
+ * 3:12	file 1, 13:16
+ * macro 2: SUB defined at file 1, line 10
+ * chain 2: 0:2 1:1
+ * 4:1	file 1, 14:1
+ * 4:9	file 1, 14:9, chain 2
+ * macro 3: MAKE defined at file 1, line 11
+ * chain 3: 0:3 1:2 2:1
+ * 6:17	file 1, 15:17
+ * 6:20	file 1, 15:20, chain 3
+ * 6:30	file 1, 15:28
+ * 7:1	file 1, 16:1
+ *
+ * "src_map src_map.map 3 10" prints:
+ * <the directory>/src_map.t:13:9
+ *   in expansion of MACRO_1, defined at <the directory>/src_map.t:9
+ *
+ * "src_map src_map.map 4 12" prints:
+ * <the directory>/src_map.t:14:9
+ *   in expansion of SUB, defined at <the directory>/src_map.t:10
+ *     calls MACRO_1, defined at <the directory>/src_map.t:9
+ *
+ * "src_map src_map.map 6 22" prints:
+ * <the directory>/src_map.t:15:20
+ *   in expansion of MAKE, defined at <the directory>/src_map.t:11
+ *     calls SUB, defined at <the directory>/src_map.t:10
+ *       calls MACRO_1, defined at <the directory>/src_map.t:9
+ *
+ * "src_map src_map.map 7 5" prints:
+ * <the directory>/src_map.t:16:5
+ */
@@ -0,0 +1,522 @@
+/* bench.c:     to measure the throughput of mcpp on the sources made for
+ *      some workloads.
+ *
+ *  Usage:  bench -w workload [-n size] [-p param] [-r repeat] [-f file]
+ *          [-m option] [-a] mcpp [options]
+ *
+ *  Makes a source file of the 'workload', whose size and shape are set by
+ *  'size' and 'param', then preprocesses it 'repeat' times (5 by default)
+ *  in each of the modes of the workload, and reports the CPU time of mcpp
+ *  and the throughput.  The options following 'mcpp' are passed to every
+ *  run.  The workloads are:
+ *    trig:     'size' lines (200000 by default), one of each 'param' lines
+ *          (100) of which has a trigraph and a digraph, in the modes:
+ *              trig off:   mcpp [options] file
+ *              trig on:    mcpp [options] -3 file
+ *              dig on:     mcpp [options] -@post file
+ *    skip:     A header-like source of about 'size' lines (500000), 'param'
+ *          % (90) of which are in groups of "#if SKIP_BENCH_ON", in the
+ *          modes:
+ *              skipped:    mcpp [options] -DSKIP_BENCH_ON=0 file
+ *              compiled:   mcpp [options] -DSKIP_BENCH_ON=1 file
+ *    macro:    A source which defines a small library of macros written in
+ *          the style of Boost.Preprocessor (PP_CAT, PP_IIF, PP_BOOL,
+ *          PP_INC, PP_COMMA_IF, PP_REPEAT and PP_ENUM_PARAMS) and then uses
+ *          them 'size' times (2000), in the mode:
+ *              expand:     mcpp [options] file
+ *    inc:      'param' (40) include directories, each of which has a "sys"
+ *          subdirectory, 'size' (2000) pairs of "hN.h" and "sys/sN.h"
+ *          distributed over them and a source including all of them by
+ *          #include <...>, so that most of the probes into the directories
+ *          are misses, in the modes:
+ *              search:     mcpp [options] -I dir ... file
+ *              indexed:    mcpp [options] -I dir ... -B file
+ *          Add -a option to see the system calls on the file system, and
+ *          -m "-B -H" option to compare the mode without dereference of
+ *          symbolic links (-B -fno-canonical-system-headers on
+ *          GCC-specific-build).
+ *  With -f option, preprocesses the specified file instead in the modes,
+ *  for example, a source including <boost/preprocessor.hpp> in the macro
+ *  workload.
+ *  With -m option, runs one more mode adding the 'option'.
+ *  With -a option, runs mcpp once more in each mode on the source followed
+ *  by '#pragma MCPP debug memory' and prints the report of mcpp, such as
+ *  the numbers of allocations and of the system calls on the file system.
+ *  This program uses times() of POSIX to get the CPU time of the children.
+ */
+
+#include    "stdio.h"
+#include    "stdlib.h"
+#include    "string.h"
+#include    "sys/stat.h"
+#include    "sys/times.h"
+#include    "sys/wait.h"
+#include    "unistd.h"
+
+#define TMPNAME     "bench.tmp.c"
+#define WRAPNAME    "bench.tmp.w.c"
+#define MARK        "bench_report_follows"
+#define MAX_MODES   4       /* Modes of a workload and the terminator   */
+
+#define GROUP       100     /* skip: Lines of a group                   */
+#define LIMIT       64      /* macro: Upper limit of the numbers        */
+#define REPEAT      32      /* macro: Count of PP_REPEAT() in a use     */
+#define PARAMS      16      /* macro: Count of PP_ENUM_PARAMS() in a use */
+#define TMPDIR      "bench.tmp"     /* inc: Root of the directories     */
+
+typedef struct mode {
+    const char *    name;
+    const char *    opt;                    /* Option of the mode   */
+} MODE;
+
+typedef struct workload {
+    const char *    name;
+    const char *    size_name;              /* Meaning of -n        */
+    long            size;                   /* Default of -n        */
+    const char *    param_name;             /* Meaning of -p or NULL*/
+    long            param;                  /* Default of -p        */
+    long    (* make)( FILE * fp, long size, long param, char * options);
+            /* Write the source, add options and return its size    */
+    void    (* clean)( long size, long param);
+            /* Remove the other files made by 'make', or NULL       */
+    MODE            modes[ MAX_MODES];
+} WORKLOAD;
+
+void    usage( void);
+long    make_source( const WORKLOAD * wl, long size, long param
+        , char * options);
+int     run_mode( const char * mcpp, const char * options, const MODE * mp
+        , const char * src, long bytes, int repeat, int report);
+double  run( const char * command, int repeat);
+void    print_report( const char * command, const char * src);
+long    make_trig( FILE * fp, long lines, long per_lines, char * options);
+long    make_skip( FILE * fp, long lines, long percent, char * options);
+long    make_macro( FILE * fp, long uses, long param, char * options);
+long    make_inc( FILE * fp, long headers, long dirs, char * options);
+void    clean_inc( long headers, long dirs);
+
+static const WORKLOAD   workloads[] = {
+    { "trig",   "lines",    200000L,    "lines per trigraph",   100L,
+        make_trig,  NULL,
+        { { "trig off", ""}, { "trig on", "-3"}, { "dig on", "-@post"}, } },
+    { "skip",   "lines",    500000L,    "% skipped",            90L,
+        make_skip,  NULL,
+        { { "skipped", "-DSKIP_BENCH_ON=0"},
+            { "compiled", "-DSKIP_BENCH_ON=1"}, } },
+    { "macro",  "uses",     2000L,      NULL,                   0L,
+        make_macro, NULL,
+        { { "expand", ""}, } },
+    { "inc",    "headers",  2000L,      "directories",          40L,
+        make_inc,   clean_inc,
+        { { "search", ""}, { "indexed", "-B"}, } },
+    { NULL, },
+};
+
+int     main( int argc, char ** argv)
+{
+    char    options[ BUFSIZ * 2];
+    const WORKLOAD *    wl;
+    const MODE *    mp;
+    MODE    extra;
+    const char *    name = NULL;
+    const char *    src = NULL;
+    char *  cp;
+    FILE *  fp;
+    long    size = -1L;
+    long    param = -1L;
+    long    bytes;
+    int     repeat = 5;
+    int     report = 0;
+    int     i;
+
+    extra.name = extra.opt = NULL;
+    while (argc > 2 && argv[ 1][ 0] == '-' && argv[ 1][ 2] == '\0') {
+        if (argv[ 1][ 1] == 'a') {          /* No argument          */
+            report = 1;
+            argc--;
+            argv++;
+            continue;
+        }
+        switch (argv[ 1][ 1]) {
+        case 'w':   name = argv[ 2];                break;
+        case 'n':   size = atol( argv[ 2]);         break;
+        case 'p':   param = atol( argv[ 2]);        break;
+        case 'r':   repeat = atoi( argv[ 2]);       break;
+        case 'f':   src = argv[ 2];                 break;
+        case 'm':   extra.name = extra.opt = argv[ 2];  break;
+        default:    usage();
+        }
+        argc -= 2;
+        argv += 2;
+    }
+    if (argc < 2 || name == NULL || repeat <= 0)
+        usage();
+    for (wl = workloads; wl->name; wl++) {
+        if (strcmp( wl->name, name) == 0)
+            break;
+    }
+    if (wl->name == NULL)
+        usage();
+    if (size == -1L)
+        size = wl->size;
+    if (param == -1L)
+        param = wl->param;
+    if (size <= 0L)
+        usage();
+    cp = options;
+    *cp = '\0';
+    for (i = 2; i < argc; i++) {
+        sprintf( cp, " %s", argv[ i]);
+        cp += strlen( cp);
+    }
+
+    if (src != NULL) {
+        if ((fp = fopen( src, "r")) == NULL) {
+            perror( src);
+            exit( 1);
+        }
+        fseek( fp, 0L, SEEK_END);
+        bytes = ftell( fp);
+        fclose( fp);
+        fprintf( stderr, "%s, %ld bytes", src, bytes);
+    } else {
+        if ((bytes = make_source( wl, size, param, options)) < 0L)
+            usage();
+        fprintf( stderr, "%ld %s", size, wl->size_name);
+        if (wl->param_name)
+            fprintf( stderr, ", %ld %s", param, wl->param_name);
+        fprintf( stderr, ", %ld bytes", bytes);
+    }
+    fprintf( stderr, ", run %d times each\n", repeat);
+    for (mp = wl->modes; mp->name; mp++) {
+        if (run_mode( argv[ 1], options, mp, src ? src : TMPNAME, bytes
+                , repeat, report) != 0)
+            break;
+    }
+    if (mp->name == NULL && extra.name)
+        run_mode( argv[ 1], options, &extra, src ? src : TMPNAME, bytes
+                , repeat, report);
+    if (src == NULL) {
+        remove( TMPNAME);
+        if (wl->clean)
+            (*wl->clean)( size, param);
+    }
+    return  0;
+}
+
+long    make_source( const WORKLOAD * wl, long size, long param
+        , char * options)
+/*
+ * Write the source file of the workload by its generator, and return the
+ * size of the file, or -1L if the generator rejects 'param'.
+ */
+{
+    FILE *  fp;
+    long    bytes;
+
+    if ((fp = fopen( TMPNAME, "w")) == NULL) {
+        perror( TMPNAME);
+        exit( 1);
+    }
+    bytes = (*wl->make)( fp, size, param, options);
+    fclose( fp);
+    if (bytes < 0L)
+        remove( TMPNAME);
+    return  bytes;
+}
+
+int     run_mode( const char * mcpp, const char * options, const MODE * mp
+        , const char * src, long bytes, int repeat, int report)
+/*
+ * Preprocess 'src' in the mode 'repeat' times and print the CPU time and
+ * the throughput, and the report of mcpp if 'report' is set.  Return 0 on
+ * success, -1 on failure of execution.
+ */
+{
+    char    command[ BUFSIZ * 3];
+    size_t  len;
+    double  sec;
+
+    sprintf( command, "%s%s %s", mcpp, options, mp->opt);
+    len = strlen( command);
+    sprintf( command + len, " %s > /dev/null 2>&1", src);
+    sec = run( command, repeat);
+    if (sec < 0.0) {
+        fprintf( stderr, "Command execution error: %s\n", command);
+        return  -1;
+    }
+    printf( "%-10s%10.3f sec%10.1f MB/s\n", mp->name, sec
+            , sec > 0.0 ? bytes * (double) repeat / sec / 1e6 : 0.0);
+    if (report) {
+        command[ len] = '\0';              /* Without the source   */
+        print_report( command, src);
+    }
+    return  0;
+}
+
+double  run( const char * command, int repeat)
+/*
+ * Run the command 'repeat' times and return the CPU time of the children.
+ * The exit status of mcpp is not checked except for failure of execution,
+ * since a real source (e.g. of Boost) may cause some errors in mcpp.
+ */
+{
+    struct tms  start, end;
+    int     i;
+    int     status;
+
+    times( &start);
+    for (i = 0; i < repeat; i++) {
+        status = system( command);
+        if (status == -1 || (WIFEXITED( status) && WEXITSTATUS( status) == 127))
+            return  -1.0;
+    }
+    times( &end);
+    return  (double) (end.tms_cutime + end.tms_cstime
+            - start.tms_cutime - start.tms_cstime) / sysconf( _SC_CLK_TCK);
+}
+
+void    print_report( const char * command, const char * src)
+/*
+ * Run the command once on the source followed by the MEMORY debug class
+ * and print the lines of the report of mcpp, which follow the MARK line of
+ * the output.
+ */
+{
+    char    buf[ BUFSIZ * 4];
+    char    line[ BUFSIZ];
+    FILE *  fp;
+    int     in_report = 0;
+
+    if ((fp = fopen( WRAPNAME, "w")) == NULL) {
+        perror( WRAPNAME);
+        exit( 1);
+    }
+    fprintf( fp, "#include \"%s\"\n%s\n#pragma MCPP debug memory\n"
+            "#pragma MCPP end_debug memory\n", src, MARK);
+    fclose( fp);
+    sprintf( buf, "%s %s 2>/dev/null", command, WRAPNAME);
+    if ((fp = popen( buf, "r")) == NULL) {
+        fprintf( stderr, "Command execution error: %s\n", buf);
+        remove( WRAPNAME);
+        return;
+    }
+    while (fgets( line, BUFSIZ, fp) != NULL) {
+        if (in_report) {
+            if (line[ 0] != '\n' && line[ 0] != '#')
+                printf( "    %s", line);
+        } else if (strncmp( line, MARK, strlen( MARK)) == 0) {
+            in_report = 1;
+        }
+    }
+    pclose( fp);
+    remove( WRAPNAME);
+    if (! in_report)
+        fputs( "    No report of mcpp\n", stdout);
+}
+
+long    make_trig( FILE * fp, long lines, long per_lines, char * options)
+/*
+ * Write ordinary C lines sprinkled with trigraphs and digraphs.
+ */
+{
+    long    n;
+    long    size = 0L;
+
+    if (per_lines < 0L)
+        return  -1L;
+    for (n = 0L; n < lines; n++) {
+        if (per_lines > 0 && n % per_lines == 0)
+            size += fprintf( fp, "int   a%ld<:2:> = <%% %ld, 0 %%>; "
+                    "/* ?\?( ?\?) */\n", n, n);
+        else
+            size += fprintf( fp, "static int   func%ld( int arg1, int arg2)"
+                    " { return arg1 * %ld + arg2; }\n", n, n);
+    }
+    return  size;
+}
+
+long    make_skip( FILE * fp, long lines, long percent, char * options)
+/*
+ * Write groups of GROUP lines, 'percent' lines of each are enclosed by
+ * "#if SKIP_BENCH_ON".  The lines are of declarations with comments, some
+ * of which cross the lines, and with string literals as in a platform
+ * header.
+ */
+{
+    long    n, i;
+    long    size = 0L;
+    long    skipped = GROUP * percent / 100;
+
+    if (percent < 0L || percent > 100L)
+        return  -1L;
+    for (n = 0L; n < lines; n += GROUP) {
+        for (i = 0; i < GROUP; i++) {
+            if (i == 0 && skipped > 0)
+                size += fprintf( fp, "#if SKIP_BENCH_ON\n");
+            switch (i % 10) {
+            case 0:
+                size += fprintf( fp, "/*\n * Declarations of group %ld\n */\n"
+                        , n + i);
+                break;
+            case 1:
+            case 2:                 /* Lines of the comment above   */
+                break;
+            case 3:
+                size += fprintf( fp, "// Data of function_%ld()\n", n + i);
+                break;
+            case 4:
+                size += fprintf( fp, "static const char   name_%ld[] ="
+                        " \"function_%ld\";\n", n + i, n + i);
+                break;
+            case 5:
+                size += fprintf( fp, "#define   MACRO_%ld   (%ld + 1)\n"
+                        , n + i, n + i);
+                break;
+            default:
+                size += fprintf( fp, "extern int      function_%ld( const char"
+                        " * name, unsigned long flags, void * data);"
+                        "   /* 0 on success */\n", n + i);
+                break;
+            }
+            if (i == skipped - 1)
+                size += fprintf( fp, "#endif\n");
+        }
+    }
+    return  size;
+}
+
+long    make_macro( FILE * fp, long uses, long param, char * options)
+/*
+ * Write the macro library and 'uses' uses of it.  A use expands to several
+ * hundreds of nested macro calls.
+ */
+{
+    long    n;
+    long    size = 0L;
+
+    size += fprintf( fp,
+            "#define PP_CAT( a, b)       PP_CAT_I( a, b)\n"
+            "#define PP_CAT_I( a, b)     a ## b\n"
+            "#define PP_IIF( bit, t, f)  PP_IIF_I( bit, t, f)\n"
+            "#define PP_IIF_I( bit, t, f)    PP_IIF_ ## bit( t, f)\n"
+            "#define PP_IIF_0( t, f)     f\n"
+            "#define PP_IIF_1( t, f)     t\n"
+            "#define PP_BOOL( x)         PP_BOOL_I( x)\n"
+            "#define PP_BOOL_I( x)       PP_BOOL_ ## x\n"
+            "#define PP_INC( x)          PP_INC_I( x)\n"
+            "#define PP_INC_I( x)        PP_INC_ ## x\n"
+            "#define PP_COMMA_IF( n)     PP_COMMA_IF_I( PP_BOOL( n))\n"
+            "#define PP_COMMA_IF_I( b)   PP_COMMA_IF_II( b)\n"
+            "#define PP_COMMA_IF_II( b)  PP_COMMA_IF_ ## b\n"
+            "#define PP_COMMA_IF_0\n"
+            "#define PP_COMMA_IF_1       ,\n"
+            "#define PP_REPEAT( count, m, d) PP_REPEAT_I( count, m, d)\n"
+            "#define PP_REPEAT_I( count, m, d)   PP_REPEAT_ ## count( m, d)\n"
+            "#define PP_REPEAT_0( m, d)\n"
+            "#define PP_ENUM_PARAMS_M( n, d) PP_COMMA_IF( n) PP_CAT( d, n)\n"
+            "#define PP_ENUM_PARAMS( count, param)   PP_REPEAT( count"
+                    ", PP_ENUM_PARAMS_M, param)\n"
+            "#define DECL_M( n, d)   int PP_CAT( d, n) = PP_IIF( PP_BOOL( n)"
+                    ", PP_INC( n), 0);\n");
+    for (n = 0L; n <= LIMIT; n++) {
+        size += fprintf( fp, "#define PP_BOOL_%ld %d\n", n, n ? 1 : 0);
+        size += fprintf( fp, "#define PP_INC_%ld %ld\n", n, n + 1);
+        if (n)
+            size += fprintf( fp, "#define PP_REPEAT_%ld( m, d) PP_REPEAT_%ld"
+                    "( m, d) m( %ld, d)\n", n, n - 1, n - 1);
+    }
+    for (n = 0L; n < uses; n++) {
+        size += fprintf( fp, "PP_REPEAT( %d, DECL_M, v%ld_)\n", REPEAT, n);
+        size += fprintf( fp, "template <PP_ENUM_PARAMS( %d, class T)> struct"
+                " s%ld;\n", PARAMS, n);
+    }
+    return  size;
+}
+
+long    make_inc( FILE * fp, long headers, long dirs, char * options)
+/*
+ * Make the directories and the headers, write the source including them
+ * and add the -I options of the directories.  The header N is put in the
+ * directory N % dirs.
+ */
+{
+    char    name[ FILENAME_MAX];
+    FILE *  hp;
+    long    i;
+    long    size = 0L;
+
+    if (dirs <= 0L || dirs > 100L)
+        return  -1L;
+    if (mkdir( TMPDIR, 0777) != 0) {
+        perror( TMPDIR);
+        exit( 1);
+    }
+    options += strlen( options);
+    for (i = 0; i < dirs; i++) {
+        sprintf( name, "%s/d%ld", TMPDIR, i);
+        mkdir( name, 0777);
+        sprintf( options, " -I %s", name);
+        options += strlen( options);
+        strcat( name, "/sys");
+        mkdir( name, 0777);
+    }
+    for (i = 0; i < headers; i++) {
+        sprintf( name, "%s/d%ld/h%ld.h", TMPDIR, i % dirs, i);
+        if ((hp = fopen( name, "w")) == NULL) {
+            perror( name);
+            exit( 1);
+        }
+        fprintf( hp, "extern int    h%ld;\n", i);
+        fclose( hp);
+        sprintf( name, "%s/d%ld/sys/s%ld.h", TMPDIR, i % dirs, i);
+        if ((hp = fopen( name, "w")) == NULL) {
+            perror( name);
+            exit( 1);
+        }
+        fprintf( hp, "extern int    s%ld;\n", i);
+        fclose( hp);
+        size += fprintf( fp, "#include <h%ld.h>\n#include <sys/s%ld.h>\n"
+                , i, i);
+    }
+    return  size;
+}
+
+void    clean_inc( long headers, long dirs)
+/*
+ * Remove the directories and the headers made by make_inc().
+ */
+{
+    char    name[ FILENAME_MAX];
+    long    i;
+
+    for (i = 0; i < headers; i++) {
+        sprintf( name, "%s/d%ld/h%ld.h", TMPDIR, i % dirs, i);
+        remove( name);
+        sprintf( name, "%s/d%ld/sys/s%ld.h", TMPDIR, i % dirs, i);
+        remove( name);
+    }
+    for (i = 0; i < dirs; i++) {
+        sprintf( name, "%s/d%ld/sys", TMPDIR, i);
+        remove( name);
+        sprintf( name, "%s/d%ld", TMPDIR, i);
+        remove( name);
+    }
+    remove( TMPDIR);
+}
+
+void    usage( void)
+{
+    const WORKLOAD *    wl;
+
+    fputs( "Usage:  bench -w workload [-n size] [-p param] [-r repeat]"
+            " [-f file] [-m option] [-a] mcpp [options]\n", stderr);
+    for (wl = workloads; wl->name; wl++) {
+        fprintf( stderr, "    -w %-8s-n %s (%ld)", wl->name, wl->size_name
+                , wl->size);
+        if (wl->param_name)
+            fprintf( stderr, ", -p %s (%ld)", wl->param_name, wl->param);
+        fputs( "\n", stderr);
+    }
+    exit( 1);
+}
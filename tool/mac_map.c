@@ -0,0 +1,198 @@
+/* mac_map.c:   to decode the macro map written by -Y option of mcpp.
+ *
+ *  Usage:  mac_map map [output]
+ *
+ *  Prints all the records of the map: the file names, the macro
+ *  definitions, the macro calls by the names with their locations in the
+ *  source and those of their arguments, nested calls indented by their
+ *  depth, and the spans of the top-level calls in the output.  With 'output', the file
+ *  preprocessed with the map, the text of each span is also printed, so
+ *  that the expansions can be checked against the calls.
+ *  The format of the map is described at open_mac_map() of expand.c.
+ */
+
+#include    "stdio.h"
+#include    "stdlib.h"
+#include    "string.h"
+
+#define MAP_FNAME       1
+#define MAP_MACRO       2
+#define MAP_CALL        3
+#define MAP_OUT         4
+
+void    usage( void);
+unsigned long   get_num( void);
+char *  get_name( void);
+void    print_span( void);
+void    print_text( long offset, long len);
+
+FILE *  fp;
+FILE *  fp_out;                 /* The output preprocessed with the map */
+char ** macros;                 /* Names of the macros by the id    */
+long    max_macros;
+
+int     main( int argc, char ** argv)
+{
+    char    head[ 8];
+    long    calls = 0L;
+    long    call = 0L;
+    long    end = 0L;
+    long    offset, len;
+    long    n, i;
+    unsigned long   num;
+    char *  name;
+    int     c;
+
+    if (argc < 2 || argc > 3)
+        usage();
+    if ((fp = fopen( argv[ 1], "rb")) == NULL) {
+        perror( argv[ 1]);
+        exit( 1);
+    }
+    if (argc == 3 && (fp_out = fopen( argv[ 2], "rb")) == NULL) {
+        perror( argv[ 2]);
+        exit( 1);
+    }
+    if (fread( head, 1, 8, fp) != 8 || memcmp( head, "MCPPMAP\1", 8) != 0) {
+        fprintf( stderr, "%s: Not a macro map\n", argv[ 1]);
+        exit( 1);
+    }
+
+    while ((c = getc( fp)) != EOF) {
+        ungetc( c, fp);
+        switch (get_num()) {
+        case MAP_FNAME:
+            n = get_num();
+            name = get_name();
+            printf( "file %ld: %s\n", n, name);
+            free( name);
+            break;
+        case MAP_MACRO:
+            n = get_num();
+            name = get_name();
+            num = get_num();
+            i = get_num();
+            printf( "macro %ld: %s defined at file %lu, line %ld\n"
+                    , n, name, num, i);
+            if (n >= max_macros) {          /* The ids are sequential   */
+                max_macros = n * 2;
+                macros = realloc( macros, sizeof (char *) * max_macros);
+                if (macros == NULL) {
+                    fputs( "Out of memory\n", stderr);
+                    exit( 1);
+                }
+            }
+            macros[ n] = name;
+            break;
+        case MAP_CALL:
+            n = get_num();                  /* Depth                */
+            i = get_num();                  /* Macro id             */
+            printf( "call %ld:%*s %s", calls++, (int) n * 2, ""
+                    , i > 0 && i < max_macros ? macros[ i] : "?");
+            if ((num = get_num()) != 0) {
+                printf( " at file %lu, ", num);
+                print_span();
+            }
+            putchar( '\n');
+            for (n = get_num(), i = 1; i <= n; i++) {
+                printf( "    arg %ld: ", i);
+                print_span();
+                putchar( '\n');
+            }
+            break;
+        case MAP_OUT:
+            call += get_num();
+            offset = end + get_num();
+            len = get_num();
+            end = offset + len;
+            printf( "out of call %ld: offset %ld, length %ld", call, offset
+                    , len);
+            if (fp_out && len)
+                print_text( offset, len);
+            putchar( '\n');
+            break;
+        default:
+            fputs( "Unknown record in the map\n", stderr);
+            exit( 1);
+        }
+    }
+    return  0;
+}
+
+void    usage( void)
+{
+    fputs( "Usage:  mac_map map [output]\n", stderr);
+    exit( 1);
+}
+
+unsigned long   get_num( void)
+/*
+ * Read a number in unsigned LEB128.
+ */
+{
+    unsigned long   num = 0;
+    int     shift = 0;
+    int     c;
+
+    do {
+        if ((c = getc( fp)) == EOF) {
+            fputs( "Unexpected end of the map\n", stderr);
+            exit( 1);
+        }
+        num |= (unsigned long) (c & 0x7F) << shift;
+        shift += 7;
+    } while (c & 0x80);
+    return  num;
+}
+
+char *  get_name( void)
+/*
+ * Read a name written as its length followed by the bytes.
+ */
+{
+    size_t  len = get_num();
+    char *  name = malloc( len + 1);
+
+    if (name == NULL || fread( name, 1, len, fp) != len) {
+        fputs( "Broken name in the map\n", stderr);
+        exit( 1);
+    }
+    name[ len] = '\0';
+    return  name;
+}
+
+void    print_span( void)
+/*
+ * Read a location in the source, the start line (0 if not in the source)
+ * followed by the start column, the end line and the end column, and print
+ * it.
+ */
+{
+    long    line, col;
+
+    if ((line = get_num()) == 0L) {
+        fputs( "not in the source", stdout);
+        return;
+    }
+    col = get_num();
+    printf( "%ld:%ld", line, col);
+    line = get_num();
+    col = get_num();
+    printf( "-%ld:%ld", line, col);
+}
+
+void    print_text( long offset, long len)
+/*
+ * Print the text of the span in the output.
+ */
+{
+    int     c;
+
+    if (fseek( fp_out, offset, SEEK_SET) != 0) {
+        fputs( " (out of the output)", stdout);
+        return;
+    }
+    fputs( ": ", stdout);
+    while (len-- > 0 && (c = getc( fp_out)) != EOF)
+        putchar( c);
+}
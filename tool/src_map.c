@@ -0,0 +1,353 @@
+/* src_map.c:   to look up the source map written by -L option of mcpp.
+ *
+ *  Usage:  src_map map [line [column]]
+ *
+ *  With 'line', prints the source location of the 'column' (1 by default)
+ *  of the output line and, if it is in a macro expansion, the macro calls of
+ *  the expansion with the sites of their definitions.  Only the block of the
+ *  map containing the line and the records referred from it are read, using
+ *  the index at the end of the map.
+ *  Without 'line', dumps all the records of the map.
+ *  The format of the map is described at open_src_map() of expand.c.
+ */
+
+#include    "stdio.h"
+#include    "stdlib.h"
+#include    "string.h"
+
+#define MAP_FNAME       1
+#define MAP_MACRO       2
+#define MAP_CHAIN       5
+#define MAP_LINE        6
+#define MAP_INDEX       7
+#define MAP_BLOCK       256     /* Number of MAP_LINEs in a block   */
+
+typedef struct seg {
+    long    col;                /* Output column            */
+    long    fid;                /* File id of the source    */
+    long    line;               /* Line in the source       */
+    long    scol;               /* Column in the source     */
+    long    chain;              /* MAP_CHAIN id or 0        */
+} SEG;
+
+void    usage( void);
+unsigned long   get_num( void);
+char *  get_name( void);
+long *  get_offsets( long num);
+int     get_line( long * linep, SEG ** segsp, long * prevs, int print);
+void    dump( void);
+int     look_up( long line, long col);
+char *  fname( long fid);
+void    print_chain( long chain);
+
+FILE *  fp;
+long    num_blocks;
+long *  block_lines;            /* First output line of each block  */
+long *  block_offsets;          /* Offset of each block             */
+long    num_fnames, num_macros, num_chains;
+long *  fname_offsets;
+long *  macro_offsets;
+long *  chain_offsets;
+
+int     main( int argc, char ** argv)
+{
+    char    head[ 8];
+    unsigned char   tail[ 8];
+    long    index = 0L;
+    int     i;
+
+    if (argc < 2 || argc > 4)
+        usage();
+    if ((fp = fopen( argv[ 1], "rb")) == NULL) {
+        perror( argv[ 1]);
+        exit( 1);
+    }
+    if (fread( head, 1, 8, fp) != 8 || memcmp( head, "MCPPSRC\1", 8) != 0
+            || fseek( fp, -8L, SEEK_END) != 0 || fread( tail, 1, 8, fp) != 8) {
+        fprintf( stderr, "%s: Not a source map\n", argv[ 1]);
+        exit( 1);
+    }
+    for (i = 7; i >= 0; i--)
+        index = (index << 8) | tail[ i];
+    fseek( fp, index, SEEK_SET);
+    if (get_num() != MAP_INDEX) {
+        fprintf( stderr, "%s: Broken index\n", argv[ 1]);
+        exit( 1);
+    }
+    num_blocks = get_num();
+    block_lines = get_offsets( num_blocks);
+    block_offsets = get_offsets( num_blocks);
+    num_fnames = get_num();
+    fname_offsets = get_offsets( num_fnames);
+    num_macros = get_num();
+    macro_offsets = get_offsets( num_macros);
+    num_chains = get_num();
+    chain_offsets = get_offsets( num_chains);
+
+    if (argc == 2) {
+        fseek( fp, 8L, SEEK_SET);
+        dump();
+        return  0;
+    }
+    return  look_up( atol( argv[ 2]), argc == 4 ? atol( argv[ 3]) : 1L);
+}
+
+void    usage( void)
+{
+    fputs( "Usage:  src_map map [line [column]]\n", stderr);
+    exit( 1);
+}
+
+unsigned long   get_num( void)
+/*
+ * Read a number in unsigned LEB128.
+ */
+{
+    unsigned long   num = 0;
+    int     shift = 0;
+    int     c;
+
+    do {
+        if ((c = getc( fp)) == EOF) {
+            fputs( "Unexpected end of the map\n", stderr);
+            exit( 1);
+        }
+        num |= (unsigned long) (c & 0x7F) << shift;
+        shift += 7;
+    } while (c & 0x80);
+    return  num;
+}
+
+char *  get_name( void)
+/*
+ * Read a name written as its length followed by the bytes.
+ */
+{
+    size_t  len = get_num();
+    char *  name = malloc( len + 1);
+
+    if (name == NULL || fread( name, 1, len, fp) != len) {
+        fputs( "Broken name in the map\n", stderr);
+        exit( 1);
+    }
+    name[ len] = '\0';
+    return  name;
+}
+
+long *  get_offsets( long num)
+/*
+ * Read 'num' numbers written as the differences from the previous ones.
+ */
+{
+    long *  offsets = malloc( sizeof (long) * (num + 1));
+    long    prev = 0L;
+    long    i;
+
+    if (offsets == NULL) {
+        fputs( "Out of memory\n", stderr);
+        exit( 1);
+    }
+    for (i = 0; i < num; i++)
+        offsets[ i] = prev += get_num();
+    return  offsets;
+}
+
+int     get_line( long * linep, SEG ** segsp, long * prevs, int print)
+/*
+ * Read the records until a MAP_LINE and decode it into '*linep' and
+ * '*segsp'.  'prevs' has the output line, the file id and the source line
+ * of the previous MAP_LINE.  Return the number of the segments, or -1 at
+ * the end of the map.  MAP_FNAME, MAP_MACRO and MAP_CHAIN are printed if
+ * 'print' is non-zero.
+ */
+{
+    static SEG *    segs;
+    static long     max_segs;
+    unsigned long   num;
+    long    i, n;
+    long    col = 1L;
+    char *  name;
+
+    while (1) {
+        switch (get_num()) {
+        case MAP_FNAME:
+            n = get_num();
+            name = get_name();
+            if (print)
+                printf( "file %ld: %s\n", n, name);
+            free( name);
+            break;
+        case MAP_MACRO:
+            n = get_num();
+            name = get_name();
+            num = get_num();
+            i = get_num();
+            if (print)
+                printf( "macro %ld: %s defined at file %lu, line %ld\n"
+                        , n, name, num, i);
+            free( name);
+            break;
+        case MAP_CHAIN:
+            n = get_num();
+            i = get_num();
+            if (print)
+                printf( "chain %ld:", n);
+            while (i--) {
+                num = get_num();
+                n = get_num();
+                if (print)
+                    printf( " %lu:%ld", num, n);
+            }
+            if (print)
+                putchar( '\n');
+            break;
+        case MAP_LINE:
+            *linep = prevs[ 0] += get_num();
+            n = get_num();
+            if (n > max_segs) {
+                max_segs = n * 2;
+                segs = realloc( segs, sizeof (SEG) * max_segs);
+                if (segs == NULL) {
+                    fputs( "Out of memory\n", stderr);
+                    exit( 1);
+                }
+            }
+            for (i = 0; i < n; i++) {
+                segs[ i].col = col += get_num();
+                if ((segs[ i].fid = get_num()) == 0L)
+                    segs[ i].fid = prevs[ 1];
+                num = get_num();            /* Signed difference    */
+                segs[ i].line = prevs[ 2] += (num & 1) ? - (long) (num >> 1)
+                        - 1 : (long) (num >> 1);
+                segs[ i].scol = get_num();
+                segs[ i].chain = get_num();
+                prevs[ 1] = segs[ i].fid;
+            }
+            *segsp = segs;
+            return  (int) n;
+        default:                            /* MAP_INDEX            */
+            return  -1;
+        }
+    }
+}
+
+void    dump( void)
+/*
+ * Print all the records.
+ */
+{
+    long    prevs[ 3];
+    long    line;
+    long    lines = 0L;
+    SEG *   segs;
+    int     n, i;
+
+    while (1) {
+        if (lines++ % MAP_BLOCK == 0)       /* A block begins       */
+            prevs[ 0] = prevs[ 1] = prevs[ 2] = 0L;
+        if ((n = get_line( &line, &segs, prevs, 1)) < 0)
+            break;
+        for (i = 0; i < n; i++) {
+            printf( "%ld:%ld\tfile %ld, %ld:%ld", line, segs[ i].col
+                    , segs[ i].fid, segs[ i].line, segs[ i].scol);
+            if (segs[ i].chain)
+                printf( ", chain %ld", segs[ i].chain);
+            putchar( '\n');
+        }
+    }
+}
+
+int     look_up( long line, long col)
+/*
+ * Print the source location of the output line and column.
+ */
+{
+    long    prevs[ 3] = { 0L, 0L, 0L};
+    long    lo, hi, mid;
+    long    l;
+    long    i;
+    SEG *   segs;
+    SEG     seg;
+    int     n;
+
+    lo = 0L;
+    hi = num_blocks;
+    while (lo < hi) {                       /* The last block <= line   */
+        mid = (lo + hi) / 2;
+        if (block_lines[ mid] <= line)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo == 0L) {
+        printf( "No source map of line %ld\n", line);
+        return  1;
+    }
+    fseek( fp, block_offsets[ lo - 1], SEEK_SET);
+    for (i = 0; i < MAP_BLOCK; i++) {
+        if ((n = get_line( &l, &segs, prevs, 0)) < 0 || l > line)
+            break;
+        if (l < line)
+            continue;
+        while (--n > 0 && segs[ n].col > col)
+            ;                   /* The last segment at or before col    */
+        seg = segs[ n];
+        if (seg.chain == 0L && col > seg.col)
+            seg.scol += col - seg.col;      /* Goes on in the source*/
+        printf( "%s:%ld:%ld\n", fname( seg.fid), seg.line, seg.scol);
+        if (seg.chain)
+            print_chain( seg.chain);
+        return  0;
+    }
+    printf( "No source map of line %ld\n", line);
+    return  1;
+}
+
+char *  fname( long fid)
+/*
+ * Read the file name of the id.
+ */
+{
+    if (fid < 1L || fid > num_fnames)
+        return  "?";
+    fseek( fp, fname_offsets[ fid - 1], SEEK_SET);
+    get_num();                              /* MAP_FNAME            */
+    get_num();                              /* The id               */
+    return  get_name();
+}
+
+void    print_chain( long chain)
+/*
+ * Print the macro calls of the MAP_CHAIN.
+ */
+{
+    long    n;
+    long    depth, mid;
+    long    line;
+    long    offset;
+    char *  name;
+
+    if (chain < 1L || chain > num_chains)
+        return;
+    fseek( fp, chain_offsets[ chain - 1], SEEK_SET);
+    get_num();                              /* MAP_CHAIN            */
+    get_num();                              /* The id               */
+    for (n = get_num(); n > 0; n--) {
+        depth = get_num();
+        mid = get_num();
+        offset = ftell( fp);
+        if (mid < 1L || mid > num_macros)
+            continue;
+        fseek( fp, macro_offsets[ mid - 1], SEEK_SET);
+        get_num();                          /* MAP_MACRO            */
+        get_num();                          /* The id               */
+        name = get_name();
+        mid = get_num();                    /* File id              */
+        line = get_num();
+        printf( "%*s%s %s, defined at %s:%ld\n", (int) depth * 2 + 2, ""
+                , depth ? "calls" : "in expansion of", name
+                , mid ? fname( mid) : "?", line);
+        free( name);
+        fseek( fp, offset, SEEK_SET);
+    }
+}